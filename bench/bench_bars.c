@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_BARS_TRADES 1000000
+#define BENCH_BARS_CONTRACTS 500
+#define BENCH_BARS_ROUNDS 5
+
+// Helper function to time feeding the trades through an aggregator, shifting
+// them forward each round so time keeps moving
+static void bench_bars_run(const char* name, ninja_trade_t* trades, const ninja_bar_series_t* series, size_t series_count) {
+    ninja_bar_aggregator_t* aggregator = ninja_bar_aggregator_create(series, series_count);
+    if (!aggregator) {
+        printf("  aggregator creation failed\n");
+        return;
+    }
+
+    static ninja_bar_t bars[4096];
+    uint64_t elapsed = 0;
+    uint64_t completed = 0;
+    for (int round = 0; round < BENCH_BARS_ROUNDS; round++) {
+        uint64_t start = bench_now_ns();
+        ninja_bar_add_trades(aggregator, trades, BENCH_BARS_TRADES);
+        size_t count;
+        do {
+            ninja_bar_drain(aggregator, bars, sizeof(bars) / sizeof(bars[0]), &count);
+            completed += count;
+        } while (count > 0);
+        elapsed += bench_now_ns() - start;
+
+        int64_t span = trades[BENCH_BARS_TRADES - 1].timestamp_ns - trades[0].timestamp_ns + 1;
+        for (int i = 0; i < BENCH_BARS_TRADES; i++) {
+            trades[i].timestamp_ns += span;
+        }
+    }
+
+    bench_report(name, (uint64_t)BENCH_BARS_ROUNDS * BENCH_BARS_TRADES, elapsed, 0);
+    bench_sink += (int64_t)completed;
+    ninja_bar_aggregator_destroy(aggregator);
+}
+
+void bench_bars(void) {
+    ninja_trade_t* trades = malloc((size_t)BENCH_BARS_TRADES * sizeof(ninja_trade_t));
+    if (!trades) {
+        printf("  allocation failed\n");
+        return;
+    }
+
+    // A trade every 10 us on a random contract, prices in a random walk
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+    double price = 5300.0;
+    for (int i = 0; i < BENCH_BARS_TRADES; i++) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        price += (double)((int)(random % 3) - 1) * 0.25;
+        trades[i].timestamp_ns = 1717372800000000000LL + (int64_t)i * 10000;
+        trades[i].price = price;
+        trades[i].size = 1 + (int32_t)(random >> 40) % 5;
+        trades[i].contract_id = 100000 + (int32_t)((random >> 20) % BENCH_BARS_CONTRACTS);
+    }
+
+    ninja_bar_series_t minute = { NINJA_BAR_TIME, 60000000000LL };
+    bench_bars_run("1-minute bars, 500 contracts (per trade)", trades, &minute, 1);
+
+    ninja_bar_series_t all[3] = {
+        { NINJA_BAR_TIME, 60000000000LL },
+        { NINJA_BAR_TICKS, 100 },
+        { NINJA_BAR_VOLUME, 250 }
+    };
+    bench_bars_run("time + tick + volume bars (per trade)", trades, all, 3);
+
+    // One contract: every lookup hits the last-contract shortcut
+    for (int i = 0; i < BENCH_BARS_TRADES; i++) {
+        trades[i].contract_id = 100000;
+    }
+    bench_bars_run("time + tick + volume bars, 1 contract", trades, all, 3);
+
+    free(trades);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_CATALOG_CONTRACTS 5000
+#define BENCH_CATALOG_ROUNDS 50
+#define BENCH_CATALOG_PATH "ninja_bench_catalog.bin"
+
+void bench_catalog(void) {
+    ninja_contract_t* contracts = calloc(BENCH_CATALOG_CONTRACTS, sizeof(ninja_contract_t));
+    if (!contracts) {
+        printf("  allocation failed\n");
+        return;
+    }
+
+    for (int i = 0; i < BENCH_CATALOG_CONTRACTS; i++) {
+        contracts[i].contract_id = 2000000 + i;
+        snprintf(contracts[i].symbol, sizeof(contracts[i].symbol), "C%dZ4", i);
+        snprintf(contracts[i].full_name, sizeof(contracts[i].full_name), "Contract %d Dec 2024", i);
+        strcpy(contracts[i].currency, "USD");
+        contracts[i].tick_size = 0.25;
+        contracts[i].tick_value = 12.5;
+        contracts[i].contract_multiplier = 50;
+        contracts[i].is_tradable = true;
+    }
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.contract_catalog_path = BENCH_CATALOG_PATH;
+    remove(BENCH_CATALOG_PATH);
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    if (!client || ninja_add_catalog_contracts(client, contracts, BENCH_CATALOG_CONTRACTS) != NINJA_OK) {
+        printf("  catalog setup failed\n");
+        ninja_client_destroy(client);
+        free(contracts);
+        return;
+    }
+    ninja_client_destroy(client);
+
+    // Warm start: client creation plus the snapshot map and validation
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < BENCH_CATALOG_ROUNDS; round++) {
+        client = ninja_client_create_with_options(&options);
+        ninja_contract_t contract;
+        if (ninja_get_contract_by_symbol(client, "C42Z4", &contract) == NINJA_OK) {
+            bench_sink += contract.contract_id;
+        }
+        ninja_client_destroy(client);
+    }
+    bench_report("client create + catalog load (5k)", BENCH_CATALOG_ROUNDS, bench_now_ns() - start, 0);
+
+    ninja_client_options_t plain_options;
+    ninja_client_options_init(&plain_options, NINJA_ENV_DEMO);
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_CATALOG_ROUNDS; round++) {
+        client = ninja_client_create_with_options(&plain_options);
+        ninja_client_destroy(client);
+    }
+    bench_report("client create without catalog", BENCH_CATALOG_ROUNDS, bench_now_ns() - start, 0);
+
+    // Lookups against the mapped snapshot
+    client = ninja_client_create_with_options(&options);
+    char symbols[64][32];
+    for (int i = 0; i < 64; i++) {
+        snprintf(symbols[i], sizeof(symbols[i]), "C%dZ4", (i * 7919) % BENCH_CATALOG_CONTRACTS);
+    }
+
+    uint64_t lookups = 1000000;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < lookups; i++) {
+        ninja_contract_t contract;
+        if (ninja_get_contract_by_symbol(client, symbols[i & 63], &contract) == NINJA_OK) {
+            bench_sink += contract.contract_id;
+        }
+    }
+    bench_report("catalog lookup by symbol", lookups, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < lookups; i++) {
+        ninja_contract_t contract;
+        if (ninja_get_contract_by_id(client, 2000000 + (int)((i * 7919) % BENCH_CATALOG_CONTRACTS), &contract) == NINJA_OK) {
+            bench_sink += contract.tick_size > 0;
+        }
+    }
+    bench_report("catalog lookup by id", lookups, bench_now_ns() - start, 0);
+
+    // Autocomplete: the first search builds the prefix index
+    ninja_contract_t* found = NULL;
+    size_t count = 0;
+    start = bench_now_ns();
+    ninja_search_contracts(client, "C4", 10, &found, &count);
+    bench_report("contract index build (5k)", 1, bench_now_ns() - start, 0);
+    ninja_free_array(found);
+
+    const char* prefixes[4] = { "c4", "C42", "C4242", "dec 2" };
+    uint64_t searches = 200000;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < searches; i++) {
+        if (ninja_search_contracts(client, prefixes[i & 3], 10, &found, &count) == NINJA_OK) {
+            bench_sink += (int64_t)count;
+            ninja_free_array(found);
+        }
+    }
+    bench_report("contract search, 10 results", searches, bench_now_ns() - start, 0);
+
+    ninja_client_destroy(client);
+    remove(BENCH_CATALOG_PATH);
+    free(contracts);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_chart.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_CHART_BARS 10000
+#define BENCH_CHART_ROUNDS 10
+
+void bench_chart(void) {
+    // An md/getChart body of one week of 1-minute bars
+    size_t capacity = (size_t)BENCH_CHART_BARS * 192 + 64;
+    char* body = malloc(capacity);
+    if (!body) {
+        printf("  allocation failed\n");
+        return;
+    }
+    const int64_t from_ns = 1717372800000000000LL;
+    size_t length = (size_t)snprintf(body, capacity, "{\"charts\":[{\"id\":1,\"td\":20240603,\"bars\":[");
+    for (int i = 0; i < BENCH_CHART_BARS; i++) {
+        char timestamp[NINJA_TIMESTAMP_TEXT_SIZE];
+        ninja_format_timestamp(from_ns + (int64_t)i * 60000000000LL, timestamp, sizeof(timestamp));
+        length += (size_t)snprintf(body + length, capacity - length,
+                                   "%s{\"timestamp\":\"%s\",\"open\":%d.25,\"high\":%d.5,\"low\":%d.0,\"close\":%d.75,"
+                                   "\"upVolume\":%d,\"downVolume\":%d,\"upTicks\":%d,\"downTicks\":%d}",
+                                   i > 0 ? "," : "", timestamp, 5300 + i % 50, 5301 + i % 50, 5299 + i % 50,
+                                   5300 + i % 50, 100 + i % 37, 90 + i % 29, 40 + i % 11, 38 + i % 13);
+    }
+    length += (size_t)snprintf(body + length, capacity - length, "]}]}");
+
+    ninja_chart_rows_t rows;
+    memset(&rows, 0, sizeof(rows));
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_CHART_ROUNDS; i++) {
+        ninja_chart_decode(NINJA_CHART_MINUTE_BARS, body, from_ns, INT64_MAX, &rows);
+        bench_sink += (int64_t)rows.count;
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_report("decode 10k bars (per bar)", (uint64_t)BENCH_CHART_ROUNDS * BENCH_CHART_BARS, elapsed,
+                 (uint64_t)BENCH_CHART_ROUNDS * length);
+
+    // Appending the decoded columns is a handful of sequential writes
+    const char* path = "bench_chart.col";
+    remove(path);
+    size_t column_count;
+    const ninja_column_t* columns = ninja_chart_columns(NINJA_CHART_MINUTE_BARS, &column_count);
+    ninja_columnar_t columnar;
+    if (rows.count == BENCH_CHART_BARS && ninja_columnar_open(&columnar, path, columns, column_count) == NINJA_OK) {
+        start = bench_now_ns();
+        for (int i = 0; i < BENCH_CHART_ROUNDS; i++) {
+            ninja_columnar_append(&columnar, (const void* const*)rows.values, rows.count);
+        }
+        ninja_columnar_close(&columnar);
+        bench_report("append 10k bars (per bar)", (uint64_t)BENCH_CHART_ROUNDS * BENCH_CHART_BARS,
+                     bench_now_ns() - start, (uint64_t)BENCH_CHART_ROUNDS * rows.count * column_count * 8);
+
+        int64_t* timestamps = NULL;
+        size_t count = 0;
+        start = bench_now_ns();
+        ninja_read_column_int64(path, "timestamp_ns", &timestamps, &count);
+        bench_report("read timestamp column (per bar)", count, bench_now_ns() - start, count * 8);
+        ninja_free_array(timestamps);
+    } else {
+        printf("  decode or open failed\n");
+    }
+    printf("  %zu-byte response, %zu bytes as columns\n", length, (size_t)BENCH_CHART_BARS * column_count * 8);
+
+    remove(path);
+    ninja_chart_rows_free(&rows);
+    free(body);
+}
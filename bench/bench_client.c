@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_client.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_CLIENT_ROUNDS 2000
+#define BENCH_CLIENT_SESSIONS 1000
+#define BENCH_CLIENT_SWITCHES 200000
+
+// Helper function to time create + destroy of short-lived clients
+static uint64_t bench_client_churn(void) {
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_CLIENT_ROUNDS; i++) {
+        ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+        bench_sink += client != NULL;
+        ninja_client_destroy(client);
+    }
+    return bench_now_ns() - start;
+}
+
+// Helper function to time routing requests across many sessions: switching
+// the shared client's session vs rebuilding its Authorization header
+static void bench_client_sessions(void) {
+    ninja_session_manager_t* manager = ninja_session_manager_create(NULL);
+    if (!manager) {
+        printf("  session manager creation failed\n");
+        return;
+    }
+
+    static ninja_session_id_t sessions[BENCH_CLIENT_SESSIONS];
+    ninja_auth_response_t auth;
+    memset(&auth, 0, sizeof(auth));
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_CLIENT_SESSIONS; i++) {
+        snprintf(auth.access_token, sizeof(auth.access_token), "bench-token-%08d", i);
+        auth.user_id = i + 1;
+        if (ninja_session_add(manager, &auth, &sessions[i]) != NINJA_OK) {
+            printf("  session add failed\n");
+            ninja_session_manager_destroy(manager);
+            return;
+        }
+    }
+    bench_report("session add", BENCH_CLIENT_SESSIONS, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_CLIENT_SWITCHES; i++) {
+        ninja_client_t* client = ninja_session_client(manager, sessions[i % BENCH_CLIENT_SESSIONS]);
+        bench_sink += client->user_id;
+    }
+    bench_report("session switch (headers swapped)", BENCH_CLIENT_SWITCHES, bench_now_ns() - start, 0);
+
+    ninja_client_t* client = ninja_session_client(manager, sessions[0]);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_CLIENT_SWITCHES; i++) {
+        snprintf(client->access_token, sizeof(client->access_token), "bench-token-%08d", i % BENCH_CLIENT_SESSIONS);
+        bench_sink += ninja_set_auth_header(client);
+    }
+    bench_report("auth header rebuilt per request", BENCH_CLIENT_SWITCHES, bench_now_ns() - start, 0);
+
+    ninja_session_manager_destroy(manager);
+}
+
+void bench_client(void) {
+    // Without a held context, each client is the only reference and pays
+    // libcurl's global init and cleanup
+    bench_report("create + destroy, no library init", BENCH_CLIENT_ROUNDS, bench_client_churn(), 0);
+
+    if (ninja_library_init() != NINJA_OK) {
+        printf("  library init failed\n");
+        return;
+    }
+    bench_report("create + destroy, library init held", BENCH_CLIENT_ROUNDS, bench_client_churn(), 0);
+    bench_client_sessions();
+    ninja_library_cleanup();
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_COLUMNS_ORDERS 100000
+#define BENCH_COLUMNS_SYMBOLS 64
+#define BENCH_COLUMNS_ROUNDS 20
+#define BENCH_COLUMNS_FILLS_PER_ORDER 8
+
+// Helper function to time execution quality over fills laid out as given
+static void bench_columns_execution(const char* name,
+                                    const ninja_fill_t* fills,
+                                    size_t fill_count,
+                                    const ninja_arrival_t* arrivals,
+                                    size_t order_count) {
+    ninja_fill_columns_t columns;
+    ninja_execution_t* results = malloc(order_count * sizeof(ninja_execution_t));
+    if (!results || ninja_fills_to_columns(fills, fill_count, &columns) != NINJA_OK) {
+        printf("  allocation failed\n");
+        free(results);
+        return;
+    }
+
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        ninja_execution_quality(&columns, arrivals, order_count, results);
+        bench_sink += (int64_t)results[round].quantity;
+    }
+    bench_report(name, (uint64_t)BENCH_COLUMNS_ROUNDS * fill_count, bench_now_ns() - start, 0);
+
+    ninja_free_array(columns.storage);
+    free(results);
+}
+
+void bench_columns(void) {
+    ninja_order_t* orders = calloc(BENCH_COLUMNS_ORDERS, sizeof(ninja_order_t));
+    if (!orders) {
+        printf("  allocation failed\n");
+        return;
+    }
+
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < BENCH_COLUMNS_ORDERS; i++) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        ninja_order_t* order = &orders[i];
+        order->order_id = 3000000000LL + i;
+        order->account_id = 12345;
+        snprintf(order->symbol, sizeof(order->symbol), "SYM%dZ4", (int)(random % BENCH_COLUMNS_SYMBOLS));
+        order->side = (random >> 8) & 1 ? NINJA_SIDE_BUY : NINJA_SIDE_SELL;
+        order->status = NINJA_ORDER_FILLED;
+        order->quantity = 1 + (int)((random >> 16) % 10);
+        order->filled_quantity = order->quantity;
+        order->filled_price = 5000.0 + (double)((random >> 24) % 400) * 0.25;
+        order->timestamp_ns = 1717372800000000000LL + (int64_t)i * 1000000;
+    }
+
+    uint64_t start = bench_now_ns();
+    ninja_order_columns_t columns;
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        ninja_orders_to_columns(orders, BENCH_COLUMNS_ORDERS, &columns);
+        bench_sink += (int64_t)columns.symbol_count;
+        if (round + 1 < BENCH_COLUMNS_ROUNDS) {
+            ninja_free_array(columns.storage);
+        }
+    }
+    bench_report("orders to columns (per order)", (uint64_t)BENCH_COLUMNS_ROUNDS * BENCH_COLUMNS_ORDERS,
+                 bench_now_ns() - start, 0);
+
+    // Filled quantity by symbol: string compare over the records versus an
+    // integer group-by over two arrays
+    int64_t totals[BENCH_COLUMNS_SYMBOLS];
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        memset(totals, 0, sizeof(totals));
+        for (int i = 0; i < BENCH_COLUMNS_ORDERS; i++) {
+            size_t s = 0;
+            while (s < columns.symbol_count && strcmp(columns.symbols[s], orders[i].symbol) != 0) {
+                s++;
+            }
+            totals[s] += orders[i].filled_quantity;
+        }
+        bench_sink += totals[round % BENCH_COLUMNS_SYMBOLS];
+    }
+    bench_report("filled qty by symbol, records (per order)", (uint64_t)BENCH_COLUMNS_ROUNDS * BENCH_COLUMNS_ORDERS,
+                 bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        memset(totals, 0, sizeof(totals));
+        for (size_t i = 0; i < columns.count; i++) {
+            totals[columns.symbol[i]] += columns.filled_quantity[i];
+        }
+        bench_sink += totals[round % BENCH_COLUMNS_SYMBOLS];
+    }
+    bench_report("filled qty by symbol, columns (per order)", (uint64_t)BENCH_COLUMNS_ROUNDS * BENCH_COLUMNS_ORDERS,
+                 bench_now_ns() - start, 0);
+
+    // Notional: a straight multiply-add the compiler can vectorize
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        double notional = 0.0;
+        for (size_t i = 0; i < columns.count; i++) {
+            notional += columns.filled_price[i] * (double)columns.filled_quantity[i];
+        }
+        bench_sink += (int64_t)notional;
+    }
+    bench_report("notional, columns (per order)", (uint64_t)BENCH_COLUMNS_ROUNDS * BENCH_COLUMNS_ORDERS,
+                 bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_COLUMNS_ROUNDS; round++) {
+        double notional = 0.0;
+        for (int i = 0; i < BENCH_COLUMNS_ORDERS; i++) {
+            notional += orders[i].filled_price * (double)orders[i].filled_quantity;
+        }
+        bench_sink += (int64_t)notional;
+    }
+    bench_report("notional, records (per order)", (uint64_t)BENCH_COLUMNS_ROUNDS * BENCH_COLUMNS_ORDERS,
+                 bench_now_ns() - start, 0);
+    ninja_free_array(columns.storage);
+
+    const char* path = "bench_orders.col";
+    remove(path);
+    start = bench_now_ns();
+    ninja_export_orders(path, orders, BENCH_COLUMNS_ORDERS);
+    uint64_t elapsed = bench_now_ns() - start;
+    FILE* file = fopen(path, "rb");
+    long size = 0;
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fclose(file);
+    }
+    bench_report("export orders (per order)", BENCH_COLUMNS_ORDERS, elapsed, (uint64_t)size);
+    printf("  %.1f bytes per exported order, %zu per ninja_order_t\n", (double)size / BENCH_COLUMNS_ORDERS,
+           sizeof(ninja_order_t));
+
+    int32_t* quantities = NULL;
+    size_t count = 0;
+    start = bench_now_ns();
+    ninja_read_column_int32(path, "filled_quantity", &quantities, &count);
+    bench_report("read filled_quantity column (per order)", count > 0 ? count : 1, bench_now_ns() - start, 0);
+    ninja_free_array(quantities);
+    remove(path);
+
+    // Every order filled in pieces a few microseconds apart
+    size_t fill_count = (size_t)BENCH_COLUMNS_ORDERS * BENCH_COLUMNS_FILLS_PER_ORDER;
+    ninja_fill_t* fills = calloc(fill_count, sizeof(ninja_fill_t));
+    ninja_arrival_t* arrivals = calloc(BENCH_COLUMNS_ORDERS, sizeof(ninja_arrival_t));
+    if (!fills || !arrivals) {
+        printf("  allocation failed\n");
+        free(fills);
+        free(arrivals);
+        free(orders);
+        return;
+    }
+    for (int i = 0; i < BENCH_COLUMNS_ORDERS; i++) {
+        arrivals[i].order_id = orders[i].order_id;
+        arrivals[i].side = orders[i].side;
+        arrivals[i].arrival_price = orders[i].filled_price;
+        arrivals[i].arrival_ns = orders[i].timestamp_ns;
+        for (int k = 0; k < BENCH_COLUMNS_FILLS_PER_ORDER; k++) {
+            ninja_fill_t* fill = &fills[(size_t)i * BENCH_COLUMNS_FILLS_PER_ORDER + k];
+            fill->fill_id = (int64_t)i * BENCH_COLUMNS_FILLS_PER_ORDER + k;
+            fill->order_id = orders[i].order_id;
+            fill->side = orders[i].side;
+            fill->quantity = 1 + k % 3;
+            fill->price = orders[i].filled_price + (double)(k % 4) * 0.25;
+            fill->timestamp_ns = orders[i].timestamp_ns + 5000 * (k + 1);
+            fill->active = true;
+        }
+    }
+    bench_columns_execution("execution quality, grouped (per fill)", fills, fill_count, arrivals, BENCH_COLUMNS_ORDERS);
+
+    // Interleaved as fill/list returns them when many orders work at once
+    for (size_t i = fill_count - 1; i > 0; i--) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        size_t j = (size_t)(random % (i + 1));
+        ninja_fill_t swap = fills[i];
+        fills[i] = fills[j];
+        fills[j] = swap;
+    }
+    bench_columns_execution("execution quality, interleaved (per fill)", fills, fill_count, arrivals,
+                            BENCH_COLUMNS_ORDERS);
+
+    free(fills);
+    free(arrivals);
+    free(orders);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Monotonic clock in nanoseconds
+uint64_t bench_now_ns(void);
+
+// Print one result line: ns/op, ops/sec and (if bytes > 0) MB/sec
+void bench_report(const char* name, uint64_t ops, uint64_t elapsed_ns, uint64_t bytes);
+
+// Same, plus allocator calls per op when they are counted
+void bench_report_allocations(const char* name, uint64_t ops, uint64_t elapsed_ns, uint64_t bytes,
+                              uint64_t allocations);
+
+// Allocator calls so far; false when this build does not count them
+bool bench_allocations(uint64_t* count);
+
+// Results are folded into this so the compiler can't discard benchmarked work
+extern volatile int64_t bench_sink;
+
+// Benchmark suites
+void bench_timestamp(void);
+void bench_enums(void);
+void bench_catalog(void);
+void bench_journal(void);
+void bench_shm(void);
+void bench_io(void);
+void bench_delta(void);
+void bench_compression(void);
+void bench_pipeline(void);
+void bench_template(void);
+void bench_client(void);
+void bench_chart(void);
+void bench_bars(void);
+void bench_columns(void);
+void bench_json(void);
+void bench_trace(void);
+void bench_debug(void);
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BENCH_HAVE_ZLIB
+#include <zlib.h>
+
+// libcurl hands the decoder network-sized reads and the decoder feeds
+// write_callback in chunks of this size
+#define BENCH_COMPRESSION_CHUNK 16384
+
+// Helper function to build an order/list body like the ones we poll
+static char* bench_order_list_body(int orders, size_t* length) {
+    size_t capacity = (size_t)orders * 320 + 2;
+    char* body = malloc(capacity);
+    if (!body) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    body[used++] = '[';
+    for (int i = 0; i < orders; i++) {
+        used += (size_t)snprintf(body + used, capacity - used,
+                                 "%s{\"id\":%d,\"accountId\":%d,\"contractId\":%d,\"timestamp\":\"2024-06-03T14:%02d:%02d.%03dZ\","
+                                 "\"action\":\"%s\",\"ordStatus\":\"%s\",\"orderType\":\"Limit\",\"qty\":%d,"
+                                 "\"price\":%d.%02d,\"filledQty\":0,\"isAutomated\":false}",
+                                 i > 0 ? "," : "", 4000000 + i, 12345 + i % 3, 2100000 + i % 40,
+                                 i / 60 % 60, i % 60, (i * 37) % 1000,
+                                 i % 2 ? "Sell" : "Buy", i % 5 ? "Working" : "Filled", 1 + i % 10,
+                                 4000 + i % 200, (i * 25) % 100);
+    }
+    body[used++] = ']';
+    body[used] = '\0';
+
+    *length = used;
+    return body;
+}
+
+// Helper function to inflate chunk by chunk into a growing buffer, as
+// write_callback receives it
+static size_t bench_inflate(const unsigned char* compressed, size_t compressed_length, char** out, size_t* capacity) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, 15 + 16) != Z_OK) {
+        return 0;
+    }
+
+    unsigned char chunk[BENCH_COMPRESSION_CHUNK];
+    size_t size = 0;
+    stream.next_in = (unsigned char*)compressed;
+    stream.avail_in = (uInt)compressed_length;
+
+    int status = Z_OK;
+    while (status == Z_OK) {
+        stream.next_out = chunk;
+        stream.avail_out = sizeof(chunk);
+        status = inflate(&stream, Z_NO_FLUSH);
+        size_t produced = sizeof(chunk) - stream.avail_out;
+
+        if (size + produced + 1 > *capacity) {
+            size_t grown = *capacity < 4096 ? 4096 : *capacity;
+            while (grown < size + produced + 1) {
+                grown *= 2;
+            }
+            char* data = realloc(*out, grown);
+            if (!data) {
+                break;
+            }
+            *out = data;
+            *capacity = grown;
+        }
+        memcpy(*out + size, chunk, produced);
+        size += produced;
+    }
+    inflateEnd(&stream);
+
+    return size;
+}
+
+// Helper function to gzip a body the way a server would
+static size_t bench_gzip(const char* body, size_t length, unsigned char* out, size_t out_capacity) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (deflateInit2(&stream, 6, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return 0;
+    }
+
+    stream.next_in = (unsigned char*)body;
+    stream.avail_in = (uInt)length;
+    stream.next_out = out;
+    stream.avail_out = (uInt)out_capacity;
+    int status = deflate(&stream, Z_FINISH);
+    size_t compressed = status == Z_STREAM_END ? out_capacity - stream.avail_out : 0;
+    deflateEnd(&stream);
+
+    return compressed;
+}
+
+void bench_compression(void) {
+    static const int sizes[] = { 100, 1000, 10000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t length = 0;
+        char* body = bench_order_list_body(sizes[s], &length);
+        size_t compressed_capacity = compressBound((uLong)length) + 64;
+        unsigned char* compressed = malloc(compressed_capacity);
+        if (!body || !compressed) {
+            printf("  allocation failed\n");
+            free(body);
+            free(compressed);
+            return;
+        }
+
+        size_t compressed_length = bench_gzip(body, length, compressed, compressed_capacity);
+        if (compressed_length == 0) {
+            printf("  gzip failed\n");
+            free(body);
+            free(compressed);
+            return;
+        }
+
+        char name[64];
+        snprintf(name, sizeof(name), "gzip %d orders: %zu -> %zu bytes", sizes[s], length, compressed_length);
+        printf("  %s (%.1fx)\n", name, (double)length / (double)compressed_length);
+
+        // Decode cost per response; MB/s is decoded output
+        int rounds = 2000000 / sizes[s];
+        char* out = NULL;
+        size_t capacity = 0;
+        uint64_t start = bench_now_ns();
+        for (int i = 0; i < rounds; i++) {
+            bench_sink += (int64_t)bench_inflate(compressed, compressed_length, &out, &capacity);
+        }
+        snprintf(name, sizeof(name), "inflate %d orders (chunked)", sizes[s]);
+        bench_report(name, (uint64_t)rounds, bench_now_ns() - start, (uint64_t)rounds * length);
+
+        // Baseline: the same body arriving uncompressed is a plain copy
+        start = bench_now_ns();
+        for (int i = 0; i < rounds; i++) {
+            if (capacity < length + 1) {
+                break;
+            }
+            memcpy(out, body, length);
+            bench_sink += out[length / 2];
+        }
+        snprintf(name, sizeof(name), "copy %d orders (identity)", sizes[s]);
+        bench_report(name, (uint64_t)rounds, bench_now_ns() - start, (uint64_t)rounds * length);
+
+        free(out);
+        free(compressed);
+        free(body);
+    }
+}
+
+#else
+
+void bench_compression(void) {
+    printf("  zlib not found; skipped\n");
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_client.h"
+#include "bench_common.h"
+#include <stdio.h>
+
+#define BENCH_DEBUG_PATH "ninja_bench_debug.log"
+#define BENCH_DEBUG_RECORDS 200000
+#define BENCH_DEBUG_URL "https://demo.tradovateapi.com/v1/order/placeorder"
+
+// Helper function to time what a request thread pays per record when it
+// formats and writes the line itself
+static void bench_debug_direct(void) {
+    FILE* file = fopen(BENCH_DEBUG_PATH, "w");
+    if (!file) {
+        printf("  could not open %s\n", BENCH_DEBUG_PATH);
+        return;
+    }
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_DEBUG_RECORDS; i++) {
+        char timestamp[32];
+        ninja_format_timestamp(ninja_wall_clock_ns(), timestamp, sizeof(timestamp));
+        fprintf(file, "%s POST %s -> %d in %.3f ms, %d bytes\n", timestamp, BENCH_DEBUG_URL, 200, 1.25, 512);
+        fflush(file);
+    }
+    bench_report("fprintf + fflush on the caller", BENCH_DEBUG_RECORDS, bench_now_ns() - start, 0);
+    fclose(file);
+}
+
+// Helper function to time the same records through the background log: the
+// caller's cost is the push, the drain is the log thread's
+static void bench_debug_async(void) {
+    ninja_log_t* log = NULL;
+    if (ninja_log_start(&log, BENCH_DEBUG_PATH, BENCH_DEBUG_RECORDS) != NINJA_OK) {
+        printf("  could not start the debug log\n");
+        return;
+    }
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_DEBUG_RECORDS; i++) {
+        ninja_log_http(log, NINJA_LOG_RESPONSE, 'P', BENCH_DEBUG_URL, 200, 512, 1250000, 1);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_report("record push (caller)", BENCH_DEBUG_RECORDS, elapsed, 0);
+
+    start = bench_now_ns();
+    ninja_log_stop(log);
+    bench_report("formatted by the log thread", BENCH_DEBUG_RECORDS, bench_now_ns() - start, 0);
+}
+
+void bench_debug(void) {
+    bench_debug_direct();
+    bench_debug_async();
+    remove(BENCH_DEBUG_PATH);
+}
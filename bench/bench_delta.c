@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_delta.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DELTA_ORDERS 10000
+#define BENCH_DELTA_CHANGED 10
+
+void bench_delta(void) {
+    // An order/list body of BENCH_DELTA_ORDERS working orders
+    size_t capacity = (size_t)BENCH_DELTA_ORDERS * 256 + 2;
+    char* body = malloc(capacity);
+    if (!body) {
+        printf("  allocation failed\n");
+        return;
+    }
+    size_t length = 0;
+    body[length++] = '[';
+    for (int i = 0; i < BENCH_DELTA_ORDERS; i++) {
+        length += (size_t)snprintf(body + length, capacity - length,
+                                   "%s{\"id\":%d,\"accountId\":12345,\"action\":\"Buy\",\"ordStatus\":\"Working\","
+                                   "\"orderType\":\"Limit\",\"qty\":1,\"price\":%d.25,"
+                                   "\"timestamp\":\"2024-06-03T14:30:15.123Z\"}",
+                                   i > 0 ? "," : "", 1000000 + i, 4000 + i % 100);
+    }
+    body[length++] = ']';
+    body[length] = '\0';
+
+    // What an unchanged poll costs once the body is in: one hash
+    int rounds = 200;
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < rounds; i++) {
+        bench_sink += (int64_t)ninja_hash_bytes(body, length);
+    }
+    bench_report("hash 10k-order body", rounds, bench_now_ns() - start, (uint64_t)rounds * length);
+
+    // What it costs without the cache
+    ninja_order_t* previous = NULL;
+    size_t count = 0;
+    int parses = 10;
+    start = bench_now_ns();
+    for (int i = 0; i < parses; i++) {
+        ninja_free_array(previous);
+        ninja_parse_orders(body, length, &previous, &count);
+    }
+    bench_report("parse 10k-order body", parses, bench_now_ns() - start, (uint64_t)parses * length);
+
+    ninja_order_t* current = malloc(count * sizeof(ninja_order_t) + 1);
+    if (!previous || !current) {
+        printf("  decode failed\n");
+        ninja_free_array(previous);
+        free(current);
+        free(body);
+        return;
+    }
+    memcpy(current, previous, count * sizeof(ninja_order_t));
+    for (size_t i = 0; i < BENCH_DELTA_CHANGED && i < count; i++) {
+        current[i * (count / BENCH_DELTA_CHANGED)].status = NINJA_ORDER_FILLED;
+    }
+
+    int diffs = 20;
+    start = bench_now_ns();
+    for (int i = 0; i < diffs; i++) {
+        ninja_order_delta_t delta;
+        if (ninja_diff_orders(previous, count, current, count, &delta) == NINJA_OK) {
+            bench_sink += (int64_t)delta.changed;
+        }
+        ninja_free_array(delta.records);
+    }
+    bench_report("diff 10k orders, 10 changed", diffs, bench_now_ns() - start, 0);
+
+    ninja_free_array(previous);
+    free(current);
+    free(body);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_ENUM_ORDERS 100000
+#define BENCH_ENUM_ROUNDS 20
+
+// Reference decoder: the strcmp chain previously used by ninja_parse_order
+static ninja_order_status_t bench_strcmp_status(const char* status_str) {
+    if (strcmp(status_str, "Working") == 0) return NINJA_ORDER_WORKING;
+    if (strcmp(status_str, "Filled") == 0) return NINJA_ORDER_FILLED;
+    if (strcmp(status_str, "Canceled") == 0) return NINJA_ORDER_CANCELLED;
+    if (strcmp(status_str, "Cancelled") == 0) return NINJA_ORDER_CANCELLED;
+    if (strcmp(status_str, "Rejected") == 0) return NINJA_ORDER_REJECTED;
+    if (strcmp(status_str, "PartiallyFilled") == 0) return NINJA_ORDER_PARTIALLY_FILLED;
+    if (strcmp(status_str, "Suspended") == 0) return NINJA_ORDER_SUSPENDED;
+    if (strcmp(status_str, "Expired") == 0) return NINJA_ORDER_EXPIRED;
+    if (strcmp(status_str, "Completed") == 0) return NINJA_ORDER_COMPLETED;
+    if (strcmp(status_str, "PendingCancel") == 0) return NINJA_ORDER_PENDING_CANCEL;
+    if (strcmp(status_str, "PendingReplace") == 0) return NINJA_ORDER_PENDING_REPLACE;
+    if (strcmp(status_str, "PendingNew") == 0) return NINJA_ORDER_PENDING;
+    return NINJA_ORDER_STATUS_UNKNOWN;
+}
+
+static ninja_order_type_t bench_strcmp_type(const char* type_str) {
+    if (strcmp(type_str, "Market") == 0) return NINJA_ORDER_MARKET;
+    if (strcmp(type_str, "Limit") == 0) return NINJA_ORDER_LIMIT;
+    if (strcmp(type_str, "Stop") == 0) return NINJA_ORDER_STOP;
+    if (strcmp(type_str, "StopLimit") == 0) return NINJA_ORDER_STOP_LIMIT;
+    if (strcmp(type_str, "MIT") == 0) return NINJA_ORDER_MIT;
+    if (strcmp(type_str, "TrailingStop") == 0) return NINJA_ORDER_TRAILING_STOP;
+    if (strcmp(type_str, "TrailingStopLimit") == 0) return NINJA_ORDER_TRAILING_STOP_LIMIT;
+    if (strcmp(type_str, "QTS") == 0) return NINJA_ORDER_QTS;
+    return NINJA_ORDER_TYPE_UNKNOWN;
+}
+
+void bench_enums(void) {
+    // An end-of-day order list is dominated by terminal statuses
+    static const char* statuses[] = {
+        "Filled", "Filled", "Filled", "Canceled", "Canceled", "Working",
+        "Rejected", "Expired", "PartiallyFilled", "PendingCancel"
+    };
+    static const char* types[] = { "Limit", "Limit", "Market", "Stop", "StopLimit", "TrailingStop" };
+
+    const char** status_list = malloc(BENCH_ENUM_ORDERS * sizeof(char*));
+    const char** type_list = malloc(BENCH_ENUM_ORDERS * sizeof(char*));
+    size_t* status_len = malloc(BENCH_ENUM_ORDERS * sizeof(size_t));
+    size_t* type_len = malloc(BENCH_ENUM_ORDERS * sizeof(size_t));
+    if (!status_list || !type_list || !status_len || !type_len) {
+        printf("  allocation failed\n");
+        free(status_list); free(type_list); free(status_len); free(type_len);
+        return;
+    }
+
+    srand(7);
+    for (size_t i = 0; i < BENCH_ENUM_ORDERS; i++) {
+        status_list[i] = statuses[rand() % (int)(sizeof(statuses) / sizeof(statuses[0]))];
+        type_list[i] = types[rand() % (int)(sizeof(types) / sizeof(types[0]))];
+        status_len[i] = strlen(status_list[i]);
+        type_len[i] = strlen(type_list[i]);
+    }
+
+    uint64_t ops = (uint64_t)BENCH_ENUM_ORDERS * BENCH_ENUM_ROUNDS;
+    int64_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < BENCH_ENUM_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_ENUM_ORDERS; i++) {
+            sum += ninja_order_status_from_string(status_list[i], status_len[i]);
+            sum += ninja_order_type_from_string(type_list[i], type_len[i]);
+        }
+    }
+    bench_report("switch decoder (status + type)", ops, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_ENUM_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_ENUM_ORDERS; i++) {
+            sum += bench_strcmp_status(status_list[i]);
+            sum += bench_strcmp_type(type_list[i]);
+        }
+    }
+    bench_report("strcmp chain (status + type)", ops, bench_now_ns() - start, 0);
+
+    bench_sink += sum;
+
+    free(status_list);
+    free(type_list);
+    free(status_len);
+    free(type_len);
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include "ninja_atomic.h"
+#include "ninja_ring.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_IO_ROUNDS 1000000
+#define BENCH_IO_QUEUE 65536
+
+static volatile uint64_t bench_io_completed = 0;
+
+static void bench_io_completion(const ninja_completion_t* completion, void* user_data) {
+    (void)completion;
+    (void)user_data;
+    ninja_atomic_fetch_add(&bench_io_completed, 1);
+}
+
+void bench_io(void) {
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.symbol, "ESZ6");
+    request.quantity = 1;
+
+    // Ring alone, one thread: the floor under a submission
+    ninja_ring_t ring;
+    if (ninja_ring_init(&ring, 1024, sizeof(request)) != NINJA_OK) {
+        printf("  ring allocation failed\n");
+        return;
+    }
+    ninja_order_request_t out;
+    uint64_t position = 0;
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_IO_ROUNDS; i++) {
+        ninja_ring_push(&ring, &request, &position);
+        ninja_ring_pop(&ring, &out);
+    }
+    bench_sink += out.quantity;
+    bench_report("ring push + pop", BENCH_IO_ROUNDS, bench_now_ns() - start, 0);
+    ninja_ring_free(&ring);
+
+    // Invalid requests complete on the I/O thread without touching the network,
+    // so this measures the handoff and the thread's turnaround
+    request.quantity = 0;
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.io_thread = true;
+    options.io_queue_capacity = BENCH_IO_QUEUE;
+    options.completion_callback = bench_io_completion;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    if (!client) {
+        printf("  I/O thread unavailable\n");
+        return;
+    }
+
+    // clOrdIds are what the caller gets back at submission
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE];
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_IO_ROUNDS; i++) {
+        ninja_next_client_order_id(client, client_order_id, sizeof(client_order_id));
+        bench_sink += client_order_id[sizeof(client_order_id) / 2];
+    }
+    bench_report("next client order id", BENCH_IO_ROUNDS, bench_now_ns() - start, 0);
+
+    uint64_t submitted = 0;
+    uint64_t full = 0;
+    uint64_t submit_ns = 0;
+    start = bench_now_ns();
+    while (submitted < BENCH_IO_ROUNDS) {
+        uint64_t before = bench_now_ns();
+        ninja_error_t result = ninja_submit_order(client, &request, NULL);
+        submit_ns += bench_now_ns() - before;
+        if (result == NINJA_OK) {
+            submitted++;
+        } else {
+            full++;
+        }
+    }
+    while (ninja_atomic_load_acquire(&bench_io_completed) < submitted) {
+        ninja_cpu_relax();
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_report("submit order (caller side)", submitted + full, submit_ns, 0);
+    bench_report("submit to completion (throughput)", submitted, elapsed, 0);
+    printf("  %-40s %12llu\n", "submissions refused (queue full)", (unsigned long long)full);
+
+    // One request at a time: handoff latency with an otherwise idle thread
+    int pings = 1000;
+    uint64_t latency_ns = 0;
+    for (int i = 0; i < pings; i++) {
+        uint64_t target = ninja_atomic_load_acquire(&bench_io_completed) + 1;
+        uint64_t before = bench_now_ns();
+        ninja_submit_order(client, &request, NULL);
+        while (ninja_atomic_load_acquire(&bench_io_completed) < target) {
+            ninja_cpu_relax();
+        }
+        latency_ns += bench_now_ns() - before;
+    }
+    bench_report("round trip, one request in flight", pings, latency_ns, 0);
+
+    ninja_client_destroy(client);
+}
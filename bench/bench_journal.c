@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_journal.h"
+#include "bench_common.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_JOURNAL_PATH "ninja_bench_journal.bin"
+#define BENCH_JOURNAL_CAPACITY 65536
+
+// Helper function to time intent + ack pairs under one flush policy
+static void bench_journal_mode(const char* name, ninja_journal_flush_t flush, uint64_t orders) {
+    remove(BENCH_JOURNAL_PATH);
+
+    ninja_journal_t journal;
+    if (ninja_journal_open(&journal, BENCH_JOURNAL_PATH, BENCH_JOURNAL_CAPACITY, flush, 64) != NINJA_OK) {
+        printf("  %s: journal open failed\n", name);
+        return;
+    }
+
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.account_spec, "DEMO123456");
+    strcpy(request.symbol, "ESZ4");
+    request.account_id = 12345;
+    request.side = NINJA_SIDE_BUY;
+    request.type = NINJA_ORDER_LIMIT;
+    request.quantity = 1;
+    request.price = 4200.25;
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < orders; i++) {
+        uint64_t sequence = ninja_journal_log_request(&journal, NINJA_JOURNAL_PLACE, &request, 0);
+        ninja_journal_log_completion(&journal, NINJA_JOURNAL_ACK, sequence, (ninja_order_id_t)(i + 1));
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    bench_sink += (int64_t)journal.head;
+    bench_report(name, orders, elapsed, orders * 2 * sizeof(ninja_journal_record_t));
+
+    ninja_journal_close(&journal);
+    remove(BENCH_JOURNAL_PATH);
+}
+
+void bench_journal(void) {
+    // Twice the capacity in records, so compaction is included
+    bench_journal_mode("intent+ack, no flush", NINJA_JOURNAL_FLUSH_NONE, BENCH_JOURNAL_CAPACITY);
+    bench_journal_mode("intent+ack, async group commit (64)", NINJA_JOURNAL_FLUSH_ASYNC, BENCH_JOURNAL_CAPACITY);
+    bench_journal_mode("intent+ack, sync", NINJA_JOURNAL_FLUSH_SYNC, 200);
+}
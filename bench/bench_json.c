@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_client.h"
+#include "bench_common.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BENCH_CORPUS_DIR
+    #define BENCH_CORPUS_DIR "corpus"
+#endif
+
+// Records decoded per list size, so every size gets comparable run time
+#define BENCH_JSON_RECORDS 200000
+
+typedef ninja_error_t (*bench_decode_fn)(const char* json, size_t length, void** records, size_t* count);
+typedef ninja_error_t (*bench_decode_one_fn)(cJSON* json, void* record);
+
+// Helper functions to give every list decoder one signature
+static ninja_error_t bench_decode_orders(const char* json, size_t length, void** records, size_t* count) {
+    ninja_order_t* orders = NULL;
+    ninja_error_t result = ninja_parse_orders(json, length, &orders, count);
+    *records = orders;
+    return result;
+}
+
+static ninja_error_t bench_decode_positions(const char* json, size_t length, void** records, size_t* count) {
+    ninja_position_t* positions = NULL;
+    ninja_error_t result = ninja_parse_positions(json, length, &positions, count);
+    *records = positions;
+    return result;
+}
+
+static ninja_error_t bench_decode_accounts(const char* json, size_t length, void** records, size_t* count) {
+    ninja_account_t* accounts = NULL;
+    ninja_error_t result = ninja_parse_accounts(json, length, &accounts, count);
+    *records = accounts;
+    return result;
+}
+
+static ninja_error_t bench_decode_contracts(const char* json, size_t length, void** records, size_t* count) {
+    ninja_contract_t* contracts = NULL;
+    ninja_error_t result = ninja_parse_contracts(json, length, &contracts, count);
+    *records = contracts;
+    return result;
+}
+
+static ninja_error_t bench_decode_fills(const char* json, size_t length, void** records, size_t* count) {
+    ninja_fill_t* fills = NULL;
+    ninja_error_t result = ninja_parse_fills(json, length, &fills, count);
+    *records = fills;
+    return result;
+}
+
+// Helper functions to give every single-record decoder one signature
+static ninja_error_t bench_decode_order(cJSON* json, void* record) {
+    return ninja_parse_order(json, (ninja_order_t*)record);
+}
+
+static ninja_error_t bench_decode_position(cJSON* json, void* record) {
+    return ninja_parse_position(json, (ninja_position_t*)record);
+}
+
+static ninja_error_t bench_decode_account(cJSON* json, void* record) {
+    return ninja_parse_account(json, (ninja_account_t*)record);
+}
+
+static ninja_error_t bench_decode_contract(cJSON* json, void* record) {
+    return ninja_parse_contract(json, (ninja_contract_t*)record);
+}
+
+// Helper function to read a corpus file into a string
+static char* bench_json_read(const char* file_name, size_t* length) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", BENCH_CORPUS_DIR, file_name);
+    *length = 0;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* text = malloc(size > 0 ? (size_t)size + 1 : 1);
+    size_t read = text && size > 0 ? fread(text, 1, (size_t)size, file) : 0;
+    fclose(file);
+    if (!text) {
+        return NULL;
+    }
+    text[read] = '\0';
+
+    *length = read;
+    return text;
+}
+
+// Helper function to read a corpus file and split its array into one
+// compact JSON text per record
+static char** bench_json_load(const char* file_name, size_t* record_count) {
+    size_t length = 0;
+    char* text = bench_json_read(file_name, &length);
+    *record_count = 0;
+    if (!text) {
+        return NULL;
+    }
+
+    cJSON* array = cJSON_Parse(text);
+    free(text);
+    int count = cJSON_GetArraySize(array);
+    char** records = count > 0 ? calloc((size_t)count, sizeof(char*)) : NULL;
+    if (!records) {
+        cJSON_Delete(array);
+        return NULL;
+    }
+    for (int i = 0; i < count; i++) {
+        records[i] = cJSON_PrintUnformatted(cJSON_GetArrayItem(array, i));
+    }
+    cJSON_Delete(array);
+
+    *record_count = (size_t)count;
+    return records;
+}
+
+// Helper function to build a list body of size records, cycling through the corpus
+static char* bench_json_list(char** records, size_t record_count, size_t size, size_t* length) {
+    size_t capacity = 3;
+    for (size_t i = 0; i < size; i++) {
+        capacity += strlen(records[i % record_count]) + 1;
+    }
+    char* body = malloc(capacity);
+    if (!body) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    body[used++] = '[';
+    for (size_t i = 0; i < size; i++) {
+        if (i > 0) {
+            body[used++] = ',';
+        }
+        size_t record_length = strlen(records[i % record_count]);
+        memcpy(body + used, records[i % record_count], record_length);
+        used += record_length;
+    }
+    body[used++] = ']';
+    body[used] = '\0';
+
+    *length = used;
+    return body;
+}
+
+// Helper function to time one decoder over the corpus at each list size
+static void bench_json_decoder(const char* name, const char* file_name, bench_decode_fn decode) {
+    static const size_t sizes[] = { 1, 100, 10000, 100000 };
+
+    size_t record_count = 0;
+    char** records = bench_json_load(file_name, &record_count);
+    if (!records) {
+        printf("  %s: corpus %s not found in %s\n", name, file_name, BENCH_CORPUS_DIR);
+        return;
+    }
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t length = 0;
+        char* body = bench_json_list(records, record_count, sizes[s], &length);
+        if (!body) {
+            printf("  allocation failed\n");
+            break;
+        }
+
+        size_t rounds = BENCH_JSON_RECORDS / sizes[s];
+        uint64_t decoded = 0;
+        uint64_t allocations_before = 0;
+        uint64_t allocations_after = 0;
+        bench_allocations(&allocations_before);
+        uint64_t start = bench_now_ns();
+        for (size_t round = 0; round < rounds; round++) {
+            void* list = NULL;
+            size_t count = 0;
+            if (decode(body, length, &list, &count) == NINJA_OK) {
+                decoded += count;
+            }
+            ninja_free_array(list);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_allocations(&allocations_after);
+
+        char label[64];
+        snprintf(label, sizeof(label), "%s x%zu (per record)", name, sizes[s]);
+        bench_report_allocations(label, decoded, elapsed, (uint64_t)rounds * length,
+                                 allocations_after - allocations_before);
+        free(body);
+    }
+
+    for (size_t i = 0; i < record_count; i++) {
+        free(records[i]);
+    }
+    free(records);
+}
+
+// Helper function to time a single-object response the way the client
+// decodes one: parse the text, decode the record, free the tree
+static void bench_json_record(const char* name, const char* file_name, bench_decode_one_fn decode, size_t record_size) {
+    size_t length = 0;
+    char* body = bench_json_read(file_name, &length);
+    void* record = malloc(record_size);
+    if (!body || !record) {
+        printf("  %s: corpus %s not found in %s\n", name, file_name, BENCH_CORPUS_DIR);
+        free(body);
+        free(record);
+        return;
+    }
+
+    uint64_t decoded = 0;
+    uint64_t allocations_before = 0;
+    uint64_t allocations_after = 0;
+    bench_allocations(&allocations_before);
+    uint64_t start = bench_now_ns();
+    for (size_t round = 0; round < BENCH_JSON_RECORDS; round++) {
+        cJSON* json = cJSON_ParseWithLength(body, length);
+        if (decode(json, record) == NINJA_OK) {
+            decoded++;
+        }
+        cJSON_Delete(json);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_allocations(&allocations_after);
+
+    bench_report_allocations(name, decoded, elapsed, (uint64_t)BENCH_JSON_RECORDS * length,
+                             allocations_after - allocations_before);
+    free(body);
+    free(record);
+}
+
+void bench_json(void) {
+    bench_json_record("order (single)", "order.json", bench_decode_order, sizeof(ninja_order_t));
+    bench_json_record("position (single)", "position.json", bench_decode_position, sizeof(ninja_position_t));
+    bench_json_record("account (single)", "account.json", bench_decode_account, sizeof(ninja_account_t));
+    bench_json_record("contract (single)", "contract.json", bench_decode_contract, sizeof(ninja_contract_t));
+    bench_json_decoder("orders", "orders.json", bench_decode_orders);
+    bench_json_decoder("positions", "positions.json", bench_decode_positions);
+    bench_json_decoder("accounts", "accounts.json", bench_decode_accounts);
+    bench_json_decoder("contracts", "contracts.json", bench_decode_contracts);
+    bench_json_decoder("fills", "fills.json", bench_decode_fills);
+}
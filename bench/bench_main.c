@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench_common.h"
+#include "ninja_atomic.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+volatile int64_t bench_sink = 0;
+
+static volatile uint64_t bench_allocation_count = 0;
+
+#ifdef BENCH_COUNT_ALLOCATIONS
+// Linked with --wrap, so every malloc, calloc and realloc call from the
+// library, cJSON and the benchmarks comes through here
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* pointer, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    ninja_atomic_fetch_add(&bench_allocation_count, 1);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    ninja_atomic_fetch_add(&bench_allocation_count, 1);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+    ninja_atomic_fetch_add(&bench_allocation_count, 1);
+    return __real_realloc(pointer, size);
+}
+#endif
+
+bool bench_allocations(uint64_t* count) {
+    *count = ninja_atomic_load_relaxed(&bench_allocation_count);
+#ifdef BENCH_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t bench_now_ns(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+// Helper function to print a result line without ending it
+static void bench_print(const char* name, uint64_t ops, uint64_t elapsed_ns, uint64_t bytes) {
+    double ns_per_op = ops ? (double)elapsed_ns / (double)ops : 0.0;
+    double ops_per_sec = elapsed_ns ? (double)ops * 1e9 / (double)elapsed_ns : 0.0;
+
+    printf("  %-40s %12.1f ns/op %14.0f ops/s", name, ns_per_op, ops_per_sec);
+    if (bytes > 0 && elapsed_ns > 0) {
+        printf(" %10.1f MB/s", (double)bytes * 1e3 / (double)elapsed_ns);
+    }
+}
+
+void bench_report(const char* name, uint64_t ops, uint64_t elapsed_ns, uint64_t bytes) {
+    bench_print(name, ops, elapsed_ns, bytes);
+    printf("\n");
+}
+
+void bench_report_allocations(const char* name, uint64_t ops, uint64_t elapsed_ns, uint64_t bytes,
+                              uint64_t allocations) {
+    uint64_t counted;
+    bench_print(name, ops, elapsed_ns, bytes);
+    if (bench_allocations(&counted)) {
+        printf(" %8.2f allocs/op", ops ? (double)allocations / (double)ops : 0.0);
+    }
+    printf("\n");
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+} bench_suite_t;
+
+static const bench_suite_t bench_suites[] = {
+    { "timestamp", bench_timestamp },
+    { "enums", bench_enums },
+    { "catalog", bench_catalog },
+    { "journal", bench_journal },
+    { "shm", bench_shm },
+    { "io", bench_io },
+    { "delta", bench_delta },
+    { "compression", bench_compression },
+    { "pipeline", bench_pipeline },
+    { "template", bench_template },
+    { "client", bench_client },
+    { "chart", bench_chart },
+    { "bars", bench_bars },
+    { "columns", bench_columns },
+    { "json", bench_json },
+    { "trace", bench_trace },
+    { "debug", bench_debug },
+};
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : NULL;
+
+    printf("NinjaTrader API Benchmarks\n");
+    printf("==========================\n");
+
+    for (size_t i = 0; i < sizeof(bench_suites) / sizeof(bench_suites[0]); i++) {
+        if (filter && strstr(bench_suites[i].name, filter) == NULL) {
+            continue;
+        }
+        printf("\n[%s]\n", bench_suites[i].name);
+        bench_suites[i].run();
+    }
+
+    return 0;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#define BENCH_PIPELINE_CANCELS 64
+#define BENCH_PIPELINE_ROUNDS 5
+
+// Simulated broker processing time per request
+#define BENCH_PIPELINE_SERVER_US 2000
+
+// Hedging: every BENCH_HEDGE_TAIL_EVERY-th request is answered after
+// BENCH_HEDGE_TAIL_US instead, a 4% slow tail
+#define BENCH_HEDGE_GETS 400
+#define BENCH_HEDGE_TAIL_EVERY 25
+#define BENCH_HEDGE_TAIL_US 100000
+
+static volatile int bench_server_tail;
+static volatile int bench_server_requests;
+
+// Local stand-in for the REST endpoint: HTTP/1.1 keep-alive, one thread per
+// connection, a fixed JSON answer after a fixed delay
+typedef struct {
+    int listener;
+    volatile int stop;
+} bench_server_t;
+
+// Helper function to serve one keep-alive connection
+static void* bench_server_connection(void* arg) {
+    int fd = (int)(intptr_t)arg;
+    char buffer[8192];
+    size_t used = 0;
+
+    for (;;) {
+        ssize_t got = recv(fd, buffer + used, sizeof(buffer) - used - 1, 0);
+        if (got <= 0) {
+            break;
+        }
+        used += (size_t)got;
+        buffer[used] = '\0';
+
+        // Answer every complete request in the buffer
+        char* end;
+        while ((end = strstr(buffer, "\r\n\r\n")) != NULL) {
+            size_t header_length = (size_t)(end - buffer) + 4;
+            size_t body_length = 0;
+            char* length_field = strstr(buffer, "Content-Length:");
+            if (length_field && length_field < end) {
+                body_length = (size_t)strtoul(length_field + 15, NULL, 10);
+            }
+            if (used < header_length + body_length) {
+                break;
+            }
+
+            int sequence = __sync_fetch_and_add(&bench_server_requests, 1) + 1;
+            bool slow = bench_server_tail && sequence % BENCH_HEDGE_TAIL_EVERY == 0;
+            usleep(slow ? BENCH_HEDGE_TAIL_US : BENCH_PIPELINE_SERVER_US);
+
+            static const char reply[] =
+                "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 24\r\n\r\n"
+                "{\"commandId\":1234567890}";
+            if (send(fd, reply, sizeof(reply) - 1, MSG_NOSIGNAL) < 0) {
+                used = 0;
+                break;
+            }
+
+            memmove(buffer, buffer + header_length + body_length, used - header_length - body_length);
+            used -= header_length + body_length;
+            buffer[used] = '\0';
+        }
+    }
+
+    close(fd);
+    return NULL;
+}
+
+// Helper function to accept connections until stopped
+static void* bench_server_accept(void* arg) {
+    bench_server_t* server = (bench_server_t*)arg;
+    while (!server->stop) {
+        int fd = accept(server->listener, NULL, NULL);
+        if (fd < 0) {
+            break;
+        }
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, bench_server_connection, (void*)(intptr_t)fd) == 0) {
+            pthread_detach(thread);
+        } else {
+            close(fd);
+        }
+    }
+    return NULL;
+}
+
+// Helper function to order latencies for percentiles
+static int bench_latency_compare(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+// Helper function to time GETs against the slow-tailed stand-in
+static void bench_hedge(const char* base_url, bool hedge_gets) {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    options.hedge_gets = hedge_gets;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    if (!client) {
+        printf("  client creation failed\n");
+        return;
+    }
+
+    // The hedge delay needs a window of latencies before it takes effect
+    static uint64_t latency_ns[BENCH_HEDGE_GETS];
+    ninja_account_t account;
+    for (int i = 0; i < 64; i++) {
+        ninja_get_account_by_id(client, 1, &account);
+    }
+
+    for (int i = 0; i < BENCH_HEDGE_GETS; i++) {
+        uint64_t start = bench_now_ns();
+        ninja_get_account_by_id(client, 1, &account);
+        latency_ns[i] = bench_now_ns() - start;
+    }
+    qsort(latency_ns, BENCH_HEDGE_GETS, sizeof(uint64_t), bench_latency_compare);
+
+    printf("  %-44s p50 %8.2f ms   p99 %8.2f ms   max %8.2f ms\n",
+           hedge_gets ? "GET, hedged after p95" : "GET, no hedging",
+           latency_ns[BENCH_HEDGE_GETS / 2] / 1e6,
+           latency_ns[BENCH_HEDGE_GETS * 99 / 100] / 1e6,
+           latency_ns[BENCH_HEDGE_GETS - 1] / 1e6);
+
+    ninja_client_destroy(client);
+}
+
+void bench_pipeline(void) {
+    bench_server_t server;
+    memset(&server, 0, sizeof(server));
+    server.listener = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t address_length = sizeof(address);
+    if (server.listener < 0 ||
+        bind(server.listener, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(server.listener, 64) != 0 ||
+        getsockname(server.listener, (struct sockaddr*)&address, &address_length) != 0) {
+        printf("  loopback server unavailable\n");
+        if (server.listener >= 0) {
+            close(server.listener);
+        }
+        return;
+    }
+
+    pthread_t acceptor;
+    pthread_create(&acceptor, NULL, bench_server_accept, &server);
+
+    char base_url[64];
+    snprintf(base_url, sizeof(base_url), "http://127.0.0.1:%d/v1", ntohs(address.sin_port));
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    options.http_connections = 8;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    if (!client) {
+        printf("  client creation failed\n");
+        server.stop = 1;
+        shutdown(server.listener, SHUT_RDWR);
+        close(server.listener);
+        pthread_join(acceptor, NULL);
+        return;
+    }
+
+    ninja_order_id_t order_ids[BENCH_PIPELINE_CANCELS];
+    ninja_error_t results[BENCH_PIPELINE_CANCELS];
+    for (int i = 0; i < BENCH_PIPELINE_CANCELS; i++) {
+        order_ids[i] = 9000000000LL + i;
+    }
+
+    // Warm both the single connection and the pool
+    ninja_cancel_order(client, order_ids[0]);
+    ninja_cancel_orders(client, order_ids, BENCH_PIPELINE_CANCELS, results);
+
+    uint64_t operations = (uint64_t)BENCH_PIPELINE_ROUNDS * BENCH_PIPELINE_CANCELS;
+    int failures = 0;
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < BENCH_PIPELINE_ROUNDS; round++) {
+        for (int i = 0; i < BENCH_PIPELINE_CANCELS; i++) {
+            failures += ninja_cancel_order(client, order_ids[i]) != NINJA_OK;
+        }
+    }
+    bench_report("64 cancels, one at a time", operations, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_PIPELINE_ROUNDS; round++) {
+        ninja_cancel_orders(client, order_ids, BENCH_PIPELINE_CANCELS, results);
+        for (int i = 0; i < BENCH_PIPELINE_CANCELS; i++) {
+            failures += results[i] != NINJA_OK;
+        }
+    }
+    bench_report("64 cancels, one batch (8 conn HTTP/1.1)", operations, bench_now_ns() - start, 0);
+
+    if (failures > 0) {
+        printf("  %d requests failed\n", failures);
+    }
+    printf("  stand-in: HTTP/1.1, %d us per request\n", BENCH_PIPELINE_SERVER_US);
+
+    ninja_client_destroy(client);
+
+    bench_server_tail = 1;
+    bench_hedge(base_url, false);
+    bench_hedge(base_url, true);
+    printf("  stand-in: 1 in %d requests takes %d us\n", BENCH_HEDGE_TAIL_EVERY, BENCH_HEDGE_TAIL_US);
+    server.stop = 1;
+    shutdown(server.listener, SHUT_RDWR);
+    close(server.listener);
+    pthread_join(acceptor, NULL);
+}
+
+#else
+
+void bench_pipeline(void) {
+    printf("  loopback stand-in not available on Windows; skipped\n");
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_SHM_NAME "/ninja_bench_shm"
+#define BENCH_SHM_POSITIONS 256
+#define BENCH_SHM_ROUNDS 1000000
+
+void bench_shm(void) {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.shm_name = BENCH_SHM_NAME;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    if (!client) {
+        printf("  shared memory unavailable\n");
+        return;
+    }
+
+    ninja_position_t positions[BENCH_SHM_POSITIONS];
+    memset(positions, 0, sizeof(positions));
+    for (int i = 0; i < BENCH_SHM_POSITIONS; i++) {
+        positions[i].account_id = 1 + i % 4;
+        positions[i].contract_id = 1000 + i;
+        positions[i].net_position = i;
+    }
+    ninja_publish_positions(client, positions, BENCH_SHM_POSITIONS);
+
+    ninja_shm_reader_t* reader = ninja_shm_reader_open(BENCH_SHM_NAME);
+    if (!reader) {
+        printf("  reader attach failed\n");
+        ninja_client_destroy(client);
+        ninja_shm_remove(BENCH_SHM_NAME);
+        return;
+    }
+
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_SHM_ROUNDS; i++) {
+        ninja_position_t* position = &positions[i & (BENCH_SHM_POSITIONS - 1)];
+        position->net_position = i;
+        ninja_publish_positions(client, position, 1);
+    }
+    bench_report("publish position (one per batch)", BENCH_SHM_ROUNDS, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_SHM_ROUNDS; i++) {
+        const ninja_position_t* wanted = &positions[(i * 7) & (BENCH_SHM_POSITIONS - 1)];
+        ninja_position_t position;
+        if (ninja_shm_read_position(reader, wanted->account_id, wanted->contract_id, &position) == NINJA_OK) {
+            bench_sink += position.net_position;
+        }
+    }
+    bench_report("read position", BENCH_SHM_ROUNDS, bench_now_ns() - start, 0);
+
+    int snapshots = 10000;
+    start = bench_now_ns();
+    for (int i = 0; i < snapshots; i++) {
+        ninja_position_t* snapshot = NULL;
+        size_t count = 0;
+        if (ninja_shm_read_positions(reader, &snapshot, &count) == NINJA_OK) {
+            bench_sink += (int64_t)count;
+        }
+        ninja_free_array(snapshot);
+    }
+    bench_report("snapshot 256 positions", snapshots, bench_now_ns() - start, 0);
+
+    ninja_shm_reader_close(reader);
+    ninja_client_destroy(client);
+    ninja_shm_remove(BENCH_SHM_NAME);
+}
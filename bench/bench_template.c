@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "ninja_client.h"
+#include "bench_common.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_TEMPLATE_ROUNDS 200000
+
+void bench_template(void) {
+    ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+    if (!client) {
+        printf("  client creation failed\n");
+        return;
+    }
+
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.account_spec, "DEMO123456");
+    request.account_id = 123456;
+    strcpy(request.symbol, "ESZ5");
+    request.side = NINJA_SIDE_BUY;
+    request.type = NINJA_ORDER_LIMIT;
+    request.is_automated = true;
+
+    // What ninja_place_order does before the request reaches curl: new
+    // clOrdId, schema encode into a cJSON tree, print, free
+    size_t bytes = 0;
+    uint64_t allocations_before = 0;
+    uint64_t allocations_after = 0;
+    bench_allocations(&allocations_before);
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_TEMPLATE_ROUNDS; i++) {
+        request.quantity = 1 + (i & 7);
+        request.price = 5000.25 + (double)(i & 63) * 0.25;
+        ninja_next_client_order_id(client, request.client_order_id, sizeof(request.client_order_id));
+
+        cJSON* json = ninja_order_request_json(&request, true);
+        char* body = cJSON_Print(json);
+        cJSON_Delete(json);
+        bytes += strlen(body);
+        bench_sink += body[0];
+        free(body);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    bench_allocations(&allocations_after);
+    bench_report_allocations("cJSON body (current path)", BENCH_TEMPLATE_ROUNDS, elapsed, bytes,
+                             allocations_after - allocations_before);
+
+    // Cancel and modify bodies, as ninja_cancel_order and ninja_modify_order build them
+    bytes = 0;
+    bench_allocations(&allocations_before);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_TEMPLATE_ROUNDS; i++) {
+        char* body = ninja_cancel_request_body(3000000000LL + i);
+        bytes += strlen(body);
+        bench_sink += body[0];
+        free(body);
+    }
+    elapsed = bench_now_ns() - start;
+    bench_allocations(&allocations_after);
+    bench_report_allocations("cJSON cancel body", BENCH_TEMPLATE_ROUNDS, elapsed, bytes,
+                             allocations_after - allocations_before);
+
+    bytes = 0;
+    bench_allocations(&allocations_before);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_TEMPLATE_ROUNDS; i++) {
+        char* body = ninja_modify_request_body(3000000000LL + i, 1 + (i & 7), 5000.25 + (double)(i & 63) * 0.25);
+        bytes += strlen(body);
+        bench_sink += body[0];
+        free(body);
+    }
+    elapsed = bench_now_ns() - start;
+    bench_allocations(&allocations_after);
+    bench_report_allocations("cJSON modify body", BENCH_TEMPLATE_ROUNDS, elapsed, bytes,
+                             allocations_after - allocations_before);
+
+    ninja_order_template_t* order_template = NULL;
+    if (ninja_order_template_create(client, &request, &order_template) != NINJA_OK) {
+        printf("  template creation failed\n");
+        ninja_client_destroy(client);
+        return;
+    }
+
+    // Same placements through the template: three slot patches
+    const char* body = NULL;
+    size_t length = 0;
+    bytes = 0;
+    bench_allocations(&allocations_before);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_TEMPLATE_ROUNDS; i++) {
+        ninja_order_template_render(client, order_template, 1 + (i & 7), 5000.25 + (double)(i & 63) * 0.25, 0.0,
+                                    &body, &length);
+        bytes += length;
+        bench_sink += body[length - 1];
+    }
+    elapsed = bench_now_ns() - start;
+    bench_allocations(&allocations_after);
+    bench_report_allocations("template body (patched slots)", BENCH_TEMPLATE_ROUNDS, elapsed, bytes,
+                             allocations_after - allocations_before);
+    printf("  body: %zu bytes\n", length);
+
+    ninja_order_template_free(order_template);
+    ninja_client_destroy(client);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// strptime and timegm are POSIX/BSD extensions
+#ifndef _WIN32
+    #define _XOPEN_SOURCE 700
+    #define _DEFAULT_SOURCE
+#endif
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_TIMESTAMP_COUNT 4096
+#define BENCH_TIMESTAMP_ROUNDS 256
+
+// Reference decoder: the strptime/timegm path consumers used before
+static int64_t bench_strptime_ns(const char* text) {
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+#ifdef _WIN32
+    int year, month, day;
+    if (sscanf(text, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &tm.tm_hour, &tm.tm_min, &tm.tm_sec) != 6) {
+        return 0;
+    }
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    int64_t seconds = (int64_t)_mkgmtime(&tm);
+    const char* rest = text + 19;
+#else
+    const char* rest = strptime(text, "%Y-%m-%dT%H:%M:%S", &tm);
+    if (!rest) {
+        return 0;
+    }
+    int64_t seconds = (int64_t)timegm(&tm);
+#endif
+
+    int64_t fraction_ns = 0;
+    if (*rest == '.') {
+        int64_t scale = 100000000;
+        for (rest++; *rest >= '0' && *rest <= '9'; rest++) {
+            fraction_ns += (*rest - '0') * scale;
+            scale /= 10;
+        }
+    }
+    return seconds * 1000000000LL + fraction_ns;
+}
+
+void bench_timestamp(void) {
+    static char texts[BENCH_TIMESTAMP_COUNT][32];
+    static size_t lengths[BENCH_TIMESTAMP_COUNT];
+
+    // Realistic spread of session timestamps with millisecond fractions
+    srand(42);
+    for (size_t i = 0; i < BENCH_TIMESTAMP_COUNT; i++) {
+        lengths[i] = (size_t)snprintf(texts[i], sizeof(texts[i]), "2024-%02d-%02dT%02d:%02d:%02d.%03dZ",
+                                      1 + rand() % 12, 1 + rand() % 28, rand() % 24,
+                                      rand() % 60, rand() % 60, rand() % 1000);
+    }
+
+    // Both decoders must agree before timing them
+    for (size_t i = 0; i < BENCH_TIMESTAMP_COUNT; i++) {
+        int64_t fast = 0;
+        if (ninja_parse_timestamp(texts[i], lengths[i], &fast) != NINJA_OK || fast != bench_strptime_ns(texts[i])) {
+            printf("  mismatch on %s\n", texts[i]);
+            return;
+        }
+    }
+
+    uint64_t ops = (uint64_t)BENCH_TIMESTAMP_COUNT * BENCH_TIMESTAMP_ROUNDS;
+    int64_t sum = 0;
+
+    uint64_t start = bench_now_ns();
+    for (int round = 0; round < BENCH_TIMESTAMP_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_TIMESTAMP_COUNT; i++) {
+            int64_t ns = 0;
+            ninja_parse_timestamp(texts[i], lengths[i], &ns);
+            sum += ns;
+        }
+    }
+    bench_report("ninja_parse_timestamp", ops, bench_now_ns() - start, 0);
+
+    start = bench_now_ns();
+    for (int round = 0; round < BENCH_TIMESTAMP_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_TIMESTAMP_COUNT; i++) {
+            sum += bench_strptime_ns(texts[i]);
+        }
+    }
+    bench_report("strptime + timegm", ops, bench_now_ns() - start, 0);
+
+    bench_sink += sum;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <ninja/ninja_api.h>
+#include "bench_common.h"
+#include "ninja_trace.h"
+#include <stdio.h>
+
+// Spans per batch, below a thread's ring size so none are dropped
+#define BENCH_TRACE_BATCH 4000
+#define BENCH_TRACE_BATCHES 250
+
+// Helper function to time recording spans the way the request path does,
+// draining between batches outside the timed region
+static void bench_trace_spans(const char* name, bool per_request) {
+    static ninja_span_t spans[BENCH_TRACE_BATCH];
+    uint64_t trace_id = ninja_trace_begin();
+    uint64_t elapsed = 0;
+    for (int batch = 0; batch < BENCH_TRACE_BATCHES; batch++) {
+        uint64_t start = bench_now_ns();
+        for (int i = 0; i < BENCH_TRACE_BATCH; i++) {
+            if (per_request) {
+                trace_id = ninja_trace_begin();
+            }
+            uint64_t trace_start = ninja_trace_start(trace_id);
+            ninja_trace_span(trace_id, NINJA_SPAN_SERIALIZE, trace_start);
+        }
+        elapsed += bench_now_ns() - start;
+
+        size_t count = 0;
+        ninja_trace_drain(spans, BENCH_TRACE_BATCH, &count);
+        bench_sink += (int64_t)count;
+    }
+
+    bench_report(name, (uint64_t)BENCH_TRACE_BATCHES * BENCH_TRACE_BATCH, elapsed, 0);
+}
+
+// Helper function to time the timestamp counter read each span boundary takes
+static void bench_trace_ticks(void) {
+    uint64_t sum = 0;
+    uint64_t start = bench_now_ns();
+    for (int i = 0; i < BENCH_TRACE_BATCH * BENCH_TRACE_BATCHES; i++) {
+        sum += ninja_trace_start(1);
+    }
+    bench_report("counter read", (uint64_t)BENCH_TRACE_BATCH * BENCH_TRACE_BATCHES, bench_now_ns() - start, 0);
+    bench_sink += (int64_t)sum;
+}
+
+void bench_trace(void) {
+    ninja_trace_enable(false);
+    bench_trace_spans("span, tracing disabled", true);
+
+    if (ninja_trace_enable(true) != NINJA_OK) {
+        printf("  tracing compiled out (NINJA_ENABLE_TRACING=OFF)\n");
+        return;
+    }
+    bench_trace_ticks();
+    bench_trace_spans("span", false);
+    bench_trace_spans("trace begin + span", true);
+
+    // Converting and exporting what was recorded
+    static ninja_span_t spans[BENCH_TRACE_BATCH];
+    for (int i = 0; i < BENCH_TRACE_BATCH; i++) {
+        uint64_t trace_id = ninja_trace_begin();
+        ninja_trace_span(trace_id, NINJA_SPAN_PARSE, ninja_trace_start(trace_id));
+    }
+    size_t count = 0;
+    uint64_t start = bench_now_ns();
+    ninja_trace_drain(spans, BENCH_TRACE_BATCH, &count);
+    bench_report("drain (per span)", count, bench_now_ns() - start, 0);
+    ninja_trace_enable(false);
+}
@@ -93,7 +93,7 @@ int main() {
 
     if (result == NINJA_OK) {
         printf("Order placed successfully!\n");
-        printf("Order ID: %s\n", order.order_id);
+        printf("Order ID: %lld\n", (long long)order.order_id);
         printf("Symbol: %s\n", order.symbol);
         printf("Side: %s\n", (order.side == NINJA_SIDE_BUY) ? "BUY" : "SELL");
         printf("Quantity: %d\n", order.quantity);
@@ -108,7 +108,7 @@ int main() {
             sleep(2);
         #endif
 
-        printf("Attempting to cancel order %s...\n", order.order_id);
+        printf("Attempting to cancel order %lld...\n", (long long)order.order_id);
         result = ninja_cancel_order(client, order.order_id);
 
         if (result == NINJA_OK) {
@@ -100,8 +100,8 @@ int main() {
             if (order_count > 0) {
                 printf("\nOpen orders:\n");
                 for (size_t i = 0; i < order_count; i++) {
-                    printf("  Order %s: %s %d %s @ $%.2f (Status: %d)\n",
-                           orders[i].order_id,
+                    printf("  Order %lld: %s %d %s @ $%.2f (Status: %d)\n",
+                           (long long)orders[i].order_id,
                            (orders[i].side == NINJA_SIDE_BUY) ? "BUY" : "SELL",
                            orders[i].quantity,
                            orders[i].symbol,
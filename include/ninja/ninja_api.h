@@ -28,10 +28,39 @@
 extern "C" {
 #endif
 
+// Library context. Every client holds a reference to process-wide state:
+// libcurl's global init, plus DNS and TLS session caches shared by all
+// clients. Calling ninja_library_init() once at startup keeps that state
+// (and its warm caches) alive while clients come and go; each call is
+// balanced by one ninja_library_cleanup(). Thread-safe.
+ninja_error_t ninja_library_init(void);
+void ninja_library_cleanup(void);
+
 // Client management
 ninja_client_t* ninja_client_create(ninja_env_t env);
+void ninja_client_options_init(ninja_client_options_t* options, ninja_env_t env);
+ninja_client_t* ninja_client_create_with_options(const ninja_client_options_t* options);
 void ninja_client_destroy(ninja_client_t* client);
 
+// Response bytes on the wire vs. after decoding, across all requests so far
+ninja_error_t ninja_get_transfer_stats(ninja_client_t* client, ninja_transfer_stats_t* stats);
+
+// Request tracing, process-wide: once enabled, requests record their phases
+// (serialize, queue, connect, send, TTFB, receive, parse, callback) into a
+// ring per thread. Drain the spans periodically; spans that find their
+// thread's ring full are dropped and counted. Builds configured with
+// NINJA_ENABLE_TRACING=OFF record nothing and refuse to enable with
+// NINJA_ERROR_NOT_FOUND.
+ninja_error_t ninja_trace_enable(bool enabled);
+
+// Move up to max_spans recorded spans into spans, oldest first per thread
+ninja_error_t ninja_trace_drain(ninja_span_t* spans, size_t max_spans, size_t* count);
+uint64_t ninja_trace_dropped(void);
+
+// Drain every recorded span into a Chrome trace file (chrome://tracing, Perfetto)
+ninja_error_t ninja_trace_export_chrome(const char* path);
+const char* ninja_span_kind_to_string(ninja_span_kind_t kind);
+
 // Authentication
 ninja_error_t ninja_authenticate(ninja_client_t* client,
                                 const char* username,
@@ -42,6 +71,43 @@ ninja_error_t ninja_authenticate(ninja_client_t* client,
 
 ninja_error_t ninja_renew_token(ninja_client_t* client, ninja_auth_response_t* auth_response);
 
+// Session manager: many logins over one client's connections. Each session
+// keeps its own tokens, Authorization header and delta sync state, and
+// ninja_session_client() switches the shared client to it; the returned
+// client serves that session until the manager is next used; renew through
+// the manager, not ninja_renew_token(). Order tracking, the journal and shm
+// publication are shared by all sessions. Renewals are staggered across
+// renew_spread_s so sessions opened together do not renew together.
+// Not thread-safe.
+void ninja_session_options_init(ninja_session_options_t* options);
+ninja_session_manager_t* ninja_session_manager_create(const ninja_session_options_t* options);
+void ninja_session_manager_destroy(ninja_session_manager_t* manager);
+
+ninja_error_t ninja_session_open(ninja_session_manager_t* manager,
+                                const char* username,
+                                const char* password,
+                                const char* app_id,
+                                const char* app_version,
+                                ninja_session_id_t* session,
+                                ninja_auth_response_t* auth_response);
+
+// Adds a session authenticated elsewhere (access_token required)
+ninja_error_t ninja_session_add(ninja_session_manager_t* manager,
+                               const ninja_auth_response_t* auth,
+                               ninja_session_id_t* session);
+
+ninja_error_t ninja_session_close(ninja_session_manager_t* manager, ninja_session_id_t session);
+ninja_client_t* ninja_session_client(ninja_session_manager_t* manager, ninja_session_id_t session);
+ninja_error_t ninja_session_get_info(ninja_session_manager_t* manager,
+                                    ninja_session_id_t session,
+                                    ninja_session_info_t* info);
+
+// Renew up to max_renewals sessions whose renewal time has passed. A failed
+// session is retried after a minute; the first failure is returned.
+ninja_error_t ninja_session_renew_due(ninja_session_manager_t* manager,
+                                     size_t max_renewals,
+                                     size_t* renewed);
+
 // Account operations
 ninja_error_t ninja_get_accounts(ninja_client_t* client,
                                 ninja_account_t** accounts,
@@ -64,11 +130,31 @@ ninja_error_t ninja_place_order(ninja_client_t* client,
                                bool is_automated,
                                ninja_order_t* order_out);
 
+ninja_error_t ninja_place_order_request(ninja_client_t* client,
+                                       const ninja_order_request_t* request,
+                                       ninja_order_t* order_out);
+
 ninja_error_t ninja_cancel_order(ninja_client_t* client,
-                                const char* order_id);
+                                ninja_order_id_t order_id);
+
+// Concurrent batches: HTTP/2 streams over one connection (cancels weighted
+// highest), or up to http_connections HTTP/1.1 connections. Each entry is
+// retried on its own as a single call would be (placements only when never
+// sent). results[i] is entry i's outcome; the return value is the first
+// failure, if any.
+ninja_error_t ninja_place_orders(ninja_client_t* client,
+                                const ninja_order_request_t* requests,
+                                size_t count,
+                                ninja_order_t* orders,
+                                ninja_error_t* results);
+
+ninja_error_t ninja_cancel_orders(ninja_client_t* client,
+                                 const ninja_order_id_t* order_ids,
+                                 size_t count,
+                                 ninja_error_t* results);
 
 ninja_error_t ninja_modify_order(ninja_client_t* client,
-                                const char* order_id,
+                                ninja_order_id_t order_id,
                                 int new_quantity,
                                 double new_price);
 
@@ -77,9 +163,88 @@ ninja_error_t ninja_get_orders(ninja_client_t* client,
                               size_t* count);
 
 ninja_error_t ninja_get_order_by_id(ninja_client_t* client,
-                                   const char* order_id,
+                                   ninja_order_id_t order_id,
                                    ninja_order_t* order);
 
+ninja_error_t ninja_lookup_order(ninja_client_t* client,
+                                ninja_order_id_t order_id,
+                                ninja_order_t* order);
+
+// Client order ids (clOrdId): unique across clients, increasing within one,
+// and generated without locking. A placement is tracked under its clOrdId
+// from the moment it is made: NINJA_ORDER_PENDING (order_id 0) until the
+// broker answers, then the broker's order, kept current as it is refreshed.
+// Filled, cancelled and rejected placements are dropped once newer ones need
+// the room; a batch that could not be sent leaves its placements rejected.
+// A placement whose answer is lost or does not parse is found again by its
+// clOrdId, at the cost of downloading the whole command/list.
+ninja_error_t ninja_next_client_order_id(ninja_client_t* client,
+                                        char* client_order_id,
+                                        size_t size);
+
+ninja_error_t ninja_lookup_client_order(ninja_client_t* client,
+                                       const char* client_order_id,
+                                       ninja_order_t* order);
+
+// Asynchronous submission (requires io_thread in the client options). Requests
+// run in order on the I/O thread and complete through completion_callback;
+// NINJA_ERROR_MEMORY means the queue is full.
+ninja_error_t ninja_submit_order(ninja_client_t* client,
+                                const ninja_order_request_t* request,
+                                uint64_t* request_id);
+
+// Submit an order and return its clOrdId immediately (the request's own or
+// a generated one) into NINJA_CLIENT_ORDER_ID_SIZE bytes. The completion
+// carries the same clOrdId, and the order is tracked under it from when the
+// I/O thread sends it, including fills as the order is refreshed.
+ninja_error_t ninja_submit_order_with_id(ninja_client_t* client,
+                                        const ninja_order_request_t* request,
+                                        char* client_order_id,
+                                        uint64_t* request_id);
+
+ninja_error_t ninja_submit_cancel(ninja_client_t* client,
+                                 ninja_order_id_t order_id,
+                                 uint64_t* request_id);
+
+ninja_error_t ninja_submit_order_query(ninja_client_t* client,
+                                      ninja_order_id_t order_id,
+                                      uint64_t* request_id);
+
+// Order templates. The placeorder body for one account/symbol/side/type is
+// rendered once; each placement patches fixed-width orderQty, price,
+// stopPrice and clOrdId slots in place and posts it to a pre-built URL.
+// Prices are sent with up to 9 decimals. A template belongs to the client it
+// was created for and is used by one thread at a time.
+ninja_error_t ninja_order_template_create(ninja_client_t* client,
+                                         const ninja_order_request_t* prototype,
+                                         ninja_order_template_t** order_template);
+
+void ninja_order_template_free(ninja_order_template_t* order_template);
+
+// Patch the slots for the next placement and return the body as it would be
+// sent; it stays valid until the template is patched again
+ninja_error_t ninja_order_template_render(ninja_client_t* client,
+                                         ninja_order_template_t* order_template,
+                                         int quantity,
+                                         double price,
+                                         double stop_price,
+                                         const char** body,
+                                         size_t* length);
+
+ninja_error_t ninja_order_template_place(ninja_client_t* client,
+                                        ninja_order_template_t* order_template,
+                                        int quantity,
+                                        double price,
+                                        double stop_price,
+                                        ninja_order_t* order_out);
+
+// Order journal (requires journal_path in the client options)
+ninja_error_t ninja_recover_orders(ninja_client_t* client,
+                                  ninja_recovered_order_t** orders,
+                                  size_t* count);
+
+ninja_error_t ninja_sync_journal(ninja_client_t* client);
+
 // Position operations
 ninja_error_t ninja_get_positions(ninja_client_t* client,
                                  ninja_position_t** positions,
@@ -90,6 +255,23 @@ ninja_error_t ninja_get_positions_by_account(ninja_client_t* client,
                                             ninja_position_t** positions,
                                             size_t* count);
 
+// Fill operations. ninja_get_fills_since() returns fills after a fill id in
+// id order, at most max_fills (0 for all); pass the last id back to page.
+ninja_error_t ninja_get_fills(ninja_client_t* client,
+                             ninja_fill_t** fills,
+                             size_t* count);
+
+ninja_error_t ninja_get_order_fills(ninja_client_t* client,
+                                   ninja_order_id_t order_id,
+                                   ninja_fill_t** fills,
+                                   size_t* count);
+
+ninja_error_t ninja_get_fills_since(ninja_client_t* client,
+                                   int64_t after_fill_id,
+                                   size_t max_fills,
+                                   ninja_fill_t** fills,
+                                   size_t* count);
+
 // Contract operations
 ninja_error_t ninja_get_contract_by_symbol(ninja_client_t* client,
                                           const char* symbol,
@@ -99,12 +281,224 @@ ninja_error_t ninja_get_contract_by_id(ninja_client_t* client,
                                       int contract_id,
                                       ninja_contract_t* contract);
 
+// Contract search (contract/suggest). With a contract catalog, a term that
+// prefixes a catalog symbol, name or full_name word is answered locally;
+// only unknown terms go to the server.
 ninja_error_t ninja_find_contracts(ninja_client_t* client,
                                   const char* search_term,
                                   ninja_contract_t** contracts,
                                   size_t* count);
 
+// Same search against the catalog only, for autocomplete: symbol matches
+// first, at most max contracts (0 for all), never a network call
+ninja_error_t ninja_search_contracts(ninja_client_t* client,
+                                    const char* prefix,
+                                    size_t max,
+                                    ninja_contract_t** contracts,
+                                    size_t* count);
+
+// Contract catalog (requires contract_catalog_path in the client options)
+ninja_error_t ninja_add_catalog_contracts(ninja_client_t* client,
+                                         const ninja_contract_t* contracts,
+                                         size_t count);
+
+ninja_error_t ninja_refresh_contract_catalog(ninja_client_t* client,
+                                            size_t max_contracts,
+                                            size_t* remaining);
+
+ninja_error_t ninja_save_contract_catalog(ninja_client_t* client);
+
+// Shared-memory publication. A client created with shm_name publishes every
+// order and position it fetches; other processes read them without syscalls.
+// A full order table evicts filled, cancelled, rejected, expired and completed
+// orders; NINJA_ERROR_MEMORY means every slot holds a live order.
+ninja_error_t ninja_publish_positions(ninja_client_t* client,
+                                     const ninja_position_t* positions,
+                                     size_t count);
+
+ninja_error_t ninja_publish_orders(ninja_client_t* client,
+                                  const ninja_order_t* orders,
+                                  size_t count);
+
+ninja_shm_reader_t* ninja_shm_reader_open(const char* name);
+void ninja_shm_reader_close(ninja_shm_reader_t* reader);
+uint64_t ninja_shm_reader_generation(const ninja_shm_reader_t* reader);
+
+ninja_error_t ninja_shm_read_position(const ninja_shm_reader_t* reader,
+                                     int account_id,
+                                     int contract_id,
+                                     ninja_position_t* position);
+
+ninja_error_t ninja_shm_read_order(const ninja_shm_reader_t* reader,
+                                  ninja_order_id_t order_id,
+                                  ninja_order_t* order);
+
+ninja_error_t ninja_shm_read_positions(const ninja_shm_reader_t* reader,
+                                      ninja_position_t** positions,
+                                      size_t* count);
+
+ninja_error_t ninja_shm_read_orders(const ninja_shm_reader_t* reader,
+                                   ninja_order_t** orders,
+                                   size_t* count);
+
+ninja_error_t ninja_shm_remove(const char* name);
+
+// Response decoding (JSON array text as returned by the list endpoints)
+ninja_error_t ninja_parse_orders(const char* json,
+                                size_t length,
+                                ninja_order_t** orders,
+                                size_t* count);
+
+ninja_error_t ninja_parse_positions(const char* json,
+                                   size_t length,
+                                   ninja_position_t** positions,
+                                   size_t* count);
+
+ninja_error_t ninja_parse_fills(const char* json,
+                               size_t length,
+                               ninja_fill_t** fills,
+                               size_t* count);
+
+ninja_error_t ninja_parse_accounts(const char* json,
+                                  size_t length,
+                                  ninja_account_t** accounts,
+                                  size_t* count);
+
+ninja_error_t ninja_parse_contracts(const char* json,
+                                   size_t length,
+                                   ninja_contract_t** contracts,
+                                   size_t* count);
+
+// Delta sync. The list getters and these share one conditional request per
+// endpoint: a 304 or an identical body costs no parsing, and the delta holds
+// only what changed since the previous fetch. Free delta.records with
+// ninja_free_array().
+ninja_error_t ninja_sync_orders(ninja_client_t* client, ninja_order_delta_t* delta);
+ninja_error_t ninja_sync_positions(ninja_client_t* client, ninja_position_delta_t* delta);
+ninja_error_t ninja_sync_accounts(ninja_client_t* client, ninja_account_delta_t* delta);
+
+// Historical chart data (md/getChart on the market data endpoint). The range
+// is fetched in chunks, parallel_requests at a time; each chunk is decoded
+// and appended to the columnar file at path once every earlier chunk is in,
+// so at most parallel_requests chunks are held in memory. Rows are appended
+// in timestamp order. On failure the file keeps every chunk before the
+// first failed one; *records counts the rows added either way.
+ninja_error_t ninja_download_chart(ninja_client_t* client,
+                                  const ninja_chart_request_t* request,
+                                  const char* path,
+                                  uint64_t* records);
+
+// Columnar files: a whole column, across all blocks, as a new array; free it
+// with ninja_free_array()
+ninja_error_t ninja_read_column_int64(const char* path, const char* column, int64_t** values, size_t* count);
+ninja_error_t ninja_read_column_double(const char* path, const char* column, double** values, size_t* count);
+ninja_error_t ninja_read_column_int32(const char* path, const char* column, int32_t** values, size_t* count);
+ninja_error_t ninja_read_column_uint8(const char* path, const char* column, uint8_t** values, size_t* count);
+ninja_error_t ninja_read_column_text(const char* path,
+                                     const char* column,
+                                     char (**values)[NINJA_COLUMN_TEXT_SIZE],
+                                     size_t* count);
+
+// Bar aggregation: trades from any source (fills, chart ticks, a recorded
+// file) build time, tick and volume bars for every contract at once, each
+// trade updating every series in constant time. Completed bars queue up
+// until drained, oldest first. Trades should arrive in time order per
+// contract; a late trade joins the bar that is open. Not thread-safe.
+ninja_bar_aggregator_t* ninja_bar_aggregator_create(const ninja_bar_series_t* series, size_t series_count);
+void ninja_bar_aggregator_destroy(ninja_bar_aggregator_t* aggregator);
+
+ninja_error_t ninja_bar_add_trade(ninja_bar_aggregator_t* aggregator,
+                                 int contract_id,
+                                 int64_t timestamp_ns,
+                                 double price,
+                                 int32_t size);
+ninja_error_t ninja_bar_add_trades(ninja_bar_aggregator_t* aggregator, const ninja_trade_t* trades, size_t count);
+
+// Close time bars whose interval ended by now_ns, for quiet contracts
+ninja_error_t ninja_bar_flush(ninja_bar_aggregator_t* aggregator, int64_t now_ns);
+
+// Copy out up to max completed bars; *count is how many were copied
+ninja_error_t ninja_bar_drain(ninja_bar_aggregator_t* aggregator, ninja_bar_t* bars, size_t max, size_t* count);
+
+// Bar still being built for a contract and series; NINJA_ERROR_NOT_FOUND if none
+ninja_error_t ninja_bar_current(ninja_bar_aggregator_t* aggregator,
+                               int contract_id,
+                               uint32_t series,
+                               ninja_bar_t* bar);
+
+// Delta between two snapshots, keyed by order id, account+contract and account id
+ninja_error_t ninja_diff_orders(const ninja_order_t* previous,
+                               size_t previous_count,
+                               const ninja_order_t* current,
+                               size_t current_count,
+                               ninja_order_delta_t* delta);
+
+ninja_error_t ninja_diff_positions(const ninja_position_t* previous,
+                                  size_t previous_count,
+                                  const ninja_position_t* current,
+                                  size_t current_count,
+                                  ninja_position_delta_t* delta);
+
+ninja_error_t ninja_diff_accounts(const ninja_account_t* previous,
+                                 size_t previous_count,
+                                 const ninja_account_t* current,
+                                 size_t current_count,
+                                 ninja_account_delta_t* delta);
+
+// Compact representation
+ninja_price_ticks_t ninja_price_to_ticks(double price, double tick_size);
+double ninja_ticks_to_price(ninja_price_ticks_t ticks, double tick_size);
+
+ninja_error_t ninja_order_to_compact(const ninja_order_t* order,
+                                    double tick_size,
+                                    ninja_order_compact_t* compact);
+
+ninja_error_t ninja_compact_orders(const ninja_order_t* orders,
+                                  size_t count,
+                                  double tick_size,
+                                  ninja_order_compact_t** compact,
+                                  ninja_order_cold_t** cold);
+
+ninja_error_t ninja_compact_positions(const ninja_position_t* positions,
+                                     size_t count,
+                                     ninja_position_compact_t** compact,
+                                     ninja_position_cold_t** cold);
+
+// Columnar views: lists rearranged into one array per field
+ninja_error_t ninja_orders_to_columns(const ninja_order_t* orders, size_t count, ninja_order_columns_t* columns);
+ninja_error_t ninja_fills_to_columns(const ninja_fill_t* fills, size_t count, ninja_fill_columns_t* columns);
+ninja_error_t ninja_positions_to_columns(const ninja_position_t* positions,
+                                        size_t count,
+                                        ninja_position_columns_t* columns);
+
+// Execution quality: VWAP, slippage against arrival price and fill latency
+// for each order in arrivals, from its active fills. Fills of one order are
+// best kept together (fill/deps results, or a list sorted by order).
+ninja_error_t ninja_execution_quality(const ninja_fill_columns_t* fills,
+                                     const ninja_arrival_t* arrivals,
+                                     size_t count,
+                                     ninja_execution_t* results);
+
+// Columnar export: append a list as one block of the columnar file at path,
+// created on first use; read it back with ninja_read_column_*()
+ninja_error_t ninja_export_orders(const char* path, const ninja_order_t* orders, size_t count);
+ninja_error_t ninja_export_fills(const char* path, const ninja_fill_t* fills, size_t count);
+ninja_error_t ninja_export_positions(const char* path, const ninja_position_t* positions, size_t count);
+
+// Enum string conversion (broker vocabulary; unrecognized strings map to *_UNKNOWN)
+ninja_order_side_t ninja_order_side_from_string(const char* text, size_t length);
+ninja_order_type_t ninja_order_type_from_string(const char* text, size_t length);
+ninja_order_status_t ninja_order_status_from_string(const char* text, size_t length);
+
+const char* ninja_order_side_to_string(ninja_order_side_t side);
+const char* ninja_order_type_to_string(ninja_order_type_t type);
+const char* ninja_order_status_to_string(ninja_order_status_t status);
+
 // Utility functions
+ninja_error_t ninja_parse_timestamp(const char* text, size_t length, int64_t* timestamp_ns);
+
+// UTC epoch nanoseconds as "YYYY-MM-DDTHH:MM:SS.mmmZ" (milliseconds, truncated)
+ninja_error_t ninja_format_timestamp(int64_t timestamp_ns, char* text, size_t size);
 const char* ninja_error_string(ninja_error_t error);
 void ninja_free_array(void* array);
 
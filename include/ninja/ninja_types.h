@@ -53,7 +53,8 @@ typedef enum {
 // Order side
 typedef enum {
     NINJA_SIDE_BUY,
-    NINJA_SIDE_SELL
+    NINJA_SIDE_SELL,
+    NINJA_SIDE_UNKNOWN
 } ninja_order_side_t;
 
 // Order type
@@ -61,7 +62,12 @@ typedef enum {
     NINJA_ORDER_MARKET,
     NINJA_ORDER_LIMIT,
     NINJA_ORDER_STOP,
-    NINJA_ORDER_STOP_LIMIT
+    NINJA_ORDER_STOP_LIMIT,
+    NINJA_ORDER_MIT,
+    NINJA_ORDER_TRAILING_STOP,
+    NINJA_ORDER_TRAILING_STOP_LIMIT,
+    NINJA_ORDER_QTS,
+    NINJA_ORDER_TYPE_UNKNOWN
 } ninja_order_type_t;
 
 // Order status
@@ -70,11 +76,25 @@ typedef enum {
     NINJA_ORDER_WORKING,
     NINJA_ORDER_FILLED,
     NINJA_ORDER_CANCELLED,
-    NINJA_ORDER_REJECTED
+    NINJA_ORDER_REJECTED,
+    NINJA_ORDER_PARTIALLY_FILLED,
+    NINJA_ORDER_SUSPENDED,
+    NINJA_ORDER_EXPIRED,
+    NINJA_ORDER_COMPLETED,
+    NINJA_ORDER_PENDING_CANCEL,
+    NINJA_ORDER_PENDING_REPLACE,
+    NINJA_ORDER_STATUS_UNKNOWN
 } ninja_order_status_t;
 
+// Numeric order id as assigned by the server
+typedef int64_t ninja_order_id_t;
+
 // Forward declarations
 typedef struct ninja_client ninja_client_t;
+typedef struct ninja_shm_reader ninja_shm_reader_t;
+typedef struct ninja_order_template ninja_order_template_t;
+typedef struct ninja_session_manager ninja_session_manager_t;
+typedef struct ninja_bar_aggregator ninja_bar_aggregator_t;
 
 // Authentication response
 typedef struct {
@@ -85,9 +105,18 @@ typedef struct {
     int expires_in;
 } ninja_auth_response_t;
 
+// Client order ids (clOrdId) including the terminator
+#define NINJA_CLIENT_ORDER_ID_SIZE 32
+
+// Text written by ninja_format_timestamp, including the terminator
+#define NINJA_TIMESTAMP_TEXT_SIZE 25
+
+// Text values of columnar views and files, including the terminator
+#define NINJA_COLUMN_TEXT_SIZE 32
+
 // Order structure
 typedef struct {
-    char order_id[64];
+    ninja_order_id_t order_id;
     int account_id;
     char symbol[32];
     ninja_order_side_t side;
@@ -99,21 +128,52 @@ typedef struct {
     double filled_price;
     int filled_quantity;
     char timestamp[32];
+    int64_t timestamp_ns;
     bool is_automated;
     char error_text[256];
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE]; // clOrdId, when placed by this client
 } ninja_order_t;
 
+// Order request (body of order/placeorder)
+typedef struct {
+    char account_spec[64];
+    int account_id;
+    char symbol[32];
+    ninja_order_side_t side;
+    ninja_order_type_t type;
+    int quantity;
+    double price;
+    double stop_price;
+    bool is_automated;
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE]; // Sent as clOrdId; generated when empty
+} ninja_order_request_t;
+
 // Position structure
 typedef struct {
     int account_id;
+    int contract_id;
     char symbol[32];
     int net_position;
     double average_price;
     double unrealized_pnl;
     double realized_pnl;
     char timestamp[32];
+    int64_t timestamp_ns;
 } ninja_position_t;
 
+// Fill (execution) structure; one order may fill in several pieces
+typedef struct {
+    int64_t fill_id;
+    ninja_order_id_t order_id;
+    int contract_id;
+    ninja_order_side_t side;
+    int quantity;
+    double price;
+    char timestamp[32];
+    int64_t timestamp_ns;
+    bool active;                        // False once the fill has been busted
+} ninja_fill_t;
+
 // Account structure
 typedef struct {
     int account_id;
@@ -143,13 +203,318 @@ typedef struct {
     bool is_tradable;
 } ninja_contract_t;
 
+// Order journal flush policy
+typedef enum {
+    NINJA_JOURNAL_FLUSH_NONE,   // OS write-back only; survives process crashes
+    NINJA_JOURNAL_FLUSH_ASYNC,  // Schedule write-back every journal_group_commit records
+    NINJA_JOURNAL_FLUSH_SYNC    // Wait for every record to reach disk
+} ninja_journal_flush_t;
+
+// Changes to a list since the client last fetched it. records holds the
+// added orders first, then the changed ones, then the removed ones as last
+// seen; each group is ordered by id. All counts are zero when nothing changed.
+typedef struct {
+    ninja_order_t* records;
+    size_t added;
+    size_t changed;
+    size_t removed;
+} ninja_order_delta_t;
+
+typedef struct {
+    ninja_position_t* records;
+    size_t added;
+    size_t changed;
+    size_t removed;
+} ninja_position_delta_t;
+
+typedef struct {
+    ninja_account_t* records;
+    size_t added;
+    size_t changed;
+    size_t removed;
+} ninja_account_delta_t;
+
+// Request submitted to the client's I/O thread
+typedef enum {
+    NINJA_REQUEST_PLACE_ORDER,
+    NINJA_REQUEST_CANCEL_ORDER,
+    NINJA_REQUEST_GET_ORDER
+} ninja_request_kind_t;
+
+// Result of a submitted request, delivered on the I/O thread
+typedef struct {
+    uint64_t request_id;
+    ninja_request_kind_t kind;
+    ninja_error_t result;
+    ninja_order_id_t order_id;
+    ninja_order_t order;                // Placed or queried order
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE]; // Placements: the clOrdId returned at submission
+} ninja_completion_t;
+
+typedef void (*ninja_completion_callback_t)(const ninja_completion_t* completion, void* user_data);
+
+// Client creation options
+typedef struct {
+    ninja_env_t env;
+    const char* contract_catalog_path;  // Contract snapshot file, NULL to disable
+    int contract_catalog_max_age_s;     // Snapshot age that triggers a refresh, 0 for never
+    const char* journal_path;           // Order journal file, NULL to disable
+    size_t journal_capacity;            // Records kept before completed requests are compacted away
+    ninja_journal_flush_t journal_flush;
+    int journal_group_commit;
+    const char* shm_name;               // Shared-memory segment to publish to, NULL to disable
+    size_t shm_position_capacity;       // Positions the segment can hold
+    size_t shm_order_capacity;          // Orders the segment can hold
+    bool io_thread;                     // Run submitted requests on a dedicated thread
+    int io_thread_cpu;                  // CPU to pin the I/O thread to, -1 for none
+    bool io_busy_poll;                  // Spin instead of sleeping while the queue is empty
+    size_t io_queue_capacity;           // Submitted requests that can be pending at once
+    ninja_completion_callback_t completion_callback;
+    void* completion_user_data;
+    bool compression;                   // Negotiate compressed responses (default on)
+    const char* base_url;               // Overrides the environment's REST endpoint, NULL for default
+    const char* md_base_url;            // Overrides the environment's market data endpoint, NULL for default
+    long http_connections;              // HTTP/1.1 connections for concurrent requests when HTTP/2 is unavailable
+    int http_retries;                   // Extra attempts for failures that are safe to retry, 0 to disable
+    long retry_backoff_ms;              // First retry waits up to this long, doubling per attempt
+    long retry_backoff_max_ms;          // Cap on the retry wait
+    bool hedge_gets;                    // Duplicate a GET still running past the recent p95 latency
+    bool debug_mode;                    // Log requests, responses and order outcomes from a background thread
+    const char* debug_log_path;         // Debug log file, appended to; NULL for stderr
+    size_t debug_log_capacity;          // Records buffered for the log thread; more are dropped and counted
+} ninja_client_options_t;
+
+// Historical chart data
+typedef enum {
+    NINJA_CHART_TICKS,          // timestamp_ns, price, size, bid, ask
+    NINJA_CHART_MINUTE_BARS,    // timestamp_ns, open, high, low, close, volume
+    NINJA_CHART_DAILY_BARS      // as minute bars
+} ninja_chart_type_t;
+
+typedef struct {
+    const char* symbol;
+    ninja_chart_type_t type;
+    int element_size;           // Minutes or days per bar, 0 for 1; ignored for ticks
+    int64_t from_ns;            // Range [from_ns, to_ns), UTC epoch nanoseconds
+    int64_t to_ns;
+    int64_t chunk_ns;           // Range fetched per request, 0 for the type's default
+    int parallel_requests;      // Chunks in flight, 0 for 4
+} ninja_chart_request_t;
+
+// Bar aggregation
+typedef enum {
+    NINJA_BAR_TIME,             // size in nanoseconds, intervals aligned to the epoch
+    NINJA_BAR_TICKS,            // size in trades
+    NINJA_BAR_VOLUME            // size in contracts; a trade that overfills a bar is split
+} ninja_bar_kind_t;
+
+typedef struct {
+    ninja_bar_kind_t kind;
+    int64_t size;
+} ninja_bar_series_t;
+
+typedef struct {
+    int64_t timestamp_ns;
+    double price;
+    int32_t size;
+    int32_t contract_id;
+} ninja_trade_t;
+
+typedef struct {
+    int contract_id;
+    uint32_t series;            // Index into the aggregator's series
+    int64_t start_ns;           // Time bars: interval start; others: first trade
+    int64_t end_ns;             // Time bars: interval end; others: last trade
+    double open;
+    double high;
+    double low;
+    double close;
+    int64_t volume;
+    int64_t trades;
+} ninja_bar_t;
+
+// Session of a session manager; 0 is never a valid handle
+typedef uint64_t ninja_session_id_t;
+
+// Session manager options
+typedef struct {
+    const ninja_client_options_t* client; // Shared transport, NULL for the demo defaults (io_thread is ignored)
+    int token_lifetime_s;               // Assumed when a login does not report expires_in
+    int renew_before_s;                 // Latest renewal, ahead of token expiry
+    int renew_spread_s;                 // Renewals are spread over this window before that
+} ninja_session_options_t;
+
+// Session state, times are UTC epoch nanoseconds
+typedef struct {
+    int user_id;
+    int64_t expires_at_ns;
+    int64_t renew_at_ns;
+} ninja_session_info_t;
+
+// Order request that was in flight when the journal was last written
+typedef struct {
+    ninja_order_request_t request;      // Journaled order and clOrdId (cancels: the order's account and clOrdId)
+    bool is_cancel;
+    ninja_order_id_t order_id;          // Broker order id, 0 if the order never reached the broker
+    ninja_order_t order;                // Broker state of order_id when it was found
+} ninja_recovered_order_t;
+
+// Fixed-point price expressed as a whole number of instrument ticks
+typedef int64_t ninja_price_ticks_t;
+
+// Compact order record: hot fields only, 64 bytes (one cache line).
+// Text fields live in a parallel ninja_order_cold_t table at cold_index.
+// Average fill prices are generally off the tick grid and stay doubles.
+typedef struct {
+    int64_t order_id;
+    int64_t timestamp_ns;
+    ninja_price_ticks_t price;
+    ninja_price_ticks_t stop_price;
+    double filled_price;
+    int32_t account_id;
+    int32_t quantity;
+    int32_t filled_quantity;
+    uint32_t cold_index;
+    uint8_t side;
+    uint8_t type;
+    uint8_t status;
+    uint8_t is_automated;
+} ninja_order_compact_t;
+
+// Cold side table entry for ninja_order_compact_t
+typedef struct {
+    char symbol[32];
+    char timestamp[32];
+    char error_text[256];
+} ninja_order_cold_t;
+
+// Compact position record: hot fields only, 48 bytes
+typedef struct {
+    int64_t timestamp_ns;
+    double average_price;
+    double unrealized_pnl;
+    double realized_pnl;
+    int32_t account_id;
+    int32_t contract_id;
+    int32_t net_position;
+    uint32_t cold_index;
+} ninja_position_compact_t;
+
+// Cold side table entry for ninja_position_compact_t
+typedef struct {
+    char symbol[32];
+    char timestamp[32];
+} ninja_position_cold_t;
+
+// Columnar (structure-of-arrays) views of order, fill and position lists:
+// one contiguous array per field, all held by storage (free it with
+// ninja_free_array()). Symbols are stored once in symbols and rows refer to
+// them by index, so grouping by symbol is an integer scan.
+typedef struct {
+    size_t count;
+    size_t symbol_count;
+    char (*symbols)[NINJA_COLUMN_TEXT_SIZE];
+    int64_t* order_id;
+    int64_t* timestamp_ns;
+    double* price;
+    double* stop_price;
+    double* filled_price;
+    int32_t* account_id;
+    uint32_t* symbol;
+    int32_t* quantity;
+    int32_t* filled_quantity;
+    uint8_t* side;
+    uint8_t* type;
+    uint8_t* status;
+    uint8_t* is_automated;
+    void* storage;
+} ninja_order_columns_t;
+
+typedef struct {
+    size_t count;
+    int64_t* fill_id;
+    int64_t* order_id;
+    int64_t* timestamp_ns;
+    double* price;
+    int32_t* contract_id;
+    int32_t* quantity;
+    uint8_t* side;
+    uint8_t* active;
+    void* storage;
+} ninja_fill_columns_t;
+
+typedef struct {
+    size_t count;
+    size_t symbol_count;
+    char (*symbols)[NINJA_COLUMN_TEXT_SIZE];
+    int64_t* timestamp_ns;
+    double* average_price;
+    double* unrealized_pnl;
+    double* realized_pnl;
+    int32_t* account_id;
+    int32_t* contract_id;
+    uint32_t* symbol;
+    int32_t* net_position;
+    void* storage;
+} ninja_position_columns_t;
+
+// An order as it was sent, the baseline for its execution quality
+typedef struct {
+    ninja_order_id_t order_id;
+    ninja_order_side_t side;
+    double arrival_price;               // Market price when the order was sent
+    int64_t arrival_ns;                 // When the order was sent
+} ninja_arrival_t;
+
+// Execution quality of one order over its active fills
+typedef struct {
+    ninja_order_id_t order_id;
+    int fills;
+    int quantity;
+    double vwap;
+    double slippage;                    // VWAP against arrival price, positive when worse for the order's side
+    double slippage_bps;
+    int64_t first_fill_latency_ns;      // First and last fill after arrival_ns
+    int64_t last_fill_latency_ns;
+} ninja_execution_t;
+
 // HTTP response structure (internal)
 typedef struct {
     char* data;
     size_t size;
+    size_t capacity;
     long status_code;
 } ninja_http_response_t;
 
+// Response bytes transferred by a client since creation
+typedef struct {
+    uint64_t requests;
+    uint64_t wire_bytes;                // Bodies as received, compressed if negotiated
+    uint64_t body_bytes;                // Bodies after decoding
+} ninja_transfer_stats_t;
+
+// Phase of a request recorded by tracing
+typedef enum {
+    NINJA_SPAN_SERIALIZE,               // Request body encoded
+    NINJA_SPAN_QUEUE,                   // Waiting for the I/O thread
+    NINJA_SPAN_CONNECT,                 // DNS, TCP and TLS of a new connection
+    NINJA_SPAN_SEND,                    // Request written to the connection
+    NINJA_SPAN_TTFB,                    // Request sent until the first response byte
+    NINJA_SPAN_RECEIVE,                 // First to last response byte
+    NINJA_SPAN_PARSE,                   // Response decoded
+    NINJA_SPAN_CALLBACK,                // Completion callback
+    NINJA_SPAN_KIND_COUNT
+} ninja_span_kind_t;
+
+// One traced phase; the spans of a request share its trace id
+typedef struct {
+    uint64_t trace_id;
+    uint32_t thread_id;                 // Numbered by tracing, from 1
+    ninja_span_kind_t kind;
+    int64_t start_ns;                   // Monotonic clock
+    int64_t duration_ns;
+} ninja_span_t;
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -22,71 +22,73 @@
 
 #include "../include/ninja/ninja_api.h"
 #include "ninja_client.h"
+#include "ninja_schema.h"
 #include "cJSON.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
-// Helper function to parse JSON account into ninja_account_t
-static ninja_error_t ninja_parse_account(cJSON* account_json, ninja_account_t* account) {
-    if (!account_json || !account) {
-        return NINJA_ERROR_INVALID_PARAM;
-    }
-
-    // Clear account structure
-    memset(account, 0, sizeof(ninja_account_t));
-
-    // Parse account fields
-    cJSON* id = cJSON_GetObjectItemCaseSensitive(account_json, "id");
-    if (id && cJSON_IsNumber(id)) {
-        account->account_id = (int)cJSON_GetNumberValue(id);
-    }
-
-    cJSON* name = cJSON_GetObjectItemCaseSensitive(account_json, "name");
-    if (name && cJSON_IsString(name)) {
-        strncpy(account->name, cJSON_GetStringValue(name), sizeof(account->name) - 1);
-        strncpy(account->account_spec, cJSON_GetStringValue(name), sizeof(account->account_spec) - 1);
-    }
-
-    cJSON* balance = cJSON_GetObjectItemCaseSensitive(account_json, "cashBalance");
-    if (balance && cJSON_IsNumber(balance)) {
-        account->balance = cJSON_GetNumberValue(balance);
+// Helper function to decode the account name, which doubles as the account spec
+static void ninja_decode_account_name(const cJSON* item, void* out) {
+    ninja_account_t* account = (ninja_account_t*)out;
+    if (cJSON_IsString(item) && item->valuestring) {
+        strncpy(account->name, item->valuestring, sizeof(account->name) - 1);
+        strncpy(account->account_spec, item->valuestring, sizeof(account->account_spec) - 1);
     }
+}
 
-    cJSON* net_liq = cJSON_GetObjectItemCaseSensitive(account_json, "netLiquidatingValue");
-    if (net_liq && cJSON_IsNumber(net_liq)) {
-        account->equity = cJSON_GetNumberValue(net_liq);
+// Helper function to derive is_demo from legalStatus
+static void ninja_decode_account_legal_status(const cJSON* item, void* out) {
+    ninja_account_t* account = (ninja_account_t*)out;
+    if (cJSON_IsString(item) && item->valuestring) {
+        const char* status_str = item->valuestring;
+        account->is_demo = (strstr(status_str, "Demo") != NULL || strstr(status_str, "Sim") != NULL);
     }
+}
 
-    cJSON* margin_used = cJSON_GetObjectItemCaseSensitive(account_json, "marginUsed");
-    if (margin_used && cJSON_IsNumber(margin_used)) {
-        account->margin_used = cJSON_GetNumberValue(margin_used);
-    }
+// JSON schema of ninja_account_t
+static const ninja_field_t ninja_account_fields[] = {
+    NINJA_SCHEMA_FIELD(ninja_account_t, "id", NINJA_FIELD_INT, account_id)
+    NINJA_SCHEMA_CUSTOM("name", ninja_decode_account_name)
+    NINJA_SCHEMA_CUSTOM("legalStatus", ninja_decode_account_legal_status)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "currency", NINJA_FIELD_STRING, currency)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "cashBalance", NINJA_FIELD_DOUBLE, balance)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "netLiquidatingValue", NINJA_FIELD_DOUBLE, equity)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "marginUsed", NINJA_FIELD_DOUBLE, margin_used)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "marginAvailable", NINJA_FIELD_DOUBLE, margin_available)
+    NINJA_SCHEMA_FIELD(ninja_account_t, "buyingPower", NINJA_FIELD_DOUBLE, buying_power)
+};
+
+// Helper function to apply defaults for fields the server may omit
+static void ninja_init_account(void* record) {
+    ninja_account_t* account = (ninja_account_t*)record;
+    strcpy(account->currency, "USD");
+}
 
-    cJSON* margin_available = cJSON_GetObjectItemCaseSensitive(account_json, "marginAvailable");
-    if (margin_available && cJSON_IsNumber(margin_available)) {
-        account->margin_available = cJSON_GetNumberValue(margin_available);
+// Helper function to parse JSON account into ninja_account_t
+ninja_error_t ninja_parse_account(cJSON* account_json, ninja_account_t* account) {
+    if (!account_json || !account) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    cJSON* buying_power = cJSON_GetObjectItemCaseSensitive(account_json, "buyingPower");
-    if (buying_power && cJSON_IsNumber(buying_power)) {
-        account->buying_power = cJSON_GetNumberValue(buying_power);
-    }
+    // Clear account structure and apply defaults for optional fields
+    memset(account, 0, sizeof(ninja_account_t));
+    ninja_init_account(account);
 
-    cJSON* currency = cJSON_GetObjectItemCaseSensitive(account_json, "currency");
-    if (currency && cJSON_IsString(currency)) {
-        strncpy(account->currency, cJSON_GetStringValue(currency), sizeof(account->currency) - 1);
-    } else {
-        strcpy(account->currency, "USD"); // Default to USD
-    }
+    return ninja_schema_decode(ninja_account_fields, NINJA_SCHEMA_COUNT(ninja_account_fields), account_json, account);
+}
 
-    cJSON* legal_status = cJSON_GetObjectItemCaseSensitive(account_json, "legalStatus");
-    if (legal_status && cJSON_IsString(legal_status)) {
-        const char* status_str = cJSON_GetStringValue(legal_status);
-        account->is_demo = (strstr(status_str, "Demo") != NULL || strstr(status_str, "Sim") != NULL);
-    }
+// Helper function to key accounts for delta sync
+static uint64_t ninja_account_key(const void* record) {
+    return (uint64_t)(uint32_t)((const ninja_account_t*)record)->account_id;
+}
 
-    return NINJA_OK;
+// Helper function to adapt ninja_parse_accounts to ninja_list_sync
+static ninja_error_t ninja_parse_account_list(const char* json, size_t length, void** records, size_t* count) {
+    ninja_account_t* accounts = NULL;
+    ninja_error_t result = ninja_parse_accounts(json, length, &accounts, count);
+    *records = accounts;
+    return result;
 }
 
 ninja_error_t ninja_get_accounts(ninja_client_t* client,
@@ -99,54 +101,83 @@ ninja_error_t ninja_get_accounts(ninja_client_t* client,
     *accounts = NULL;
     *count = 0;
 
-    // Make HTTP request
-    ninja_http_response_t response;
-    ninja_error_t result = ninja_http_get(client, "account/list", &response);
+    void* records = NULL;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_list_sync(client, &client->account_list, "account/list",
+                                           ninja_parse_account_list, sizeof(ninja_account_t), ninja_account_key,
+                                           &records, count, &changes);
+    *accounts = records;
+    free(changes.records);
 
-    if (result != NINJA_OK) {
-        return result;
+    return result;
+}
+
+ninja_error_t ninja_sync_accounts(ninja_client_t* client, ninja_account_delta_t* delta) {
+    if (!client || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
-    ninja_http_response_free(&response);
+    memset(delta, 0, sizeof(ninja_account_delta_t));
 
-    if (!response_json) {
-        return NINJA_ERROR_JSON_PARSE;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_list_sync(client, &client->account_list, "account/list",
+                                           ninja_parse_account_list, sizeof(ninja_account_t), ninja_account_key,
+                                           NULL, NULL, &changes);
+    if (result == NINJA_OK) {
+        delta->records = changes.records;
+        delta->added = changes.added;
+        delta->changed = changes.changed;
+        delta->removed = changes.removed;
     }
 
-    if (!cJSON_IsArray(response_json)) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_JSON_PARSE;
-    }
+    return result;
+}
 
-    size_t account_count = cJSON_GetArraySize(response_json);
-    if (account_count == 0) {
-        cJSON_Delete(response_json);
-        return NINJA_OK;
+ninja_error_t ninja_diff_accounts(const ninja_account_t* previous,
+                                 size_t previous_count,
+                                 const ninja_account_t* current,
+                                 size_t current_count,
+                                 ninja_account_delta_t* delta) {
+    if ((!previous && previous_count > 0) || (!current && current_count > 0) || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Allocate memory for accounts
-    ninja_account_t* account_array = calloc(account_count, sizeof(ninja_account_t));
-    if (!account_array) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_MEMORY;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_delta_compare(previous, previous_count, current, current_count,
+                                               sizeof(ninja_account_t), ninja_account_key, &changes);
+    delta->records = changes.records;
+    delta->added = changes.added;
+    delta->changed = changes.changed;
+    delta->removed = changes.removed;
+
+    return result;
+}
+
+ninja_error_t ninja_parse_accounts(const char* json,
+                                  size_t length,
+                                  ninja_account_t** accounts,
+                                  size_t* count) {
+    if (!json || !accounts || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Parse each account
-    for (size_t i = 0; i < account_count; i++) {
-        cJSON* account_json = cJSON_GetArrayItem(response_json, i);
-        if (account_json) {
-            ninja_parse_account(account_json, &account_array[i]);
-        }
+    *accounts = NULL;
+    *count = 0;
+
+    cJSON* response_json = cJSON_ParseWithLength(json, length);
+    if (!response_json) {
+        return NINJA_ERROR_JSON_PARSE;
     }
 
+    // Decode every account in one pass over the array
+    void* account_array = NULL;
+    ninja_error_t result = ninja_schema_decode_array(ninja_account_fields, NINJA_SCHEMA_COUNT(ninja_account_fields),
+                                                     response_json, sizeof(ninja_account_t), ninja_init_account,
+                                                     &account_array, count);
     cJSON_Delete(response_json);
 
     *accounts = account_array;
-    *count = account_count;
-
-    return NINJA_OK;
+    return result;
 }
 
 ninja_error_t ninja_get_account_by_id(ninja_client_t* client,
@@ -22,6 +22,9 @@
 
 #include "../include/ninja/ninja_api.h"
 #include "ninja_client.h"
+#include "ninja_io.h"
+#include "ninja_atomic.h"
+#include "ninja_trace.h"
 #include <curl/curl.h>
 #include "cJSON.h"
 #include <stdlib.h>
@@ -31,13 +34,23 @@
 // HTTP response callback for libcurl
 static size_t write_callback(void* contents, size_t size, size_t nmemb, ninja_http_response_t* response) {
     size_t total_size = size * nmemb;
-    char* new_data = realloc(response->data, response->size + total_size + 1);
 
-    if (new_data == NULL) {
-        return 0; // Out of memory
+    // Bodies arrive in decoded chunks; grow geometrically so appending stays linear
+    if (response->size + total_size + 1 > response->capacity) {
+        size_t capacity = response->capacity < 4096 ? 4096 : response->capacity;
+        while (capacity < response->size + total_size + 1) {
+            capacity *= 2;
+        }
+
+        char* new_data = realloc(response->data, capacity);
+        if (new_data == NULL) {
+            return 0; // Out of memory
+        }
+
+        response->data = new_data;
+        response->capacity = capacity;
     }
 
-    response->data = new_data;
     memcpy(&(response->data[response->size]), contents, total_size);
     response->size += total_size;
     response->data[response->size] = '\0';
@@ -46,6 +59,40 @@ static size_t write_callback(void* contents, size_t size, size_t nmemb, ninja_ht
 }
 
 ninja_client_t* ninja_client_create(ninja_env_t env) {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, env);
+    return ninja_client_create_with_options(&options);
+}
+
+void ninja_client_options_init(ninja_client_options_t* options, ninja_env_t env) {
+    if (!options) {
+        return;
+    }
+
+    memset(options, 0, sizeof(ninja_client_options_t));
+    options->env = env;
+    options->contract_catalog_max_age_s = 24 * 60 * 60; // Refresh contracts daily
+    options->journal_capacity = 65536;
+    options->journal_flush = NINJA_JOURNAL_FLUSH_ASYNC;
+    options->journal_group_commit = 64;
+    options->shm_position_capacity = 1024;
+    options->shm_order_capacity = 4096;
+    options->io_thread_cpu = -1;
+    options->io_queue_capacity = 1024;
+    options->compression = true;
+    options->http_connections = 4;
+    options->http_retries = 2;
+    options->retry_backoff_ms = 50;
+    options->retry_backoff_max_ms = 1000;
+    options->debug_log_capacity = 4096;
+}
+
+ninja_client_t* ninja_client_create_with_options(const ninja_client_options_t* options) {
+    if (!options) {
+        return NULL;
+    }
+
+    ninja_env_t env = options->env;
     ninja_client_t* client = calloc(1, sizeof(ninja_client_t));
     if (!client) {
         return NULL;
@@ -53,16 +100,33 @@ ninja_client_t* ninja_client_create(ninja_env_t env) {
 
     client->env = env;
     client->timeout_ms = 30000; // 30 seconds default timeout
-    client->debug_mode = false;
+    client->debug_mode = options->debug_mode;
+    client->http_connections = options->http_connections;
+    client->retry.retries = options->http_retries > 0 ? options->http_retries : 0;
+    client->retry.backoff_ms = options->retry_backoff_ms;
+    client->retry.backoff_max_ms = options->retry_backoff_max_ms;
+    client->hedge.enabled = options->hedge_gets;
+    client->hedge.delay_ms = -1;
+    ninja_mutex_init(&client->lock);
+
+    // Seeds the retry jitter and the clOrdId prefix, which must differ
+    // between clients placing orders on the same account
+    uint64_t seed = (uint64_t)ninja_wall_clock_ns() ^ ((uint64_t)(uintptr_t)client << 16);
+    client->retry.jitter = seed;
+    client->client_order_prefix = (uint32_t)(seed ^ (seed >> 32));
 
     // Set base URL
-    const char* base_url = ninja_get_base_url(env);
+    const char* base_url = options->base_url ? options->base_url : ninja_get_base_url(env);
     strncpy(client->base_url, base_url, sizeof(client->base_url) - 1);
+    const char* md_base_url = options->md_base_url ? options->md_base_url : ninja_get_md_base_url(env);
+    strncpy(client->md_base_url, md_base_url, sizeof(client->md_base_url) - 1);
 
-    // Initialize libcurl
-    curl_global_init(CURL_GLOBAL_DEFAULT);
-    client->curl = curl_easy_init();
+    // Initialize libcurl once per process; clients share its DNS and TLS caches
+    client->context = ninja_context_acquire();
+    client->curl = client->context ? curl_easy_init() : NULL;
     if (!client->curl) {
+        ninja_mutex_destroy(&client->lock);
+        ninja_context_release(client->context);
         free(client);
         return NULL;
     }
@@ -73,6 +137,57 @@ ninja_client_t* ninja_client_create(ninja_env_t env) {
     curl_easy_setopt(client->curl, CURLOPT_USERAGENT, "NinjaTrader-API-Client/1.0");
     curl_easy_setopt(client->curl, CURLOPT_SSL_VERIFYPEER, 1L);
     curl_easy_setopt(client->curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(client->curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+    if (client->context->share) {
+        curl_easy_setopt(client->curl, CURLOPT_SHARE, client->context->share);
+    }
+
+    // Empty string: offer every encoding this libcurl can decode (gzip and
+    // deflate, plus br/zstd when built in). Decoding is streamed into
+    // write_callback one chunk at a time.
+    if (options->compression) {
+        curl_easy_setopt(client->curl, CURLOPT_ACCEPT_ENCODING, "");
+    }
+
+    // Map the contract snapshot so lookups are served before the first request
+    if (options->contract_catalog_path &&
+        ninja_catalog_open(&client->contract_catalog,
+                           options->contract_catalog_path,
+                           (int64_t)options->contract_catalog_max_age_s * 1000000000LL) != NINJA_OK) {
+        ninja_client_destroy(client);
+        return NULL;
+    }
+
+    if (options->journal_path &&
+        ninja_journal_open(&client->journal,
+                           options->journal_path,
+                           options->journal_capacity,
+                           options->journal_flush,
+                           options->journal_group_commit) != NINJA_OK) {
+        ninja_client_destroy(client);
+        return NULL;
+    }
+
+    if (options->shm_name &&
+        ninja_shm_create(&client->shm,
+                         options->shm_name,
+                         options->shm_position_capacity,
+                         options->shm_order_capacity) != NINJA_OK) {
+        ninja_client_destroy(client);
+        return NULL;
+    }
+
+    if (options->debug_mode &&
+        ninja_log_start(&client->debug_log, options->debug_log_path, options->debug_log_capacity) != NINJA_OK) {
+        ninja_client_destroy(client);
+        return NULL;
+    }
+
+    // Started last: the thread clones the configured connection
+    if (options->io_thread && ninja_io_start(client, options) != NINJA_OK) {
+        ninja_client_destroy(client);
+        return NULL;
+    }
 
     return client;
 }
@@ -82,6 +197,11 @@ void ninja_client_destroy(ninja_client_t* client) {
         return;
     }
 
+    // Finish submitted requests before tearing down what they use
+    ninja_io_stop(client);
+    ninja_pipeline_free(&client->pipeline);
+    ninja_hedge_free(&client->hedge);
+
     if (client->curl) {
         curl_easy_cleanup(client->curl);
     }
@@ -89,11 +209,42 @@ void ninja_client_destroy(ninja_client_t* client) {
     if (client->headers) {
         curl_slist_free_all(client->headers);
     }
+    if (client->md_headers) {
+        curl_slist_free_all(client->md_headers);
+    }
 
-    curl_global_cleanup();
+    ninja_order_map_free(&client->order_map);
+    ninja_order_map_free(&client->client_order_map);
+    ninja_list_cache_free(&client->order_list);
+    ninja_list_cache_free(&client->position_list);
+    ninja_list_cache_free(&client->account_list);
+
+    if (client->contract_catalog.dirty) {
+        ninja_catalog_save(&client->contract_catalog);
+    }
+    ninja_catalog_close(&client->contract_catalog);
+    ninja_contract_index_free(&client->contract_index);
+    ninja_journal_close(&client->journal);
+    ninja_shm_close(&client->shm);
+    ninja_log_stop(client->debug_log);
+    ninja_mutex_destroy(&client->lock);
+
+    ninja_context_release(client->context);
     free(client);
 }
 
+ninja_error_t ninja_get_transfer_stats(ninja_client_t* client, ninja_transfer_stats_t* stats) {
+    if (!client || !stats) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    stats->requests = ninja_atomic_load_relaxed(&client->transfer_requests);
+    stats->wire_bytes = ninja_atomic_load_relaxed(&client->transfer_wire_bytes);
+    stats->body_bytes = ninja_atomic_load_relaxed(&client->transfer_body_bytes);
+
+    return NINJA_OK;
+}
+
 const char* ninja_get_base_url(ninja_env_t env) {
     switch (env) {
         case NINJA_ENV_DEMO:
@@ -105,6 +256,15 @@ const char* ninja_get_base_url(ninja_env_t env) {
     }
 }
 
+const char* ninja_get_md_base_url(ninja_env_t env) {
+    switch (env) {
+        case NINJA_ENV_LIVE:
+            return "https://md.tradovateapi.com/v1";
+        default:
+            return "https://md-demo.tradovateapi.com/v1";
+    }
+}
+
 ninja_error_t ninja_set_auth_header(ninja_client_t* client) {
     if (!client || strlen(client->access_token) == 0) {
         return NINJA_ERROR_AUTH;
@@ -122,111 +282,371 @@ ninja_error_t ninja_set_auth_header(ninja_client_t* client) {
     client->headers = curl_slist_append(NULL, "Content-Type: application/json");
     client->headers = curl_slist_append(client->headers, auth_header);
 
+    // Market data requests authenticate with their own token
+    if (client->md_headers) {
+        curl_slist_free_all(client->md_headers);
+        client->md_headers = NULL;
+    }
+    if (client->md_access_token[0] != '\0') {
+        char md_auth_header[512];
+        snprintf(md_auth_header, sizeof(md_auth_header), "Authorization: Bearer %s", client->md_access_token);
+        client->md_headers = curl_slist_append(NULL, "Content-Type: application/json");
+        client->md_headers = curl_slist_append(client->md_headers, md_auth_header);
+    }
+
+    // Publish the header for the I/O thread's connection
+    ninja_mutex_lock(&client->lock);
+    memcpy(client->auth_header, auth_header, sizeof(client->auth_header));
+    client->auth_generation++;
+    ninja_mutex_unlock(&client->lock);
+
     return NINJA_OK;
 }
 
-ninja_error_t ninja_http_get(ninja_client_t* client, const char* endpoint, ninja_http_response_t* response) {
-    if (!client || !endpoint || !response) {
-        return NINJA_ERROR_INVALID_PARAM;
+// Helper function to count a finished transfer; SIZE_DOWNLOAD is the body as
+// received, before content decoding
+void ninja_http_record_transfer(ninja_client_t* client, CURL* curl, const ninja_http_response_t* response) {
+    curl_off_t wire_bytes = 0;
+    curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &wire_bytes);
+
+    ninja_atomic_fetch_add(&client->transfer_requests, 1);
+    ninja_atomic_fetch_add(&client->transfer_wire_bytes, (uint64_t)wire_bytes);
+    ninja_atomic_fetch_add(&client->transfer_body_bytes, (uint64_t)response->size);
+}
+
+// Helper function to pick the connection for the calling thread
+CURL* ninja_http_connection(ninja_client_t* client, struct curl_slist** headers) {
+    CURL* curl = ninja_io_connection(client, headers);
+    if (curl) {
+        return curl;
     }
 
-    // Initialize response
-    response->data = malloc(1);
+    *headers = client->headers;
+    return client->curl;
+}
+
+// Helper function to copy a header's value if the line is that header
+static void ninja_header_value(const char* line, size_t length, const char* name, char* value, size_t value_size) {
+    size_t name_length = strlen(name);
+    if (length <= name_length) {
+        return;
+    }
+    for (size_t i = 0; i < name_length; i++) {
+        char c = line[i];
+        if (c >= 'A' && c <= 'Z') {
+            c = (char)(c - 'A' + 'a');
+        }
+        if (c != name[i]) {
+            return;
+        }
+    }
+
+    size_t start = name_length;
+    while (start < length && line[start] == ' ') {
+        start++;
+    }
+    size_t end = length;
+    while (end > start && (line[end - 1] == '\r' || line[end - 1] == '\n' || line[end - 1] == ' ')) {
+        end--;
+    }
+    if (end - start < value_size) {
+        memcpy(value, line + start, end - start);
+        value[end - start] = '\0';
+    }
+}
+
+// HTTP header callback for libcurl: captures response validators
+static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata) {
+    ninja_http_validators_t* validators = (ninja_http_validators_t*)userdata;
+    size_t length = size * nitems;
+
+    ninja_header_value(buffer, length, "etag:", validators->etag, sizeof(validators->etag));
+    ninja_header_value(buffer, length, "last-modified:", validators->last_modified, sizeof(validators->last_modified));
+
+    return length;
+}
+
+typedef enum {
+    NINJA_HTTP_GET,
+    NINJA_HTTP_POST,
+    NINJA_HTTP_DELETE
+} ninja_http_method_t;
+
+// One request as issued by the caller, replayed unchanged on every attempt
+typedef struct {
+    ninja_http_method_t method;
+    const char* url;
+    const char* body;
+    size_t body_length;
+    struct curl_slist* headers;
+    bool idempotent;
+} ninja_http_call_t;
+
+// Helper function to point a handle at a call; every option a previous call
+// may have set is reset here
+static void ninja_http_prepare(CURL* curl,
+                              const ninja_http_call_t* call,
+                              ninja_http_validators_t* received,
+                              ninja_http_response_t* response) {
     response->size = 0;
     response->status_code = 0;
+    if (response->data) {
+        response->data[0] = '\0';
+    }
 
-    char url[512];
-    snprintf(url, sizeof(url), "%s/%s", client->base_url, endpoint);
-
-    curl_easy_setopt(client->curl, CURLOPT_URL, url);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
-    curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, client->headers);
-    curl_easy_setopt(client->curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curl, CURLOPT_URL, call->url);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, call->headers);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, received ? header_callback : NULL);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, received);
+
+    switch (call->method) {
+        case NINJA_HTTP_POST:
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL);
+            curl_easy_setopt(curl, CURLOPT_POST, 1L);
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDS, call->body ? call->body : "");
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)call->body_length);
+            break;
+        case NINJA_HTTP_DELETE:
+            curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
+            break;
+        default:
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL);
+            curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+            break;
+    }
+}
 
-    CURLcode res = curl_easy_perform(client->curl);
-    if (res != CURLE_OK) {
-        ninja_http_response_free(response);
-        return NINJA_ERROR_CONNECTION;
+// Helper function to run one attempt of a GET through the hedge, which keeps
+// the p95 it hedges at up to date
+static CURLcode ninja_http_hedged(ninja_client_t* client,
+                                 const ninja_http_call_t* call,
+                                 ninja_http_validators_t* received,
+                                 ninja_http_response_t* response,
+                                 CURL** winner) {
+    ninja_hedge_t* hedge = &client->hedge;
+    ninja_http_validators_t hedge_received;
+    ninja_http_response_t hedge_response;
+    memset(&hedge_received, 0, sizeof(hedge_received));
+    memset(&hedge_response, 0, sizeof(hedge_response));
+    hedge_response.data = malloc(1);
+    hedge_response.capacity = 1;
+
+    ninja_http_prepare(client->curl, call, received, response);
+
+    CURL* secondary = NULL;
+    if (hedge->delay_ms > 0) {
+        if (!hedge->secondary) {
+            hedge->secondary = curl_easy_duphandle(client->curl);
+        }
+        secondary = hedge_response.data ? hedge->secondary : NULL;
+        if (secondary) {
+            ninja_http_prepare(secondary, call, received ? &hedge_received : NULL, &hedge_response);
+        }
     }
 
-    curl_easy_getinfo(client->curl, CURLINFO_RESPONSE_CODE, &response->status_code);
+    int64_t start_ns = ninja_monotonic_ns();
+    CURLcode res = ninja_hedge_perform(hedge, client->curl, secondary, winner);
+    if (res == CURLE_OK) {
+        ninja_hedge_record(hedge, ninja_monotonic_ns() - start_ns);
+    }
 
-    if (response->status_code >= 400) {
-        return NINJA_ERROR_HTTP;
+    // The duplicate's answer becomes the caller's
+    if (*winner == secondary && secondary) {
+        ninja_http_response_t swap = *response;
+        *response = hedge_response;
+        hedge_response = swap;
+        if (received) {
+            *received = hedge_received;
+        }
     }
+    ninja_http_response_free(&hedge_response);
 
-    return NINJA_OK;
+    return res;
 }
 
-ninja_error_t ninja_http_post(ninja_client_t* client, const char* endpoint, const char* json_data, ninja_http_response_t* response) {
-    if (!client || !endpoint || !response) {
-        return NINJA_ERROR_INVALID_PARAM;
-    }
+// Helper function to map a failed transfer to the library's error
+static ninja_error_t ninja_http_error(CURLcode code) {
+    return code == CURLE_OPERATION_TIMEDOUT ? NINJA_ERROR_TIMEOUT : NINJA_ERROR_CONNECTION;
+}
 
+// Helper function to perform a call, retrying with jittered backoff while the
+// failure allows it. The URL is built from endpoint unless endpoint is NULL.
+// validators as in ninja_http_get_conditional.
+static ninja_error_t ninja_http_perform(ninja_client_t* client,
+                                       ninja_http_call_t* call,
+                                       const char* endpoint,
+                                       ninja_http_validators_t* validators,
+                                       ninja_http_response_t* response) {
     // Initialize response
     response->data = malloc(1);
     response->size = 0;
+    response->capacity = 1;
     response->status_code = 0;
 
+    CURL* curl = ninja_http_connection(client, &call->headers);
+
     char url[512];
-    snprintf(url, sizeof(url), "%s/%s", client->base_url, endpoint);
+    if (endpoint) {
+        snprintf(url, sizeof(url), "%s/%s", client->base_url, endpoint);
+        call->url = url;
+    }
 
-    curl_easy_setopt(client->curl, CURLOPT_URL, url);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
-    curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, client->headers);
-    curl_easy_setopt(client->curl, CURLOPT_POST, 1L);
+    // Conditional requests send the stored validators and capture the new ones
+    struct curl_slist* conditional = NULL;
+    ninja_http_validators_t received;
+    memset(&received, 0, sizeof(received));
+    if (validators) {
+        for (struct curl_slist* header = call->headers; header; header = header->next) {
+            conditional = curl_slist_append(conditional, header->data);
+        }
+
+        char line[160];
+        if (validators->etag[0] != '\0') {
+            snprintf(line, sizeof(line), "If-None-Match: %s", validators->etag);
+            conditional = curl_slist_append(conditional, line);
+        }
+        if (validators->last_modified[0] != '\0') {
+            snprintf(line, sizeof(line), "If-Modified-Since: %s", validators->last_modified);
+            conditional = curl_slist_append(conditional, line);
+        }
+        call->headers = conditional;
+    }
 
-    if (json_data) {
-        curl_easy_setopt(client->curl, CURLOPT_POSTFIELDS, json_data);
-        curl_easy_setopt(client->curl, CURLOPT_POSTFIELDSIZE, (long)strlen(json_data));
+    // Only the caller's connection hedges; the I/O thread never blocks on a GET
+    bool hedged = call->method == NINJA_HTTP_GET && client->hedge.enabled && curl == client->curl &&
+                  ninja_hedge_init(&client->hedge) == NINJA_OK;
+
+    // Part of the caller's trace, or a trace of its own
+    uint64_t trace_id = ninja_trace_active();
+    if (!trace_id) {
+        trace_id = ninja_trace_begin();
+    }
+
+    char method = call->method == NINJA_HTTP_POST ? 'P' : call->method == NINJA_HTTP_DELETE ? 'D' : 'G';
+    int64_t log_start = client->debug_log ? ninja_monotonic_ns() : 0;
+
+    CURLcode res = CURLE_OK;
+    int attempts = 0;
+    for (int attempt = 0;; attempt++) {
+        CURL* winner = curl;
+        attempts = attempt + 1;
+        uint64_t trace_start = ninja_trace_start(trace_id);
+        if (hedged) {
+            res = ninja_http_hedged(client, call, validators ? &received : NULL, response, &winner);
+        } else {
+            ninja_http_prepare(curl, call, validators ? &received : NULL, response);
+            res = curl_easy_perform(curl);
+        }
+        ninja_trace_transfer(trace_id, winner, trace_start);
+
+        if (res == CURLE_OK) {
+            curl_easy_getinfo(winner, CURLINFO_RESPONSE_CODE, &response->status_code);
+            ninja_http_record_transfer(client, winner, response);
+        }
+
+        // A request that may have reached the server is only resent when
+        // repeating it is harmless
+        bool retry = res != CURLE_OK || response->status_code >= 400;
+        retry = retry && (call->idempotent ? ninja_retry_transient(res, response->status_code)
+                                           : ninja_retry_unsent(res));
+        if (!retry || attempt >= client->retry.retries) {
+            break;
+        }
+        ninja_log_http(client->debug_log, NINJA_LOG_RETRY, method, call->url,
+                       res == CURLE_OK ? response->status_code : 0, res, 0, attempts);
+        ninja_sleep_ms((int)ninja_retry_backoff_ms(&client->retry, attempt));
+    }
+
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, NULL);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, NULL);
+    curl_slist_free_all(conditional);
+
+    if (client->debug_log) {
+        int64_t duration_ns = ninja_monotonic_ns() - log_start;
+        if (res != CURLE_OK) {
+            ninja_log_http(client->debug_log, NINJA_LOG_TRANSPORT, method, call->url, 0, res, duration_ns, attempts);
+        } else {
+            ninja_log_http(client->debug_log, NINJA_LOG_RESPONSE, method, call->url,
+                           response->status_code, (int64_t)response->size, duration_ns, attempts);
+        }
     }
 
-    CURLcode res = curl_easy_perform(client->curl);
     if (res != CURLE_OK) {
         ninja_http_response_free(response);
-        return NINJA_ERROR_CONNECTION;
+        return ninja_http_error(res);
     }
 
-    curl_easy_getinfo(client->curl, CURLINFO_RESPONSE_CODE, &response->status_code);
-
     if (response->status_code >= 400) {
         return NINJA_ERROR_HTTP;
     }
 
+    // A 304 keeps the validators that were sent
+    if (validators && response->status_code != 304) {
+        *validators = received;
+    }
+
     return NINJA_OK;
 }
 
-ninja_error_t ninja_http_delete(ninja_client_t* client, const char* endpoint, ninja_http_response_t* response) {
+ninja_error_t ninja_http_get(ninja_client_t* client, const char* endpoint, ninja_http_response_t* response) {
+    return ninja_http_get_conditional(client, endpoint, NULL, response);
+}
+
+ninja_error_t ninja_http_get_conditional(ninja_client_t* client,
+                                        const char* endpoint,
+                                        ninja_http_validators_t* validators,
+                                        ninja_http_response_t* response) {
     if (!client || !endpoint || !response) {
         return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Initialize response
-    response->data = malloc(1);
-    response->size = 0;
-    response->status_code = 0;
+    ninja_http_call_t call = { NINJA_HTTP_GET, NULL, NULL, 0, NULL, true };
+    return ninja_http_perform(client, &call, endpoint, validators, response);
+}
 
-    char url[512];
-    snprintf(url, sizeof(url), "%s/%s", client->base_url, endpoint);
+ninja_error_t ninja_http_post(ninja_client_t* client, const char* endpoint, const char* json_data, ninja_http_response_t* response) {
+    if (!client || !endpoint || !response) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
 
-    curl_easy_setopt(client->curl, CURLOPT_URL, url);
-    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
-    curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, client->headers);
-    curl_easy_setopt(client->curl, CURLOPT_CUSTOMREQUEST, "DELETE");
+    ninja_http_call_t call = { NINJA_HTTP_POST, NULL, json_data, json_data ? strlen(json_data) : 0, NULL, false };
+    return ninja_http_perform(client, &call, endpoint, NULL, response);
+}
 
-    CURLcode res = curl_easy_perform(client->curl);
-    if (res != CURLE_OK) {
-        ninja_http_response_free(response);
-        return NINJA_ERROR_CONNECTION;
+ninja_error_t ninja_http_post_prepared(ninja_client_t* client,
+                                      const char* url,
+                                      const char* body,
+                                      size_t body_length,
+                                      ninja_http_response_t* response) {
+    if (!client || !url || !response) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    curl_easy_getinfo(client->curl, CURLINFO_RESPONSE_CODE, &response->status_code);
+    ninja_http_call_t call = { NINJA_HTTP_POST, url, body, body_length, NULL, false };
+    return ninja_http_perform(client, &call, NULL, NULL, response);
+}
 
-    if (response->status_code >= 400) {
-        return NINJA_ERROR_HTTP;
+ninja_error_t ninja_http_post_idempotent(ninja_client_t* client,
+                                        const char* endpoint,
+                                        const char* json_data,
+                                        ninja_http_response_t* response) {
+    if (!client || !endpoint || !response) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    return NINJA_OK;
+    ninja_http_call_t call = { NINJA_HTTP_POST, NULL, json_data, json_data ? strlen(json_data) : 0, NULL, true };
+    return ninja_http_perform(client, &call, endpoint, NULL, response);
+}
+
+ninja_error_t ninja_http_delete(ninja_client_t* client, const char* endpoint, ninja_http_response_t* response) {
+    if (!client || !endpoint || !response) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_http_call_t call = { NINJA_HTTP_DELETE, NULL, NULL, 0, NULL, true };
+    return ninja_http_perform(client, &call, endpoint, NULL, response);
 }
 
 void ninja_http_response_free(ninja_http_response_t* response) {
@@ -234,6 +654,7 @@ void ninja_http_response_free(ninja_http_response_t* response) {
         free(response->data);
         response->data = NULL;
         response->size = 0;
+        response->capacity = 0;
     }
 }
 
@@ -257,4 +678,5 @@ void ninja_free_array(void* array) {
     if (array) {
         free(array);
     }
-}
\ No newline at end of file
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Minimal atomics for lock-free shared state. GCC/Clang use the __atomic
+// builtins; MSVC relies on x86/x64 ordering plus compiler barriers and the
+// Interlocked intrinsics.
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+
+    static inline uint64_t ninja_atomic_load_acquire(const volatile uint64_t* p) {
+        uint64_t value = *p;
+        _ReadWriteBarrier();
+        return value;
+    }
+
+    static inline uint64_t ninja_atomic_load_relaxed(const volatile uint64_t* p) {
+        return *p;
+    }
+
+    static inline void ninja_atomic_store_release(volatile uint64_t* p, uint64_t value) {
+        _ReadWriteBarrier();
+        *p = value;
+    }
+
+    static inline void ninja_atomic_store_relaxed(volatile uint64_t* p, uint64_t value) {
+        *p = value;
+    }
+
+    static inline uint64_t ninja_atomic_fetch_add(volatile uint64_t* p, uint64_t value) {
+        return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)value);
+    }
+
+    static inline bool ninja_atomic_compare_exchange(volatile uint64_t* p, uint64_t* expected, uint64_t desired) {
+        uint64_t previous = (uint64_t)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)desired, (__int64)*expected);
+        if (previous == *expected) {
+            return true;
+        }
+        *expected = previous;
+        return false;
+    }
+
+    // Locked read-modify-write on a local: a full fence on x86 and x64
+    static inline void ninja_atomic_full_barrier(void) {
+        volatile long barrier = 0;
+        _InterlockedOr(&barrier, 0);
+    }
+
+    #define ninja_atomic_fence_acquire() _ReadWriteBarrier()
+    #define ninja_atomic_fence_release() _ReadWriteBarrier()
+    #define ninja_atomic_fence_seq_cst() ninja_atomic_full_barrier()
+    #define ninja_cpu_relax() _mm_pause()
+#else
+    static inline uint64_t ninja_atomic_load_acquire(const volatile uint64_t* p) {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+
+    static inline uint64_t ninja_atomic_load_relaxed(const volatile uint64_t* p) {
+        return __atomic_load_n(p, __ATOMIC_RELAXED);
+    }
+
+    static inline void ninja_atomic_store_release(volatile uint64_t* p, uint64_t value) {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+
+    static inline void ninja_atomic_store_relaxed(volatile uint64_t* p, uint64_t value) {
+        __atomic_store_n(p, value, __ATOMIC_RELAXED);
+    }
+
+    static inline uint64_t ninja_atomic_fetch_add(volatile uint64_t* p, uint64_t value) {
+        return __atomic_fetch_add(p, value, __ATOMIC_ACQ_REL);
+    }
+
+    static inline bool ninja_atomic_compare_exchange(volatile uint64_t* p, uint64_t* expected, uint64_t desired) {
+        return __atomic_compare_exchange_n(p, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    #define ninja_atomic_fence_acquire() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define ninja_atomic_fence_release() __atomic_thread_fence(__ATOMIC_RELEASE)
+    #define ninja_atomic_fence_seq_cst() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+    #if defined(__x86_64__) || defined(__i386__)
+        #define ninja_cpu_relax() __builtin_ia32_pause()
+    #elif defined(__aarch64__)
+        #define ninja_cpu_relax() __asm__ __volatile__("yield")
+    #else
+        #define ninja_cpu_relax() ((void)0)
+    #endif
+#endif
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NINJA_BAR_NO_SLOT UINT32_MAX
+
+// Bars being built, structure of arrays: entry slot * series_count + series
+// of each array belongs to one contract and series. A series entry with no
+// trades has no open bar.
+typedef struct {
+    int64_t* start_ns;
+    int64_t* end_ns;
+    double* open;
+    double* high;
+    double* low;
+    double* close;
+    int64_t* volume;
+    int64_t* trades;
+} ninja_bar_state_t;
+
+struct ninja_bar_aggregator {
+    ninja_bar_series_t* series;
+    size_t series_count;
+
+    // contract_id -> slot, open addressing. Keys and slots are stored in
+    // separate arrays so probing only touches keys; slot + 1, 0 when empty.
+    int32_t* keys;
+    uint32_t* slots;
+    size_t map_capacity;
+
+    // Per slot: its contract, and the bars being built
+    int32_t* contracts;
+    size_t contract_count;
+    size_t contract_capacity;
+    ninja_bar_state_t state;
+
+    // Last lookup; trades tend to come in runs of one contract
+    int32_t last_contract;
+    uint32_t last_slot;
+
+    // Completed bars, oldest at head
+    ninja_bar_t* completed;
+    size_t completed_head;
+    size_t completed_tail;
+    size_t completed_capacity;
+};
+
+ninja_bar_aggregator_t* ninja_bar_aggregator_create(const ninja_bar_series_t* series, size_t series_count) {
+    if (!series || series_count == 0 || series_count > UINT32_MAX) {
+        return NULL;
+    }
+    for (size_t i = 0; i < series_count; i++) {
+        if ((unsigned)series[i].kind > NINJA_BAR_VOLUME || series[i].size <= 0) {
+            return NULL;
+        }
+    }
+
+    ninja_bar_aggregator_t* aggregator = calloc(1, sizeof(ninja_bar_aggregator_t));
+    if (!aggregator) {
+        return NULL;
+    }
+    aggregator->series = malloc(series_count * sizeof(ninja_bar_series_t));
+    if (!aggregator->series) {
+        free(aggregator);
+        return NULL;
+    }
+    memcpy(aggregator->series, series, series_count * sizeof(ninja_bar_series_t));
+    aggregator->series_count = series_count;
+    aggregator->last_slot = NINJA_BAR_NO_SLOT;
+
+    return aggregator;
+}
+
+void ninja_bar_aggregator_destroy(ninja_bar_aggregator_t* aggregator) {
+    if (!aggregator) {
+        return;
+    }
+
+    ninja_bar_state_t* state = &aggregator->state;
+    free(state->start_ns);
+    free(state->end_ns);
+    free(state->open);
+    free(state->high);
+    free(state->low);
+    free(state->close);
+    free(state->volume);
+    free(state->trades);
+    free(aggregator->series);
+    free(aggregator->keys);
+    free(aggregator->slots);
+    free(aggregator->contracts);
+    free(aggregator->completed);
+    free(aggregator);
+}
+
+static size_t ninja_bar_hash(int32_t contract_id, size_t capacity) {
+    uint32_t hash = (uint32_t)contract_id * 2654435761u;
+    return (size_t)((hash ^ (hash >> 16)) & (uint32_t)(capacity - 1));
+}
+
+// Helper function to rebuild the contract map at a new power-of-two capacity
+static bool ninja_bar_map_grow(ninja_bar_aggregator_t* aggregator) {
+    size_t capacity = aggregator->map_capacity ? aggregator->map_capacity * 2 : 64;
+    int32_t* keys = calloc(capacity, sizeof(int32_t));
+    uint32_t* slots = calloc(capacity, sizeof(uint32_t));
+    if (!keys || !slots) {
+        free(keys);
+        free(slots);
+        return false;
+    }
+
+    for (size_t slot = 0; slot < aggregator->contract_count; slot++) {
+        size_t i = ninja_bar_hash(aggregator->contracts[slot], capacity);
+        while (slots[i] != 0) {
+            i = (i + 1) & (capacity - 1);
+        }
+        keys[i] = aggregator->contracts[slot];
+        slots[i] = (uint32_t)slot + 1;
+    }
+
+    free(aggregator->keys);
+    free(aggregator->slots);
+    aggregator->keys = keys;
+    aggregator->slots = slots;
+    aggregator->map_capacity = capacity;
+    return true;
+}
+
+// Helper function to grow every per-slot array together
+static bool ninja_bar_state_grow(ninja_bar_aggregator_t* aggregator) {
+    size_t capacity = aggregator->contract_capacity ? aggregator->contract_capacity * 2 : 16;
+    size_t entries = capacity * aggregator->series_count;
+    ninja_bar_state_t* state = &aggregator->state;
+
+    int32_t* contracts = realloc(aggregator->contracts, capacity * sizeof(int32_t));
+    if (contracts) {
+        aggregator->contracts = contracts;
+    }
+    void** arrays[] = {
+        (void**)&state->start_ns, (void**)&state->end_ns, (void**)&state->open, (void**)&state->high,
+        (void**)&state->low, (void**)&state->close, (void**)&state->volume, (void**)&state->trades
+    };
+    bool grown = contracts != NULL;
+    for (size_t i = 0; grown && i < sizeof(arrays) / sizeof(arrays[0]); i++) {
+        void* array = realloc(*arrays[i], entries * 8);
+        if (!array) {
+            grown = false;
+            break;
+        }
+        *arrays[i] = array;
+    }
+    if (!grown) {
+        return false;
+    }
+
+    aggregator->contract_capacity = capacity;
+    return true;
+}
+
+// Helper function to find a contract's slot; *empty is where it would go
+static uint32_t ninja_bar_find(const ninja_bar_aggregator_t* aggregator, int32_t contract_id, size_t* empty) {
+    *empty = 0;
+    if (aggregator->map_capacity == 0) {
+        return NINJA_BAR_NO_SLOT;
+    }
+
+    size_t mask = aggregator->map_capacity - 1;
+    size_t i = ninja_bar_hash(contract_id, aggregator->map_capacity);
+    for (; aggregator->slots[i] != 0; i = (i + 1) & mask) {
+        if (aggregator->keys[i] == contract_id) {
+            return aggregator->slots[i] - 1;
+        }
+    }
+    *empty = i;
+    return NINJA_BAR_NO_SLOT;
+}
+
+// Helper function to find a contract's slot, adding it on first sight
+static uint32_t ninja_bar_slot(ninja_bar_aggregator_t* aggregator, int32_t contract_id) {
+    if (aggregator->last_slot != NINJA_BAR_NO_SLOT && aggregator->last_contract == contract_id) {
+        return aggregator->last_slot;
+    }
+
+    size_t i;
+    uint32_t found = ninja_bar_find(aggregator, contract_id, &i);
+    if (found != NINJA_BAR_NO_SLOT) {
+        aggregator->last_contract = contract_id;
+        aggregator->last_slot = found;
+        return found;
+    }
+
+    // New contract; the map stays at most half full
+    if (aggregator->contract_count == aggregator->contract_capacity && !ninja_bar_state_grow(aggregator)) {
+        return NINJA_BAR_NO_SLOT;
+    }
+    if ((aggregator->contract_count + 1) * 2 > aggregator->map_capacity) {
+        if (!ninja_bar_map_grow(aggregator)) {
+            return NINJA_BAR_NO_SLOT;
+        }
+        ninja_bar_find(aggregator, contract_id, &i);
+    }
+
+    uint32_t slot = (uint32_t)aggregator->contract_count++;
+    aggregator->keys[i] = contract_id;
+    aggregator->slots[i] = slot + 1;
+    aggregator->contracts[slot] = contract_id;
+    memset(&aggregator->state.trades[(size_t)slot * aggregator->series_count], 0,
+           aggregator->series_count * sizeof(int64_t));
+
+    aggregator->last_contract = contract_id;
+    aggregator->last_slot = slot;
+    return slot;
+}
+
+// Helper function to copy out one entry's bar
+static void ninja_bar_get(const ninja_bar_aggregator_t* aggregator, size_t entry, ninja_bar_t* bar) {
+    const ninja_bar_state_t* state = &aggregator->state;
+    bar->contract_id = aggregator->contracts[entry / aggregator->series_count];
+    bar->series = (uint32_t)(entry % aggregator->series_count);
+    bar->start_ns = state->start_ns[entry];
+    bar->end_ns = state->end_ns[entry];
+    bar->open = state->open[entry];
+    bar->high = state->high[entry];
+    bar->low = state->low[entry];
+    bar->close = state->close[entry];
+    bar->volume = state->volume[entry];
+    bar->trades = state->trades[entry];
+}
+
+// Helper function to queue an entry's bar as completed and clear the entry
+static bool ninja_bar_complete(ninja_bar_aggregator_t* aggregator, size_t entry) {
+    if (aggregator->completed_tail == aggregator->completed_capacity) {
+        // Reclaim drained space before growing
+        size_t pending = aggregator->completed_tail - aggregator->completed_head;
+        if (aggregator->completed_head > 0 && pending < aggregator->completed_capacity / 2) {
+            memmove(aggregator->completed, aggregator->completed + aggregator->completed_head,
+                    pending * sizeof(ninja_bar_t));
+        } else {
+            size_t capacity = aggregator->completed_capacity ? aggregator->completed_capacity * 2 : 256;
+            ninja_bar_t* completed = realloc(aggregator->completed, capacity * sizeof(ninja_bar_t));
+            if (!completed) {
+                return false;
+            }
+            aggregator->completed = completed;
+            aggregator->completed_capacity = capacity;
+            memmove(aggregator->completed, aggregator->completed + aggregator->completed_head,
+                    pending * sizeof(ninja_bar_t));
+        }
+        aggregator->completed_head = 0;
+        aggregator->completed_tail = pending;
+    }
+
+    ninja_bar_get(aggregator, entry, &aggregator->completed[aggregator->completed_tail++]);
+    aggregator->state.trades[entry] = 0;
+    return true;
+}
+
+// Helper function to add a trade (or, for volume bars, part of one) to an
+// entry, opening a bar if none is
+static inline void ninja_bar_update(ninja_bar_state_t* state, size_t entry, int64_t timestamp_ns, double price, int64_t size) {
+    if (state->trades[entry] == 0) {
+        state->start_ns[entry] = timestamp_ns;
+        state->end_ns[entry] = timestamp_ns;
+        state->open[entry] = price;
+        state->high[entry] = price;
+        state->low[entry] = price;
+        state->volume[entry] = 0;
+    }
+    state->high[entry] = price > state->high[entry] ? price : state->high[entry];
+    state->low[entry] = price < state->low[entry] ? price : state->low[entry];
+    state->close[entry] = price;
+    state->end_ns[entry] = timestamp_ns > state->end_ns[entry] ? timestamp_ns : state->end_ns[entry];
+    state->volume[entry] += size;
+    state->trades[entry]++;
+}
+
+ninja_error_t ninja_bar_add_trade(ninja_bar_aggregator_t* aggregator,
+                                 int contract_id,
+                                 int64_t timestamp_ns,
+                                 double price,
+                                 int32_t size) {
+    if (!aggregator || size < 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t slot = ninja_bar_slot(aggregator, contract_id);
+    if (slot == NINJA_BAR_NO_SLOT) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_bar_state_t* state = &aggregator->state;
+    size_t entry = (size_t)slot * aggregator->series_count;
+    for (size_t s = 0; s < aggregator->series_count; s++, entry++) {
+        int64_t bar_size = aggregator->series[s].size;
+        switch (aggregator->series[s].kind) {
+            case NINJA_BAR_TIME: {
+                // Intervals are [k * size, (k + 1) * size); a trade past the
+                // open one closes it
+                if (state->trades[entry] > 0 && timestamp_ns >= state->start_ns[entry] + bar_size &&
+                    !ninja_bar_complete(aggregator, entry)) {
+                    return NINJA_ERROR_MEMORY;
+                }
+                bool opening = state->trades[entry] == 0;
+                ninja_bar_update(state, entry, timestamp_ns, price, size);
+                if (opening) {
+                    int64_t start = timestamp_ns - timestamp_ns % bar_size;
+                    state->start_ns[entry] = timestamp_ns % bar_size < 0 ? start - bar_size : start;
+                }
+                state->end_ns[entry] = state->start_ns[entry] + bar_size;
+                break;
+            }
+            case NINJA_BAR_TICKS:
+                ninja_bar_update(state, entry, timestamp_ns, price, size);
+                if (state->trades[entry] >= bar_size && !ninja_bar_complete(aggregator, entry)) {
+                    return NINJA_ERROR_MEMORY;
+                }
+                break;
+            case NINJA_BAR_VOLUME: {
+                // Fill the open bar exactly, carrying the rest into new ones
+                int64_t remaining = size;
+                do {
+                    int64_t room = bar_size - (state->trades[entry] > 0 ? state->volume[entry] : 0);
+                    int64_t part = remaining < room ? remaining : room;
+                    ninja_bar_update(state, entry, timestamp_ns, price, part);
+                    remaining -= part;
+                    if (state->volume[entry] >= bar_size && !ninja_bar_complete(aggregator, entry)) {
+                        return NINJA_ERROR_MEMORY;
+                    }
+                } while (remaining > 0);
+                break;
+            }
+        }
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_bar_add_trades(ninja_bar_aggregator_t* aggregator, const ninja_trade_t* trades, size_t count) {
+    if (!aggregator || (!trades && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_trade_t* trade = &trades[i];
+        ninja_error_t result = ninja_bar_add_trade(aggregator, trade->contract_id, trade->timestamp_ns, trade->price, trade->size);
+        if (result != NINJA_OK) {
+            return result;
+        }
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_bar_flush(ninja_bar_aggregator_t* aggregator, int64_t now_ns) {
+    if (!aggregator) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t entries = aggregator->contract_count * aggregator->series_count;
+    for (size_t entry = 0; entry < entries; entry++) {
+        const ninja_bar_series_t* series = &aggregator->series[entry % aggregator->series_count];
+        if (series->kind == NINJA_BAR_TIME && aggregator->state.trades[entry] > 0 &&
+            aggregator->state.end_ns[entry] <= now_ns && !ninja_bar_complete(aggregator, entry)) {
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_bar_drain(ninja_bar_aggregator_t* aggregator, ninja_bar_t* bars, size_t max, size_t* count) {
+    if (!aggregator || (!bars && max > 0) || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t pending = aggregator->completed_tail - aggregator->completed_head;
+    size_t copied = pending < max ? pending : max;
+    if (copied > 0) {
+        memcpy(bars, aggregator->completed + aggregator->completed_head, copied * sizeof(ninja_bar_t));
+    }
+    aggregator->completed_head += copied;
+    if (aggregator->completed_head == aggregator->completed_tail) {
+        aggregator->completed_head = 0;
+        aggregator->completed_tail = 0;
+    }
+
+    *count = copied;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_bar_current(ninja_bar_aggregator_t* aggregator,
+                               int contract_id,
+                               uint32_t series,
+                               ninja_bar_t* bar) {
+    if (!aggregator || !bar || series >= aggregator->series_count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t empty;
+    uint32_t slot = ninja_bar_find(aggregator, contract_id, &empty);
+    size_t entry = (size_t)slot * aggregator->series_count + series;
+    if (slot == NINJA_BAR_NO_SLOT || aggregator->state.trades[entry] == 0) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    ninja_bar_get(aggregator, entry, bar);
+    return NINJA_OK;
+}
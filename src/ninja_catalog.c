@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_catalog.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define NINJA_CATALOG_MIN_INDEX 16
+#define NINJA_CATALOG_MIN_RECORDS 64
+
+// Helper function to hash a symbol with FNV-1a
+static uint32_t ninja_catalog_hash_symbol(const char* symbol) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(((ninja_contract_t*)0)->symbol) && symbol[i]; i++) {
+        hash = (hash ^ (unsigned char)symbol[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Helper function to hash a contract id
+static uint32_t ninja_catalog_hash_id(int contract_id) {
+    uint32_t hash = (uint32_t)contract_id * 0x9E3779B1u;
+    return hash ^ (hash >> 15);
+}
+
+// Helper function to checksum the indexes a word at a time
+static uint64_t ninja_catalog_checksum(uint64_t hash, const void* data, size_t length) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Helper function to size an index for count records at 50% load
+static size_t ninja_catalog_index_capacity(size_t count) {
+    size_t capacity = NINJA_CATALOG_MIN_INDEX;
+    while (capacity < count * 2) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// Helper function to add record i to both indexes
+static void ninja_catalog_index_insert(ninja_catalog_t* catalog, size_t i) {
+    size_t mask = catalog->index_capacity - 1;
+
+    size_t slot = ninja_catalog_hash_symbol(catalog->records[i].symbol) & mask;
+    while (catalog->symbol_index[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    catalog->symbol_index[slot] = (uint32_t)(i + 1);
+
+    slot = ninja_catalog_hash_id(catalog->records[i].contract_id) & mask;
+    while (catalog->id_index[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    catalog->id_index[slot] = (uint32_t)(i + 1);
+}
+
+// Helper function to rebuild both heap indexes with the given capacity
+static ninja_error_t ninja_catalog_rebuild_index(ninja_catalog_t* catalog, size_t index_capacity) {
+    uint32_t* symbol_index = calloc(index_capacity, sizeof(uint32_t));
+    uint32_t* id_index = calloc(index_capacity, sizeof(uint32_t));
+    if (!symbol_index || !id_index) {
+        free(symbol_index);
+        free(id_index);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    free(catalog->symbol_index);
+    free(catalog->id_index);
+    catalog->symbol_index = symbol_index;
+    catalog->id_index = id_index;
+    catalog->index_capacity = index_capacity;
+
+    for (size_t i = 0; i < catalog->count; i++) {
+        ninja_catalog_index_insert(catalog, i);
+    }
+    return NINJA_OK;
+}
+
+// Helper function to copy a mapped snapshot to the heap before it is modified
+static ninja_error_t ninja_catalog_materialize(ninja_catalog_t* catalog) {
+    if (catalog->capacity > 0) {
+        return NINJA_OK;
+    }
+
+    size_t capacity = catalog->count * 2;
+    if (capacity < NINJA_CATALOG_MIN_RECORDS) {
+        capacity = NINJA_CATALOG_MIN_RECORDS;
+    }
+
+    ninja_contract_t* records = malloc(capacity * sizeof(ninja_contract_t));
+    if (!records) {
+        return NINJA_ERROR_MEMORY;
+    }
+    if (catalog->count > 0) {
+        memcpy(records, catalog->records, catalog->count * sizeof(ninja_contract_t));
+    }
+
+    // The mapped indexes are not heap memory and must not be freed
+    catalog->symbol_index = NULL;
+    catalog->id_index = NULL;
+    catalog->records = records;
+    catalog->capacity = capacity;
+    ninja_mmap_close(&catalog->map);
+
+    return ninja_catalog_rebuild_index(catalog, ninja_catalog_index_capacity(catalog->count));
+}
+
+// Helper function to validate a mapped snapshot and point the catalog at it
+static bool ninja_catalog_attach(ninja_catalog_t* catalog) {
+    const unsigned char* data = (const unsigned char*)catalog->map.data;
+    size_t size = catalog->map.size;
+    if (size < sizeof(ninja_catalog_header_t)) {
+        return false;
+    }
+
+    const ninja_catalog_header_t* header = (const ninja_catalog_header_t*)data;
+    size_t count = header->count;
+    size_t index_capacity = header->index_capacity;
+    if (memcmp(header->magic, NINJA_CATALOG_MAGIC, sizeof(NINJA_CATALOG_MAGIC)) != 0 ||
+        header->version != NINJA_CATALOG_VERSION ||
+        header->record_size != sizeof(ninja_contract_t) ||
+        index_capacity < NINJA_CATALOG_MIN_INDEX ||
+        (index_capacity & (index_capacity - 1)) != 0 ||
+        index_capacity < count * 2) {
+        return false;
+    }
+
+    size_t records_size = count * sizeof(ninja_contract_t);
+    size_t index_size = index_capacity * sizeof(uint32_t);
+    if (size != sizeof(ninja_catalog_header_t) + records_size + 2 * index_size) {
+        return false;
+    }
+
+    const unsigned char* payload = data + sizeof(ninja_catalog_header_t);
+    if (ninja_catalog_checksum(14695981039346656037ULL, payload + records_size, 2 * index_size) != header->checksum) {
+        return false;
+    }
+
+    catalog->records = (ninja_contract_t*)payload;
+    catalog->symbol_index = (uint32_t*)(payload + records_size);
+    catalog->id_index = (uint32_t*)(payload + records_size + index_size);
+    catalog->count = count;
+    catalog->index_capacity = index_capacity;
+    catalog->created_ns = header->created_ns;
+    return true;
+}
+
+ninja_error_t ninja_catalog_open(ninja_catalog_t* catalog, const char* path, int64_t max_age_ns) {
+    if (!catalog || !path || strlen(path) >= sizeof(catalog->path)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(catalog, 0, sizeof(ninja_catalog_t));
+    strncpy(catalog->path, path, sizeof(catalog->path) - 1);
+    catalog->max_age_ns = max_age_ns;
+
+    int64_t now_ns = ninja_wall_clock_ns();
+    catalog->created_ns = now_ns;
+
+    if (ninja_mmap_open(&catalog->map, path, 0, false) != NINJA_OK) {
+        return NINJA_OK;
+    }
+
+    if (!ninja_catalog_attach(catalog)) {
+        ninja_mmap_close(&catalog->map);
+        catalog->records = NULL;
+        catalog->symbol_index = NULL;
+        catalog->id_index = NULL;
+        catalog->count = 0;
+        catalog->index_capacity = 0;
+        catalog->created_ns = now_ns;
+        return NINJA_OK;
+    }
+
+    // Serve an aged snapshot as is and queue every contract for refresh
+    if (max_age_ns > 0 && now_ns - catalog->created_ns > max_age_ns && catalog->count > 0) {
+        catalog->stale_ids = malloc(catalog->count * sizeof(int));
+        if (!catalog->stale_ids) {
+            return NINJA_ERROR_MEMORY;
+        }
+        for (size_t i = 0; i < catalog->count; i++) {
+            catalog->stale_ids[i] = catalog->records[i].contract_id;
+        }
+        catalog->stale_count = catalog->count;
+    }
+
+    return NINJA_OK;
+}
+
+void ninja_catalog_close(ninja_catalog_t* catalog) {
+    if (!catalog) {
+        return;
+    }
+
+    if (catalog->capacity > 0) {
+        free(catalog->records);
+        free(catalog->symbol_index);
+        free(catalog->id_index);
+    }
+    ninja_mmap_close(&catalog->map);
+    free(catalog->stale_ids);
+    memset(catalog, 0, sizeof(ninja_catalog_t));
+}
+
+const ninja_contract_t* ninja_catalog_find_symbol(const ninja_catalog_t* catalog, const char* symbol) {
+    if (!catalog || !symbol || catalog->index_capacity == 0) {
+        return NULL;
+    }
+
+    size_t mask = catalog->index_capacity - 1;
+    size_t slot = ninja_catalog_hash_symbol(symbol) & mask;
+    uint32_t entry;
+    while ((entry = catalog->symbol_index[slot]) != 0 && entry <= catalog->count) {
+        const ninja_contract_t* contract = &catalog->records[entry - 1];
+        if (strncmp(contract->symbol, symbol, sizeof(contract->symbol)) == 0) {
+            return contract;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+const ninja_contract_t* ninja_catalog_find_id(const ninja_catalog_t* catalog, int contract_id) {
+    if (!catalog || catalog->index_capacity == 0) {
+        return NULL;
+    }
+
+    size_t mask = catalog->index_capacity - 1;
+    size_t slot = ninja_catalog_hash_id(contract_id) & mask;
+    uint32_t entry;
+    while ((entry = catalog->id_index[slot]) != 0 && entry <= catalog->count) {
+        const ninja_contract_t* contract = &catalog->records[entry - 1];
+        if (contract->contract_id == contract_id) {
+            return contract;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+ninja_error_t ninja_catalog_put(ninja_catalog_t* catalog, const ninja_contract_t* contract) {
+    if (!catalog || !contract || contract->contract_id <= 0 || contract->symbol[0] == '\0') {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_error_t result = ninja_catalog_materialize(catalog);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    catalog->dirty = true;
+    catalog->revision++;
+
+    ninja_contract_t* existing = (ninja_contract_t*)ninja_catalog_find_id(catalog, contract->contract_id);
+    if (existing) {
+        bool renamed = strncmp(existing->symbol, contract->symbol, sizeof(existing->symbol)) != 0;
+        *existing = *contract;
+        return renamed ? ninja_catalog_rebuild_index(catalog, catalog->index_capacity) : NINJA_OK;
+    }
+
+    if (catalog->count == catalog->capacity) {
+        size_t capacity = catalog->capacity * 2;
+        ninja_contract_t* records = realloc(catalog->records, capacity * sizeof(ninja_contract_t));
+        if (!records) {
+            return NINJA_ERROR_MEMORY;
+        }
+        catalog->records = records;
+        catalog->capacity = capacity;
+    }
+
+    catalog->records[catalog->count++] = *contract;
+    if (catalog->count * 2 > catalog->index_capacity) {
+        return ninja_catalog_rebuild_index(catalog, catalog->index_capacity * 2);
+    }
+    ninja_catalog_index_insert(catalog, catalog->count - 1);
+    return NINJA_OK;
+}
+
+void ninja_catalog_mark_refreshed(ninja_catalog_t* catalog, size_t count) {
+    if (!catalog || count == 0) {
+        return;
+    }
+
+    catalog->stale_count -= count < catalog->stale_count ? count : catalog->stale_count;
+    if (catalog->stale_count == 0) {
+        // Every record is now current, so the snapshot is as new as the refresh
+        catalog->created_ns = ninja_wall_clock_ns();
+        catalog->dirty = true;
+    }
+}
+
+ninja_error_t ninja_catalog_save(ninja_catalog_t* catalog) {
+    if (!catalog || catalog->path[0] == '\0') {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Release the mapping so the snapshot can be replaced on every platform
+    ninja_error_t result = ninja_catalog_materialize(catalog);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    size_t records_size = catalog->count * sizeof(ninja_contract_t);
+    size_t index_size = catalog->index_capacity * sizeof(uint32_t);
+
+    ninja_catalog_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, NINJA_CATALOG_MAGIC, sizeof(NINJA_CATALOG_MAGIC));
+    header.version = NINJA_CATALOG_VERSION;
+    header.record_size = sizeof(ninja_contract_t);
+    header.count = (uint32_t)catalog->count;
+    header.index_capacity = (uint32_t)catalog->index_capacity;
+    header.created_ns = catalog->created_ns;
+    header.checksum = ninja_catalog_checksum(14695981039346656037ULL, catalog->symbol_index, index_size);
+    header.checksum = ninja_catalog_checksum(header.checksum, catalog->id_index, index_size);
+
+    char temp_path[sizeof(catalog->path) + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", catalog->path);
+
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   (records_size == 0 || fwrite(catalog->records, records_size, 1, file) == 1) &&
+                   fwrite(catalog->symbol_index, index_size, 1, file) == 1 &&
+                   fwrite(catalog->id_index, index_size, 1, file) == 1;
+    if (fclose(file) != 0 || !written) {
+        remove(temp_path);
+        return NINJA_ERROR_MEMORY;
+    }
+
+#ifdef _WIN32
+    remove(catalog->path);
+#endif
+    if (rename(temp_path, catalog->path) != 0) {
+        remove(temp_path);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    catalog->dirty = false;
+    return NINJA_OK;
+}
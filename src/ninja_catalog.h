@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_mmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NINJA_CATALOG_MAGIC "NJCATLG"
+#define NINJA_CATALOG_VERSION 1
+
+// On-disk catalog header. The file is the header followed by the contract
+// records and the symbol and id hash indexes, all in native byte order.
+// Snapshots are replaced by rename, so only the indexes are checksummed;
+// hashing every record would fault in the whole file on load.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;       // sizeof(ninja_contract_t) of the writer
+    uint32_t count;
+    uint32_t index_capacity;    // Slots in each index, a power of two
+    int64_t created_ns;         // Wall clock time of the oldest record
+    uint64_t checksum;          // Hash of the symbol and id indexes
+    uint8_t reserved[24];
+} ninja_catalog_header_t;
+
+// Contract catalog. Records and indexes point into the mapped snapshot until
+// the first update, which moves them to the heap.
+typedef struct {
+    ninja_mmap_t map;
+    ninja_contract_t* records;
+    uint32_t* symbol_index;     // Record index + 1 per slot, 0 when empty
+    uint32_t* id_index;
+    size_t count;
+    size_t capacity;            // Heap record capacity, 0 while mapped
+    size_t index_capacity;
+    int64_t created_ns;
+    int64_t max_age_ns;
+
+    // Contract ids waiting to be refreshed from the server, taken from the end
+    int* stale_ids;
+    size_t stale_count;
+
+    uint64_t revision;          // Bumped by every update
+    bool dirty;
+    char path[512];
+} ninja_catalog_t;
+
+// Load the snapshot at path. A missing or invalid file yields an empty catalog
+// that is written to path on save.
+ninja_error_t ninja_catalog_open(ninja_catalog_t* catalog, const char* path, int64_t max_age_ns);
+void ninja_catalog_close(ninja_catalog_t* catalog);
+
+const ninja_contract_t* ninja_catalog_find_symbol(const ninja_catalog_t* catalog, const char* symbol);
+const ninja_contract_t* ninja_catalog_find_id(const ninja_catalog_t* catalog, int contract_id);
+
+// Insert or replace a contract
+ninja_error_t ninja_catalog_put(ninja_catalog_t* catalog, const ninja_contract_t* contract);
+
+// Drop the last count ids of the stale queue once they have been refreshed
+void ninja_catalog_mark_refreshed(ninja_catalog_t* catalog, size_t count);
+
+// Write the catalog to a temporary file and rename it over the snapshot
+ninja_error_t ninja_catalog_save(ninja_catalog_t* catalog);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_chart.h"
+#include "ninja_client.h"
+#include "ninja_pipeline.h"
+#include "cJSON.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NINJA_CHART_PARALLEL_REQUESTS 4
+#define NINJA_HOUR_NS 3600000000000LL
+#define NINJA_DAY_NS (24 * NINJA_HOUR_NS)
+
+// Column order is the decode order below
+static const ninja_column_t ninja_chart_tick_columns[] = {
+    { "timestamp_ns", NINJA_COLUMN_INT64 },
+    { "price", NINJA_COLUMN_DOUBLE },
+    { "size", NINJA_COLUMN_INT64 },
+    { "bid", NINJA_COLUMN_DOUBLE },
+    { "ask", NINJA_COLUMN_DOUBLE }
+};
+
+static const ninja_column_t ninja_chart_bar_columns[] = {
+    { "timestamp_ns", NINJA_COLUMN_INT64 },
+    { "open", NINJA_COLUMN_DOUBLE },
+    { "high", NINJA_COLUMN_DOUBLE },
+    { "low", NINJA_COLUMN_DOUBLE },
+    { "close", NINJA_COLUMN_DOUBLE },
+    { "volume", NINJA_COLUMN_INT64 }
+};
+
+const ninja_column_t* ninja_chart_columns(ninja_chart_type_t type, size_t* count) {
+    if (type == NINJA_CHART_TICKS) {
+        *count = sizeof(ninja_chart_tick_columns) / sizeof(ninja_chart_tick_columns[0]);
+        return ninja_chart_tick_columns;
+    }
+    *count = sizeof(ninja_chart_bar_columns) / sizeof(ninja_chart_bar_columns[0]);
+    return ninja_chart_bar_columns;
+}
+
+void ninja_chart_rows_free(ninja_chart_rows_t* rows) {
+    if (!rows) {
+        return;
+    }
+
+    for (size_t i = 0; i < NINJA_COLUMNAR_MAX_COLUMNS; i++) {
+        free(rows->values[i]);
+    }
+    memset(rows, 0, sizeof(ninja_chart_rows_t));
+}
+
+// Helper function to make room for one more row in every column
+static bool ninja_chart_rows_reserve(ninja_chart_rows_t* rows, size_t column_count) {
+    if (rows->count < rows->capacity) {
+        return true;
+    }
+
+    size_t new_capacity = rows->capacity ? rows->capacity * 2 : 1024;
+    for (size_t i = 0; i < column_count; i++) {
+        void* values = realloc(rows->values[i], new_capacity * 8);
+        if (!values) {
+            return false;
+        }
+        rows->values[i] = values;
+    }
+    rows->capacity = new_capacity;
+    return true;
+}
+
+static double ninja_chart_number(const cJSON* object, const char* key, double fallback) {
+    const cJSON* item = cJSON_GetObjectItemCaseSensitive(object, key);
+    return cJSON_IsNumber(item) ? cJSON_GetNumberValue(item) : fallback;
+}
+
+// Ticks are relative to the packet's base: price = (bp + p) * ts, time = bt + t (ms)
+static bool ninja_chart_decode_ticks(const cJSON* chart, int64_t from_ns, int64_t to_ns, ninja_chart_rows_t* rows) {
+    double base_price = ninja_chart_number(chart, "bp", 0.0);
+    double base_time_ms = ninja_chart_number(chart, "bt", 0.0);
+    double tick_size = ninja_chart_number(chart, "ts", 1.0);
+
+    const cJSON* tick;
+    cJSON_ArrayForEach(tick, cJSON_GetObjectItemCaseSensitive(chart, "tks")) {
+        int64_t timestamp_ns = ((int64_t)base_time_ms + (int64_t)ninja_chart_number(tick, "t", 0.0)) * 1000000LL;
+        if (timestamp_ns < from_ns || timestamp_ns >= to_ns) {
+            continue;
+        }
+        if (!ninja_chart_rows_reserve(rows, 5)) {
+            return false;
+        }
+
+        size_t n = rows->count++;
+        ((int64_t*)rows->values[0])[n] = timestamp_ns;
+        ((double*)rows->values[1])[n] = (base_price + ninja_chart_number(tick, "p", 0.0)) * tick_size;
+        ((int64_t*)rows->values[2])[n] = (int64_t)ninja_chart_number(tick, "s", 0.0);
+        ((double*)rows->values[3])[n] = (base_price + ninja_chart_number(tick, "b", NAN)) * tick_size;
+        ((double*)rows->values[4])[n] = (base_price + ninja_chart_number(tick, "a", NAN)) * tick_size;
+    }
+    return true;
+}
+
+static bool ninja_chart_decode_bars(const cJSON* chart, int64_t from_ns, int64_t to_ns, ninja_chart_rows_t* rows) {
+    const cJSON* bar;
+    cJSON_ArrayForEach(bar, cJSON_GetObjectItemCaseSensitive(chart, "bars")) {
+        const char* timestamp = cJSON_GetStringValue(cJSON_GetObjectItemCaseSensitive(bar, "timestamp"));
+        int64_t timestamp_ns;
+        if (!timestamp || ninja_parse_timestamp(timestamp, strlen(timestamp), &timestamp_ns) != NINJA_OK ||
+            timestamp_ns < from_ns || timestamp_ns >= to_ns) {
+            continue;
+        }
+        if (!ninja_chart_rows_reserve(rows, 6)) {
+            return false;
+        }
+
+        size_t n = rows->count++;
+        ((int64_t*)rows->values[0])[n] = timestamp_ns;
+        ((double*)rows->values[1])[n] = ninja_chart_number(bar, "open", NAN);
+        ((double*)rows->values[2])[n] = ninja_chart_number(bar, "high", NAN);
+        ((double*)rows->values[3])[n] = ninja_chart_number(bar, "low", NAN);
+        ((double*)rows->values[4])[n] = ninja_chart_number(bar, "close", NAN);
+        ((int64_t*)rows->values[5])[n] = (int64_t)(ninja_chart_number(bar, "upVolume", 0.0) +
+                                                   ninja_chart_number(bar, "downVolume", 0.0));
+    }
+    return true;
+}
+
+typedef struct {
+    int64_t timestamp_ns;
+    size_t row;
+} ninja_chart_order_t;
+
+static int ninja_chart_order_compare(const void* a, const void* b) {
+    const ninja_chart_order_t* left = (const ninja_chart_order_t*)a;
+    const ninja_chart_order_t* right = (const ninja_chart_order_t*)b;
+    if (left->timestamp_ns != right->timestamp_ns) {
+        return left->timestamp_ns < right->timestamp_ns ? -1 : 1;
+    }
+    return left->row < right->row ? -1 : left->row > right->row;
+}
+
+// Helper function to put rows in timestamp order; packets may arrive newest
+// first. Already ordered rows cost one pass.
+static bool ninja_chart_sort(ninja_chart_rows_t* rows, size_t column_count) {
+    const int64_t* timestamps = (const int64_t*)rows->values[0];
+    size_t i = 1;
+    while (i < rows->count && timestamps[i - 1] <= timestamps[i]) {
+        i++;
+    }
+    if (i >= rows->count) {
+        return true;
+    }
+
+    ninja_chart_order_t* order = malloc(rows->count * sizeof(ninja_chart_order_t));
+    uint64_t* scratch = malloc(rows->count * sizeof(uint64_t));
+    if (!order || !scratch) {
+        free(order);
+        free(scratch);
+        return false;
+    }
+
+    for (size_t row = 0; row < rows->count; row++) {
+        order[row].timestamp_ns = timestamps[row];
+        order[row].row = row;
+    }
+    qsort(order, rows->count, sizeof(ninja_chart_order_t), ninja_chart_order_compare);
+
+    for (size_t c = 0; c < column_count; c++) {
+        uint64_t* column = (uint64_t*)rows->values[c];
+        for (size_t row = 0; row < rows->count; row++) {
+            scratch[row] = column[order[row].row];
+        }
+        memcpy(column, scratch, rows->count * sizeof(uint64_t));
+    }
+
+    free(order);
+    free(scratch);
+    return true;
+}
+
+ninja_error_t ninja_chart_decode(ninja_chart_type_t type,
+                                 const char* json,
+                                 int64_t from_ns,
+                                 int64_t to_ns,
+                                 ninja_chart_rows_t* rows) {
+    if (!json || !rows) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    rows->count = 0;
+
+    cJSON* root = cJSON_Parse(json);
+    if (!root) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    const cJSON* charts = cJSON_GetObjectItemCaseSensitive(root, "charts");
+    if (!cJSON_IsArray(charts)) {
+        ninja_error_t result = cJSON_IsString(cJSON_GetObjectItemCaseSensitive(root, "errorText"))
+            ? NINJA_ERROR_HTTP
+            : NINJA_ERROR_JSON_PARSE;
+        cJSON_Delete(root);
+        return result;
+    }
+
+    bool decoded = true;
+    const cJSON* chart;
+    cJSON_ArrayForEach(chart, charts) {
+        decoded = type == NINJA_CHART_TICKS
+            ? ninja_chart_decode_ticks(chart, from_ns, to_ns, rows)
+            : ninja_chart_decode_bars(chart, from_ns, to_ns, rows);
+        if (!decoded) {
+            break;
+        }
+    }
+    cJSON_Delete(root);
+
+    size_t column_count;
+    ninja_chart_columns(type, &column_count);
+    if (!decoded || !ninja_chart_sort(rows, column_count)) {
+        return NINJA_ERROR_MEMORY;
+    }
+    return NINJA_OK;
+}
+
+// Download in progress: chunk i covers [from + i * chunk, from + (i + 1) * chunk)
+typedef struct {
+    ninja_chart_type_t type;
+    int64_t from_ns;
+    int64_t to_ns;
+    int64_t chunk_ns;
+    size_t chunk_count;
+    ninja_http_request_t* requests;
+    ninja_chart_rows_t* rows;   // One per window slot, chunk i in slot i % window
+    bool* decoded;
+    size_t window;
+    size_t next_write;
+    ninja_columnar_t columnar;
+    uint64_t records;
+    ninja_error_t result;
+} ninja_chart_download_t;
+
+// Helper function to decode a finished chunk, then append every chunk whose
+// predecessors are all written
+static bool ninja_chart_chunk_done(ninja_http_request_t* request, void* user_data) {
+    ninja_chart_download_t* download = (ninja_chart_download_t*)user_data;
+    if (download->result != NINJA_OK) {
+        return false;
+    }
+    if (request->result != NINJA_OK) {
+        download->result = request->result;
+        return false;
+    }
+
+    size_t chunk = (size_t)(request - download->requests);
+    int64_t chunk_from = download->from_ns + (int64_t)chunk * download->chunk_ns;
+    int64_t chunk_to = chunk_from + download->chunk_ns < download->to_ns ? chunk_from + download->chunk_ns : download->to_ns;
+    ninja_error_t result = ninja_chart_decode(download->type, request->response.data, chunk_from, chunk_to,
+                                              &download->rows[chunk % download->window]);
+    if (result != NINJA_OK) {
+        download->result = result;
+        return false;
+    }
+    download->decoded[chunk % download->window] = true;
+
+    while (download->next_write < download->chunk_count && download->decoded[download->next_write % download->window]) {
+        size_t slot = download->next_write % download->window;
+        ninja_chart_rows_t* rows = &download->rows[slot];
+        result = ninja_columnar_append(&download->columnar, (const void* const*)rows->values, rows->count);
+        if (result != NINJA_OK) {
+            download->result = result;
+            return false;
+        }
+        download->records += rows->count;
+        download->decoded[slot] = false;
+        download->next_write++;
+    }
+
+    return true;
+}
+
+// Helper function to build the md/getChart body for one chunk
+static char* ninja_chart_request_body(const ninja_chart_request_t* request, int64_t from_ns, int64_t to_ns) {
+    static const char* const underlying[] = { "Tick", "MinuteBar", "DailyBar" };
+    char closest[NINJA_TIMESTAMP_TEXT_SIZE];
+    char as_far_as[NINJA_TIMESTAMP_TEXT_SIZE];
+    if (ninja_format_timestamp(to_ns, closest, sizeof(closest)) != NINJA_OK ||
+        ninja_format_timestamp(from_ns, as_far_as, sizeof(as_far_as)) != NINJA_OK) {
+        return NULL;
+    }
+
+    cJSON* json = cJSON_CreateObject();
+    if (!json) {
+        return NULL;
+    }
+    cJSON_AddStringToObject(json, "symbol", request->symbol);
+
+    cJSON* description = cJSON_AddObjectToObject(json, "chartDescription");
+    cJSON_AddStringToObject(description, "underlyingType", underlying[request->type]);
+    cJSON_AddNumberToObject(description, "elementSize", request->element_size > 0 ? request->element_size : 1);
+    cJSON_AddStringToObject(description, "elementSizeUnit", "UnderlyingUnits");
+    cJSON_AddBoolToObject(description, "withHistogram", false);
+
+    cJSON* time_range = cJSON_AddObjectToObject(json, "timeRange");
+    cJSON_AddStringToObject(time_range, "closestTimestamp", closest);
+    cJSON_AddStringToObject(time_range, "asFarAsTimestamp", as_far_as);
+
+    char* body = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    return body;
+}
+
+ninja_error_t ninja_download_chart(ninja_client_t* client,
+                                  const ninja_chart_request_t* request,
+                                  const char* path,
+                                  uint64_t* records) {
+    if (!client || !request || !request->symbol || !path || !records ||
+        (unsigned)request->type > NINJA_CHART_DAILY_BARS || request->to_ns <= request->from_ns ||
+        request->chunk_ns < 0 || request->parallel_requests < 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *records = 0;
+
+    // Defaults keep a chunk around ten thousand rows
+    int64_t element = request->element_size > 0 ? request->element_size : 1;
+    int64_t chunk_ns = request->chunk_ns;
+    if (chunk_ns == 0) {
+        chunk_ns = request->type == NINJA_CHART_TICKS ? NINJA_HOUR_NS
+                 : request->type == NINJA_CHART_MINUTE_BARS ? 7 * NINJA_DAY_NS * element
+                 : 10000 * NINJA_DAY_NS;
+    }
+
+    ninja_chart_download_t download;
+    memset(&download, 0, sizeof(download));
+    download.type = request->type;
+    download.from_ns = request->from_ns;
+    download.to_ns = request->to_ns;
+    download.chunk_ns = chunk_ns;
+    download.chunk_count = (size_t)((request->to_ns - request->from_ns - 1) / chunk_ns + 1);
+    download.window = request->parallel_requests > 0 ? (size_t)request->parallel_requests : NINJA_CHART_PARALLEL_REQUESTS;
+    if (download.window > download.chunk_count) {
+        download.window = download.chunk_count;
+    }
+
+    size_t column_count;
+    const ninja_column_t* columns = ninja_chart_columns(request->type, &column_count);
+    ninja_error_t result = ninja_columnar_open(&download.columnar, path, columns, column_count);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    download.requests = calloc(download.chunk_count, sizeof(ninja_http_request_t));
+    download.rows = calloc(download.window, sizeof(ninja_chart_rows_t));
+    download.decoded = calloc(download.window, sizeof(bool));
+    if (!download.requests || !download.rows || !download.decoded) {
+        result = NINJA_ERROR_MEMORY;
+    }
+
+    char url[512];
+    snprintf(url, sizeof(url), "%s/md/getChart", client->md_base_url);
+    for (size_t i = 0; result == NINJA_OK && i < download.chunk_count; i++) {
+        int64_t chunk_from = request->from_ns + (int64_t)i * chunk_ns;
+        int64_t chunk_to = chunk_from + chunk_ns < request->to_ns ? chunk_from + chunk_ns : request->to_ns;
+        ninja_http_request_t* chunk = &download.requests[i];
+        chunk->url = url;
+        chunk->headers = client->md_headers;
+        chunk->body = ninja_chart_request_body(request, chunk_from, chunk_to);
+        if (!chunk->body) {
+            result = NINJA_ERROR_JSON_PARSE;
+        }
+    }
+
+    if (result == NINJA_OK) {
+        result = ninja_http_perform_window(client, download.requests, download.chunk_count, download.window,
+                                           ninja_chart_chunk_done, &download);
+        if (result == NINJA_OK) {
+            result = download.result;
+        }
+    }
+
+    ninja_error_t closed = ninja_columnar_close(&download.columnar);
+    if (result == NINJA_OK) {
+        result = closed;
+    }
+    *records = download.records;
+
+    for (size_t i = 0; download.requests && i < download.chunk_count; i++) {
+        free((char*)download.requests[i].body);
+    }
+    for (size_t i = 0; download.rows && i < download.window; i++) {
+        ninja_chart_rows_free(&download.rows[i]);
+    }
+    free(download.requests);
+    free(download.rows);
+    free(download.decoded);
+
+    return result;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_columnar.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rows of one chart chunk, one array of 8-byte values per column
+typedef struct {
+    size_t count;
+    size_t capacity;
+    void* values[NINJA_COLUMNAR_MAX_COLUMNS];
+} ninja_chart_rows_t;
+
+// Columns a chart type is stored as
+const ninja_column_t* ninja_chart_columns(ninja_chart_type_t type, size_t* count);
+
+// Decode an md/getChart response into rows, keeping those in [from_ns, to_ns)
+// in timestamp order; rows is reused across calls
+ninja_error_t ninja_chart_decode(ninja_chart_type_t type,
+                                 const char* json,
+                                 int64_t from_ns,
+                                 int64_t to_ns,
+                                 ninja_chart_rows_t* rows);
+
+void ninja_chart_rows_free(ninja_chart_rows_t* rows);
+
+#ifdef __cplusplus
+}
+#endif
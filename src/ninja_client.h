@@ -23,6 +23,17 @@
 #pragma once
 
 #include "../include/ninja/ninja_types.h"
+#include "ninja_order_map.h"
+#include "ninja_catalog.h"
+#include "ninja_contract_index.h"
+#include "ninja_journal.h"
+#include "ninja_shm.h"
+#include "ninja_thread.h"
+#include "ninja_delta.h"
+#include "ninja_pipeline.h"
+#include "ninja_retry.h"
+#include "ninja_context.h"
+#include "ninja_log.h"
 #include <curl/curl.h>
 
 #ifdef __cplusplus
@@ -33,17 +44,76 @@ extern "C" {
 struct ninja_client {
     ninja_env_t env;
     char base_url[256];
+    char md_base_url[256];
     char access_token[256];
     char md_access_token[256];
     int user_id;
 
-    // HTTP client
+    // Library context reference; its share handle is set on every connection
+    ninja_context_t* context;
+
+    // HTTP client; md_headers carry the market data token
     CURL* curl;
     struct curl_slist* headers;
+    struct curl_slist* md_headers;
+
+    // Guards the order map, journal and shm against the I/O thread, and
+    // auth_header, which the I/O thread rebuilds its headers from whenever
+    // auth_generation changes
+    ninja_mutex_t lock;
+    char auth_header[512];
+    uint64_t auth_generation;
+
+    // Dedicated I/O thread, NULL unless enabled
+    struct ninja_io* io;
+
+    // Concurrent requests from the caller's thread, created on first use
+    ninja_pipeline_t pipeline;
+    long http_connections;
+
+    // Retries of failed requests, and hedging of slow GETs
+    ninja_retry_policy_t retry;
+    ninja_hedge_t hedge;
+
+    // clOrdId keys are the prefix, unique to this client instance, and a counter
+    uint32_t client_order_prefix;
+    uint64_t client_order_counter;
+
+    // Last known state of every order seen by this client, keyed by order id
+    ninja_order_map_t order_map;
+
+    // Orders placed by this client, keyed by a hash of their clOrdId
+    ninja_order_map_t client_order_map;
+
+    // Last order/list, position/list and account/list responses, for
+    // conditional requests and delta sync
+    ninja_list_cache_t order_list;
+    ninja_list_cache_t position_list;
+    ninja_list_cache_t account_list;
+
+    // On-disk contract snapshot, enabled when its path is set
+    ninja_catalog_t contract_catalog;
+
+    // Prefix index over the catalog for contract search
+    ninja_contract_index_t contract_index;
+
+    // Write-ahead journal of order requests, enabled when opened
+    ninja_journal_t journal;
+
+    // Shared-memory segment orders and positions are published to
+    ninja_shm_t shm;
+
+    // Transfer counters, updated from both threads
+    uint64_t transfer_requests;
+    uint64_t transfer_wire_bytes;
+    uint64_t transfer_body_bytes;
 
     // Configuration
     long timeout_ms;
     bool debug_mode;
+
+    // Background debug log, set when debug_mode is
+    ninja_log_t* debug_log;
 };
 
 // Internal HTTP functions
@@ -51,20 +121,96 @@ ninja_error_t ninja_http_get(ninja_client_t* client,
                             const char* endpoint,
                             ninja_http_response_t* response);
 
+// GET that sends the validators held in *validators (if any) and replaces
+// them with the response's; a 304 answer returns NINJA_OK
+ninja_error_t ninja_http_get_conditional(ninja_client_t* client,
+                                        const char* endpoint,
+                                        ninja_http_validators_t* validators,
+                                        ninja_http_response_t* response);
+
+// POSTs are only resent when the request never reached the server
 ninja_error_t ninja_http_post(ninja_client_t* client,
                              const char* endpoint,
                              const char* json_data,
                              ninja_http_response_t* response);
 
+// POST of a pre-rendered body to a full URL; both must outlive the call
+ninja_error_t ninja_http_post_prepared(ninja_client_t* client,
+                                      const char* url,
+                                      const char* body,
+                                      size_t body_length,
+                                      ninja_http_response_t* response);
+
+// POST whose effect is the same however often it is applied (cancel,
+// modify); retried like GET and DELETE
+ninja_error_t ninja_http_post_idempotent(ninja_client_t* client,
+                                        const char* endpoint,
+                                        const char* json_data,
+                                        ninja_http_response_t* response);
+
 ninja_error_t ninja_http_delete(ninja_client_t* client,
                                const char* endpoint,
                                ninja_http_response_t* response);
 
 void ninja_http_response_free(ninja_http_response_t* response);
 
+// Connection and headers for the calling thread (the I/O thread has its own)
+CURL* ninja_http_connection(ninja_client_t* client, struct curl_slist** headers);
+void ninja_http_record_transfer(ninja_client_t* client, CURL* curl, const ninja_http_response_t* response);
+
+// Whether an order is filled, cancelled, rejected, expired or completed and
+// can no longer change
+bool ninja_order_is_done(const ninja_order_t* order);
+
+// Order types that send a limit price and a stop price
+bool ninja_order_type_uses_price(ninja_order_type_t type);
+bool ninja_order_type_uses_stop_price(ninja_order_type_t type);
+
+// Body of order/placeorder; without the variable fields it leaves out
+// orderQty, price, stopPrice and clOrdId. NULL if it could not be built.
+struct cJSON* ninja_order_request_json(const ninja_order_request_t* request, bool variable);
+
+// Bodies of order/cancelorder and order/modifyorder; NULL if they could not be built
+char* ninja_cancel_request_body(ninja_order_id_t order_id);
+char* ninja_modify_request_body(ninja_order_id_t order_id, int quantity, double price);
+
+// Decode one record of a parsed response object
+ninja_error_t ninja_parse_order(struct cJSON* order_json, ninja_order_t* order);
+ninja_error_t ninja_parse_position(struct cJSON* position_json, ninja_position_t* position);
+ninja_error_t ninja_parse_account(struct cJSON* account_json, ninja_account_t* account);
+ninja_error_t ninja_parse_contract(struct cJSON* contract_json, ninja_contract_t* contract);
+
+// Journal a placement (its clOrdId set) and track it as pending; returns the
+// journal sequence. Settle it with ninja_end_place, which frees the response.
+uint64_t ninja_log_place(ninja_client_t* client, const ninja_order_request_t* request);
+ninja_error_t ninja_end_place(ninja_client_t* client,
+                             uint64_t sequence,
+                             const char* client_order_id,
+                             ninja_error_t result,
+                             ninja_http_response_t* response,
+                             ninja_order_t* order_out);
+
+// Order operation of a concurrent batch
+typedef struct {
+    ninja_request_kind_t kind;
+    const ninja_order_request_t* request;   // NINJA_REQUEST_PLACE_ORDER
+    ninja_order_id_t order_id;              // Cancel and query target
+    ninja_order_t* order;                   // Placed or queried order
+    uint64_t trace_id;                      // 0 starts a trace of its own when tracing
+    ninja_error_t result;
+} ninja_order_op_t;
+
+// Run order operations concurrently on the calling thread's pipeline; each
+// op's result is set, after the same retries single calls get (placements
+// only when never sent). Returns an error only if the batch could not run.
+ninja_error_t ninja_run_order_ops(ninja_client_t* client, ninja_order_op_t* ops, size_t count);
+
 // Internal utility functions
 ninja_error_t ninja_set_auth_header(ninja_client_t* client);
 const char* ninja_get_base_url(ninja_env_t env);
+const char* ninja_get_md_base_url(ninja_env_t env);
+int64_t ninja_wall_clock_ns(void);
+int64_t ninja_monotonic_ns(void);
 
 #ifdef __cplusplus
 }
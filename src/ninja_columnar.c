@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_columnar.h"
+#include "ninja_mmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Helper function to get the stored width of one value; text stores a code
+static size_t ninja_column_width(uint32_t type) {
+    switch (type) {
+        case NINJA_COLUMN_INT64:
+        case NINJA_COLUMN_DOUBLE:
+            return 8;
+        case NINJA_COLUMN_INT32:
+        case NINJA_COLUMN_TEXT:
+            return 4;
+        case NINJA_COLUMN_UINT8:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Helper function to size a column's array, padded so the next one stays aligned
+static size_t ninja_column_array_size(uint32_t type, uint64_t rows) {
+    return ((size_t)rows * ninja_column_width(type) + 7) & ~(size_t)7;
+}
+
+// Helper function to lay out one block's columns from its data; fills each
+// column's offset from data and returns the data size, 0 if the block does
+// not fit in available bytes
+static size_t ninja_columnar_layout(const ninja_columnar_column_t* columns,
+                                    size_t column_count,
+                                    uint64_t rows,
+                                    const char* data,
+                                    size_t available,
+                                    size_t* offsets) {
+    if (rows > available) {
+        return 0;
+    }
+
+    size_t size = 0;
+    for (size_t i = 0; i < column_count; i++) {
+        offsets[i] = size;
+        if (columns[i].type == NINJA_COLUMN_TEXT) {
+            // Dictionary count and entries ahead of the codes
+            uint64_t entries = 0;
+            if (available - size < sizeof(entries)) {
+                return 0;
+            }
+            memcpy(&entries, data + size, sizeof(entries));
+            size += sizeof(entries);
+            if (entries > (available - size) / NINJA_COLUMN_TEXT_SIZE) {
+                return 0;
+            }
+            size += (size_t)entries * NINJA_COLUMN_TEXT_SIZE;
+        }
+
+        size_t array = ninja_column_array_size(columns[i].type, rows);
+        if (array > available - size) {
+            return 0;
+        }
+        size += array;
+    }
+
+    return size;
+}
+
+// Helper function to walk the blocks of a mapped file; returns the end of
+// the last complete block and the rows up to it
+static size_t ninja_columnar_scan(const ninja_mmap_t* map,
+                                  const ninja_columnar_column_t* columns,
+                                  size_t column_count,
+                                  uint64_t* rows) {
+    size_t offset = sizeof(ninja_columnar_header_t) + column_count * sizeof(ninja_columnar_column_t);
+    size_t offsets[NINJA_COLUMNAR_MAX_COLUMNS];
+    *rows = 0;
+
+    while (offset + sizeof(ninja_columnar_block_t) <= map->size) {
+        ninja_columnar_block_t block;
+        memcpy(&block, (const char*)map->data + offset, sizeof(block));
+        if (block.magic != NINJA_COLUMNAR_BLOCK_MAGIC || block.column_count != column_count) {
+            break;
+        }
+
+        size_t start = offset + sizeof(block);
+        size_t size = ninja_columnar_layout(columns, column_count, block.rows,
+                                            (const char*)map->data + start, map->size - start, offsets);
+        if (size == 0) {
+            break;
+        }
+        *rows += block.rows;
+        offset = start + size;
+    }
+
+    return offset;
+}
+
+// Helper function to check a mapped file's header; returns its column count, 0 if invalid
+static size_t ninja_columnar_columns(const ninja_mmap_t* map, const ninja_columnar_column_t** columns) {
+    ninja_columnar_header_t header;
+    if (map->size < sizeof(header)) {
+        return 0;
+    }
+    memcpy(&header, map->data, sizeof(header));
+    if (memcmp(header.magic, NINJA_COLUMNAR_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != NINJA_COLUMNAR_VERSION ||
+        header.column_count == 0 || header.column_count > NINJA_COLUMNAR_MAX_COLUMNS ||
+        map->size < sizeof(header) + header.column_count * sizeof(ninja_columnar_column_t)) {
+        return 0;
+    }
+
+    *columns = (const ninja_columnar_column_t*)((const char*)map->data + sizeof(header));
+    return header.column_count;
+}
+
+ninja_error_t ninja_columnar_open(ninja_columnar_t* columnar,
+                                  const char* path,
+                                  const ninja_column_t* columns,
+                                  size_t column_count) {
+    if (!columnar || !path || !columns || column_count == 0 || column_count > NINJA_COLUMNAR_MAX_COLUMNS) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    memset(columnar, 0, sizeof(ninja_columnar_t));
+
+    ninja_columnar_column_t described[NINJA_COLUMNAR_MAX_COLUMNS];
+    memset(described, 0, sizeof(described));
+    for (size_t i = 0; i < column_count; i++) {
+        if (!columns[i].name || strlen(columns[i].name) >= NINJA_COLUMN_NAME_SIZE) {
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+        if (columns[i].type < NINJA_COLUMN_INT64 || columns[i].type > NINJA_COLUMN_TEXT) {
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+        strcpy(described[i].name, columns[i].name);
+        described[i].type = (uint32_t)columns[i].type;
+    }
+
+    // Existing file: same columns, and cut back to its last complete block
+    ninja_mmap_t map;
+    bool exists = ninja_mmap_open(&map, path, 0, false) == NINJA_OK;
+    if (exists) {
+        const ninja_columnar_column_t* existing = NULL;
+        if (ninja_columnar_columns(&map, &existing) != column_count ||
+            memcmp(existing, described, column_count * sizeof(ninja_columnar_column_t)) != 0) {
+            ninja_mmap_close(&map);
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+
+        size_t end = ninja_columnar_scan(&map, existing, column_count, &columnar->rows);
+        size_t size = map.size;
+        ninja_mmap_close(&map);
+
+        if (end < size) {
+            ninja_mmap_t writable;
+            if (ninja_mmap_open(&writable, path, end, true) != NINJA_OK) {
+                return NINJA_ERROR_NOT_FOUND;
+            }
+            ninja_error_t result = ninja_mmap_resize(&writable, end);
+            ninja_mmap_close(&writable);
+            if (result != NINJA_OK) {
+                return result;
+            }
+        }
+    }
+
+    columnar->file = fopen(path, "ab");
+    if (!columnar->file) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+    columnar->column_count = column_count;
+    for (size_t i = 0; i < column_count; i++) {
+        columnar->types[i] = columns[i].type;
+    }
+
+    if (!exists) {
+        ninja_columnar_header_t header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, NINJA_COLUMNAR_MAGIC, sizeof(header.magic));
+        header.version = NINJA_COLUMNAR_VERSION;
+        header.column_count = (uint32_t)column_count;
+        if (fwrite(&header, sizeof(header), 1, columnar->file) != 1 ||
+            fwrite(described, sizeof(ninja_columnar_column_t), column_count, columnar->file) != column_count ||
+            fflush(columnar->file) != 0) {
+            fclose(columnar->file);
+            columnar->file = NULL;
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_columnar_append(ninja_columnar_t* columnar, const void* const* values, size_t rows) {
+    if (!columnar || !columnar->file || (!values && rows > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    if (rows == 0) {
+        return NINJA_OK;
+    }
+
+    // Check every code before writing, so a bad column leaves no partial block
+    for (size_t i = 0; i < columnar->column_count; i++) {
+        if (!values[i]) {
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+        if (columnar->types[i] == NINJA_COLUMN_TEXT) {
+            const ninja_column_text_t* text = values[i];
+            if (!text->codes || (!text->dictionary && text->dictionary_count > 0)) {
+                return NINJA_ERROR_INVALID_PARAM;
+            }
+            for (size_t r = 0; r < rows; r++) {
+                if (text->codes[r] >= text->dictionary_count) {
+                    return NINJA_ERROR_INVALID_PARAM;
+                }
+            }
+        }
+    }
+
+    static const char padding[8];
+    ninja_columnar_block_t block;
+    block.magic = NINJA_COLUMNAR_BLOCK_MAGIC;
+    block.column_count = (uint32_t)columnar->column_count;
+    block.rows = rows;
+    if (fwrite(&block, sizeof(block), 1, columnar->file) != 1) {
+        return NINJA_ERROR_MEMORY;
+    }
+    for (size_t i = 0; i < columnar->column_count; i++) {
+        ninja_column_type_t type = columnar->types[i];
+        const void* array = values[i];
+        size_t width = ninja_column_width(type);
+
+        if (type == NINJA_COLUMN_TEXT) {
+            const ninja_column_text_t* text = values[i];
+            uint64_t entries = text->dictionary_count;
+            if (fwrite(&entries, sizeof(entries), 1, columnar->file) != 1 ||
+                fwrite(text->dictionary, NINJA_COLUMN_TEXT_SIZE, text->dictionary_count,
+                       columnar->file) != text->dictionary_count) {
+                return NINJA_ERROR_MEMORY;
+            }
+            array = text->codes;
+        }
+
+        size_t pad = ninja_column_array_size(type, rows) - rows * width;
+        if (fwrite(array, width, rows, columnar->file) != rows ||
+            (pad > 0 && fwrite(padding, 1, pad, columnar->file) != pad)) {
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    columnar->rows += rows;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_columnar_close(ninja_columnar_t* columnar) {
+    if (!columnar || !columnar->file) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    bool written = fflush(columnar->file) == 0;
+    written = fclose(columnar->file) == 0 && written;
+    columnar->file = NULL;
+
+    return written ? NINJA_OK : NINJA_ERROR_MEMORY;
+}
+
+// Helper function to gather one column of a file into a new array
+static ninja_error_t ninja_read_column(const char* path,
+                                       const char* column,
+                                       ninja_column_type_t type,
+                                       void** values,
+                                       size_t* count) {
+    if (!path || !column || !values || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *values = NULL;
+    *count = 0;
+
+    ninja_mmap_t map;
+    if (ninja_mmap_open(&map, path, 0, false) != NINJA_OK) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    const ninja_columnar_column_t* columns = NULL;
+    size_t column_count = ninja_columnar_columns(&map, &columns);
+    if (column_count == 0) {
+        ninja_mmap_close(&map);
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    size_t index = column_count;
+    for (size_t i = 0; i < column_count; i++) {
+        if (strncmp(columns[i].name, column, NINJA_COLUMN_NAME_SIZE) == 0) {
+            index = i;
+            break;
+        }
+    }
+    if (index == column_count || columns[index].type != (uint32_t)type) {
+        ninja_mmap_close(&map);
+        return index == column_count ? NINJA_ERROR_NOT_FOUND : NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Text comes out decoded, one fixed-size value per row
+    size_t width = type == NINJA_COLUMN_TEXT ? NINJA_COLUMN_TEXT_SIZE : ninja_column_width(type);
+    uint64_t rows = 0;
+    size_t end = ninja_columnar_scan(&map, columns, column_count, &rows);
+    char* out = malloc(rows > 0 ? (size_t)rows * width : 1);
+    if (!out) {
+        ninja_mmap_close(&map);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    // Copy this column's array out of every block
+    size_t offset = sizeof(ninja_columnar_header_t) + column_count * sizeof(ninja_columnar_column_t);
+    size_t offsets[NINJA_COLUMNAR_MAX_COLUMNS];
+    size_t copied = 0;
+    while (offset < end) {
+        ninja_columnar_block_t block;
+        memcpy(&block, (const char*)map.data + offset, sizeof(block));
+        const char* data = (const char*)map.data + offset + sizeof(block);
+        size_t size = ninja_columnar_layout(columns, column_count, block.rows, data, end - offset - sizeof(block),
+                                            offsets);
+        const char* array = data + offsets[index];
+
+        if (type == NINJA_COLUMN_TEXT) {
+            uint64_t entries = 0;
+            memcpy(&entries, array, sizeof(entries));
+            const char* dictionary = array + sizeof(entries);
+            const char* codes = dictionary + (size_t)entries * NINJA_COLUMN_TEXT_SIZE;
+            for (size_t r = 0; r < (size_t)block.rows; r++) {
+                uint32_t code = 0;
+                char* value = out + (copied + r) * NINJA_COLUMN_TEXT_SIZE;
+                memcpy(&code, codes + r * 4, sizeof(code));
+                if (code < entries) {
+                    memcpy(value, dictionary + (size_t)code * NINJA_COLUMN_TEXT_SIZE, NINJA_COLUMN_TEXT_SIZE);
+                    value[NINJA_COLUMN_TEXT_SIZE - 1] = '\0';
+                } else {
+                    value[0] = '\0';
+                }
+            }
+        } else {
+            memcpy(out + copied * width, array, (size_t)block.rows * width);
+        }
+        copied += (size_t)block.rows;
+        offset += sizeof(block) + size;
+    }
+    ninja_mmap_close(&map);
+
+    *values = out;
+    *count = copied;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_read_column_int64(const char* path, const char* column, int64_t** values, size_t* count) {
+    return ninja_read_column(path, column, NINJA_COLUMN_INT64, (void**)values, count);
+}
+
+ninja_error_t ninja_read_column_double(const char* path, const char* column, double** values, size_t* count) {
+    return ninja_read_column(path, column, NINJA_COLUMN_DOUBLE, (void**)values, count);
+}
+
+ninja_error_t ninja_read_column_int32(const char* path, const char* column, int32_t** values, size_t* count) {
+    return ninja_read_column(path, column, NINJA_COLUMN_INT32, (void**)values, count);
+}
+
+ninja_error_t ninja_read_column_uint8(const char* path, const char* column, uint8_t** values, size_t* count) {
+    return ninja_read_column(path, column, NINJA_COLUMN_UINT8, (void**)values, count);
+}
+
+ninja_error_t ninja_read_column_text(const char* path,
+                                     const char* column,
+                                     char (**values)[NINJA_COLUMN_TEXT_SIZE],
+                                     size_t* count) {
+    return ninja_read_column(path, column, NINJA_COLUMN_TEXT, (void**)values, count);
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Append-only columnar file: a header naming the columns, then blocks of
+// rows, each block holding every column as one contiguous array, in host
+// byte order. Every array starts 8-byte aligned. Text columns store an int32
+// code per row after the block's dictionary of distinct values.
+#define NINJA_COLUMNAR_MAGIC "NINJACOL"
+#define NINJA_COLUMNAR_VERSION 1
+#define NINJA_COLUMNAR_BLOCK_MAGIC 0x4B4C4243u   // "CBLK"
+#define NINJA_COLUMN_NAME_SIZE 24
+#define NINJA_COLUMNAR_MAX_COLUMNS 16
+
+typedef enum {
+    NINJA_COLUMN_INT64 = 1,
+    NINJA_COLUMN_DOUBLE = 2,
+    NINJA_COLUMN_INT32 = 3,
+    NINJA_COLUMN_UINT8 = 4,
+    NINJA_COLUMN_TEXT = 5
+} ninja_column_type_t;
+
+// Values of a text column: codes index the dictionary
+typedef struct {
+    const uint32_t* codes;
+    const char (*dictionary)[NINJA_COLUMN_TEXT_SIZE];
+    size_t dictionary_count;
+} ninja_column_text_t;
+
+typedef struct {
+    const char* name;
+    ninja_column_type_t type;
+} ninja_column_t;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t column_count;
+} ninja_columnar_header_t;
+
+typedef struct {
+    char name[NINJA_COLUMN_NAME_SIZE];
+    uint32_t type;
+    uint32_t reserved;
+} ninja_columnar_column_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t column_count;
+    uint64_t rows;
+} ninja_columnar_block_t;
+
+typedef struct {
+    FILE* file;
+    size_t column_count;
+    ninja_column_type_t types[NINJA_COLUMNAR_MAX_COLUMNS];
+    uint64_t rows;              // Rows in the file, including earlier sessions
+} ninja_columnar_t;
+
+// Open path for appending, creating it with these columns if it does not
+// exist. An existing file must have the same columns; a block cut short by
+// a crash is dropped.
+ninja_error_t ninja_columnar_open(ninja_columnar_t* columnar,
+                                  const char* path,
+                                  const ninja_column_t* columns,
+                                  size_t column_count);
+
+// Append rows as one block; values[c] holds rows values of column c (a
+// ninja_column_text_t for text columns)
+ninja_error_t ninja_columnar_append(ninja_columnar_t* columnar, const void* const* values, size_t rows);
+
+// Flush and close; returns the first write error
+ninja_error_t ninja_columnar_close(ninja_columnar_t* columnar);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_columnar.h"
+#include "ninja_delta.h"
+#include <stdlib.h>
+#include <string.h>
+
+// One array of a view: where its pointer goes and the size of one value
+typedef struct {
+    void** array;
+    size_t width;
+} ninja_column_slot_t;
+
+// Helper function to place every array of a view in one allocation, each
+// 8-byte aligned
+static ninja_error_t ninja_columns_allocate(void** storage,
+                                            const ninja_column_slot_t* slots,
+                                            size_t slot_count,
+                                            size_t rows) {
+    size_t total = 0;
+    for (size_t i = 0; i < slot_count; i++) {
+        if (rows > SIZE_MAX / 2 / slots[i].width) {
+            return NINJA_ERROR_MEMORY;
+        }
+        total += (rows * slots[i].width + 7) & ~(size_t)7;
+    }
+
+    char* block = malloc(total);
+    if (!block) {
+        return NINJA_ERROR_MEMORY;
+    }
+    size_t offset = 0;
+    for (size_t i = 0; i < slot_count; i++) {
+        *slots[i].array = block + offset;
+        offset += (rows * slots[i].width + 7) & ~(size_t)7;
+    }
+
+    *storage = block;
+    return NINJA_OK;
+}
+
+// Helper function to intern the symbol field of count records stride bytes
+// apart: codes[i] becomes the index of record i's symbol in symbols
+static ninja_error_t ninja_columns_intern(const char* text,
+                                          size_t stride,
+                                          size_t count,
+                                          char (*symbols)[NINJA_COLUMN_TEXT_SIZE],
+                                          uint32_t* codes,
+                                          size_t* symbol_count) {
+    size_t capacity = 16;
+    while (capacity < count * 2) {
+        capacity *= 2;
+    }
+    uint32_t* table = calloc(capacity, sizeof(uint32_t));   // Symbol index + 1, 0 when empty
+    if (!table) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    size_t distinct = 0;
+    for (size_t i = 0; i < count; i++, text += stride) {
+        size_t length = 0;
+        while (length < NINJA_COLUMN_TEXT_SIZE - 1 && text[length] != '\0') {
+            length++;
+        }
+
+        size_t slot = (size_t)ninja_hash_bytes(text, length) & (capacity - 1);
+        while (table[slot] != 0) {
+            const char* symbol = symbols[table[slot] - 1];
+            if (strncmp(symbol, text, length) == 0 && symbol[length] == '\0') {
+                break;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+
+        if (table[slot] == 0) {
+            memset(symbols[distinct], 0, NINJA_COLUMN_TEXT_SIZE);
+            memcpy(symbols[distinct], text, length);
+            table[slot] = (uint32_t)++distinct;
+        }
+        codes[i] = table[slot] - 1;
+    }
+
+    free(table);
+    *symbol_count = distinct;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_orders_to_columns(const ninja_order_t* orders, size_t count, ninja_order_columns_t* columns) {
+    if (!columns || (!orders && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    memset(columns, 0, sizeof(ninja_order_columns_t));
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    // Widest first; symbols is sized for every row being distinct
+    const ninja_column_slot_t slots[] = {
+        { (void**)&columns->symbols, NINJA_COLUMN_TEXT_SIZE },
+        { (void**)&columns->order_id, sizeof(int64_t) },
+        { (void**)&columns->timestamp_ns, sizeof(int64_t) },
+        { (void**)&columns->price, sizeof(double) },
+        { (void**)&columns->stop_price, sizeof(double) },
+        { (void**)&columns->filled_price, sizeof(double) },
+        { (void**)&columns->account_id, sizeof(int32_t) },
+        { (void**)&columns->symbol, sizeof(uint32_t) },
+        { (void**)&columns->quantity, sizeof(int32_t) },
+        { (void**)&columns->filled_quantity, sizeof(int32_t) },
+        { (void**)&columns->side, sizeof(uint8_t) },
+        { (void**)&columns->type, sizeof(uint8_t) },
+        { (void**)&columns->status, sizeof(uint8_t) },
+        { (void**)&columns->is_automated, sizeof(uint8_t) }
+    };
+    ninja_error_t result = ninja_columns_allocate(&columns->storage, slots, sizeof(slots) / sizeof(slots[0]), count);
+    if (result != NINJA_OK) {
+        memset(columns, 0, sizeof(ninja_order_columns_t));
+        return result;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_order_t* order = &orders[i];
+        columns->order_id[i] = order->order_id;
+        columns->timestamp_ns[i] = order->timestamp_ns;
+        columns->price[i] = order->price;
+        columns->stop_price[i] = order->stop_price;
+        columns->filled_price[i] = order->filled_price;
+        columns->account_id[i] = order->account_id;
+        columns->quantity[i] = order->quantity;
+        columns->filled_quantity[i] = order->filled_quantity;
+        columns->side[i] = (uint8_t)order->side;
+        columns->type[i] = (uint8_t)order->type;
+        columns->status[i] = (uint8_t)order->status;
+        columns->is_automated[i] = order->is_automated ? 1 : 0;
+    }
+
+    result = ninja_columns_intern(orders[0].symbol, sizeof(ninja_order_t), count,
+                                  columns->symbols, columns->symbol, &columns->symbol_count);
+    if (result != NINJA_OK) {
+        free(columns->storage);
+        memset(columns, 0, sizeof(ninja_order_columns_t));
+        return result;
+    }
+
+    columns->count = count;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_fills_to_columns(const ninja_fill_t* fills, size_t count, ninja_fill_columns_t* columns) {
+    if (!columns || (!fills && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    memset(columns, 0, sizeof(ninja_fill_columns_t));
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    const ninja_column_slot_t slots[] = {
+        { (void**)&columns->fill_id, sizeof(int64_t) },
+        { (void**)&columns->order_id, sizeof(int64_t) },
+        { (void**)&columns->timestamp_ns, sizeof(int64_t) },
+        { (void**)&columns->price, sizeof(double) },
+        { (void**)&columns->contract_id, sizeof(int32_t) },
+        { (void**)&columns->quantity, sizeof(int32_t) },
+        { (void**)&columns->side, sizeof(uint8_t) },
+        { (void**)&columns->active, sizeof(uint8_t) }
+    };
+    ninja_error_t result = ninja_columns_allocate(&columns->storage, slots, sizeof(slots) / sizeof(slots[0]), count);
+    if (result != NINJA_OK) {
+        memset(columns, 0, sizeof(ninja_fill_columns_t));
+        return result;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_fill_t* fill = &fills[i];
+        columns->fill_id[i] = fill->fill_id;
+        columns->order_id[i] = fill->order_id;
+        columns->timestamp_ns[i] = fill->timestamp_ns;
+        columns->price[i] = fill->price;
+        columns->contract_id[i] = fill->contract_id;
+        columns->quantity[i] = fill->quantity;
+        columns->side[i] = (uint8_t)fill->side;
+        columns->active[i] = fill->active ? 1 : 0;
+    }
+
+    columns->count = count;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_positions_to_columns(const ninja_position_t* positions,
+                                        size_t count,
+                                        ninja_position_columns_t* columns) {
+    if (!columns || (!positions && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    memset(columns, 0, sizeof(ninja_position_columns_t));
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    const ninja_column_slot_t slots[] = {
+        { (void**)&columns->symbols, NINJA_COLUMN_TEXT_SIZE },
+        { (void**)&columns->timestamp_ns, sizeof(int64_t) },
+        { (void**)&columns->average_price, sizeof(double) },
+        { (void**)&columns->unrealized_pnl, sizeof(double) },
+        { (void**)&columns->realized_pnl, sizeof(double) },
+        { (void**)&columns->account_id, sizeof(int32_t) },
+        { (void**)&columns->contract_id, sizeof(int32_t) },
+        { (void**)&columns->symbol, sizeof(uint32_t) },
+        { (void**)&columns->net_position, sizeof(int32_t) }
+    };
+    ninja_error_t result = ninja_columns_allocate(&columns->storage, slots, sizeof(slots) / sizeof(slots[0]), count);
+    if (result != NINJA_OK) {
+        memset(columns, 0, sizeof(ninja_position_columns_t));
+        return result;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_position_t* position = &positions[i];
+        columns->timestamp_ns[i] = position->timestamp_ns;
+        columns->average_price[i] = position->average_price;
+        columns->unrealized_pnl[i] = position->unrealized_pnl;
+        columns->realized_pnl[i] = position->realized_pnl;
+        columns->account_id[i] = position->account_id;
+        columns->contract_id[i] = position->contract_id;
+        columns->net_position[i] = position->net_position;
+    }
+
+    result = ninja_columns_intern(positions[0].symbol, sizeof(ninja_position_t), count,
+                                  columns->symbols, columns->symbol, &columns->symbol_count);
+    if (result != NINJA_OK) {
+        free(columns->storage);
+        memset(columns, 0, sizeof(ninja_position_columns_t));
+        return result;
+    }
+
+    columns->count = count;
+    return NINJA_OK;
+}
+
+// Helper function to append one block of rows to the columnar file at path
+static ninja_error_t ninja_columns_export(const char* path,
+                                          const ninja_column_t* columns,
+                                          const void* const* values,
+                                          size_t column_count,
+                                          size_t rows) {
+    ninja_columnar_t columnar;
+    ninja_error_t result = ninja_columnar_open(&columnar, path, columns, column_count);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    result = ninja_columnar_append(&columnar, values, rows);
+    ninja_error_t closed = ninja_columnar_close(&columnar);
+    return result != NINJA_OK ? result : closed;
+}
+
+ninja_error_t ninja_export_orders(const char* path, const ninja_order_t* orders, size_t count) {
+    if (!path || (!orders && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_order_columns_t view;
+    ninja_error_t result = ninja_orders_to_columns(orders, count, &view);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    static const ninja_column_t columns[] = {
+        { "order_id", NINJA_COLUMN_INT64 },
+        { "timestamp_ns", NINJA_COLUMN_INT64 },
+        { "price", NINJA_COLUMN_DOUBLE },
+        { "stop_price", NINJA_COLUMN_DOUBLE },
+        { "filled_price", NINJA_COLUMN_DOUBLE },
+        { "account_id", NINJA_COLUMN_INT32 },
+        { "symbol", NINJA_COLUMN_TEXT },
+        { "quantity", NINJA_COLUMN_INT32 },
+        { "filled_quantity", NINJA_COLUMN_INT32 },
+        { "side", NINJA_COLUMN_UINT8 },
+        { "type", NINJA_COLUMN_UINT8 },
+        { "status", NINJA_COLUMN_UINT8 },
+        { "is_automated", NINJA_COLUMN_UINT8 }
+    };
+    ninja_column_text_t symbol = { view.symbol, (const char (*)[NINJA_COLUMN_TEXT_SIZE])view.symbols,
+                                   view.symbol_count };
+    const void* values[] = {
+        view.order_id, view.timestamp_ns, view.price, view.stop_price, view.filled_price,
+        view.account_id, &symbol, view.quantity, view.filled_quantity,
+        view.side, view.type, view.status, view.is_automated
+    };
+
+    result = ninja_columns_export(path, columns, values, sizeof(columns) / sizeof(columns[0]), count);
+    free(view.storage);
+    return result;
+}
+
+ninja_error_t ninja_export_fills(const char* path, const ninja_fill_t* fills, size_t count) {
+    if (!path || (!fills && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_fill_columns_t view;
+    ninja_error_t result = ninja_fills_to_columns(fills, count, &view);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    static const ninja_column_t columns[] = {
+        { "fill_id", NINJA_COLUMN_INT64 },
+        { "order_id", NINJA_COLUMN_INT64 },
+        { "timestamp_ns", NINJA_COLUMN_INT64 },
+        { "price", NINJA_COLUMN_DOUBLE },
+        { "contract_id", NINJA_COLUMN_INT32 },
+        { "quantity", NINJA_COLUMN_INT32 },
+        { "side", NINJA_COLUMN_UINT8 },
+        { "active", NINJA_COLUMN_UINT8 }
+    };
+    const void* values[] = {
+        view.fill_id, view.order_id, view.timestamp_ns, view.price,
+        view.contract_id, view.quantity, view.side, view.active
+    };
+
+    result = ninja_columns_export(path, columns, values, sizeof(columns) / sizeof(columns[0]), count);
+    free(view.storage);
+    return result;
+}
+
+ninja_error_t ninja_export_positions(const char* path, const ninja_position_t* positions, size_t count) {
+    if (!path || (!positions && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_position_columns_t view;
+    ninja_error_t result = ninja_positions_to_columns(positions, count, &view);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    static const ninja_column_t columns[] = {
+        { "timestamp_ns", NINJA_COLUMN_INT64 },
+        { "average_price", NINJA_COLUMN_DOUBLE },
+        { "unrealized_pnl", NINJA_COLUMN_DOUBLE },
+        { "realized_pnl", NINJA_COLUMN_DOUBLE },
+        { "account_id", NINJA_COLUMN_INT32 },
+        { "contract_id", NINJA_COLUMN_INT32 },
+        { "symbol", NINJA_COLUMN_TEXT },
+        { "net_position", NINJA_COLUMN_INT32 }
+    };
+    ninja_column_text_t symbol = { view.symbol, (const char (*)[NINJA_COLUMN_TEXT_SIZE])view.symbols,
+                                   view.symbol_count };
+    const void* values[] = {
+        view.timestamp_ns, view.average_price, view.unrealized_pnl, view.realized_pnl,
+        view.account_id, view.contract_id, &symbol, view.net_position
+    };
+
+    result = ninja_columns_export(path, columns, values, sizeof(columns) / sizeof(columns[0]), count);
+    free(view.storage);
+    return result;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+ninja_price_ticks_t ninja_price_to_ticks(double price, double tick_size) {
+    if (tick_size <= 0.0) {
+        return 0;
+    }
+    return (ninja_price_ticks_t)llround(price / tick_size);
+}
+
+double ninja_ticks_to_price(ninja_price_ticks_t ticks, double tick_size) {
+    return (double)ticks * tick_size;
+}
+
+ninja_error_t ninja_order_to_compact(const ninja_order_t* order,
+                                    double tick_size,
+                                    ninja_order_compact_t* compact) {
+    if (!order || !compact || tick_size <= 0.0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(compact, 0, sizeof(ninja_order_compact_t));
+
+    compact->order_id = order->order_id;
+    compact->timestamp_ns = order->timestamp_ns;
+    compact->price = ninja_price_to_ticks(order->price, tick_size);
+    compact->stop_price = ninja_price_to_ticks(order->stop_price, tick_size);
+    compact->filled_price = order->filled_price;
+    compact->account_id = order->account_id;
+    compact->quantity = order->quantity;
+    compact->filled_quantity = order->filled_quantity;
+    compact->side = (uint8_t)order->side;
+    compact->type = (uint8_t)order->type;
+    compact->status = (uint8_t)order->status;
+    compact->is_automated = order->is_automated ? 1 : 0;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_compact_orders(const ninja_order_t* orders,
+                                  size_t count,
+                                  double tick_size,
+                                  ninja_order_compact_t** compact,
+                                  ninja_order_cold_t** cold) {
+    if (!orders || !compact || tick_size <= 0.0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *compact = NULL;
+    if (cold) {
+        *cold = NULL;
+    }
+
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    // Allocate hot and cold tables separately so scans only touch the hot one
+    ninja_order_compact_t* hot_array = calloc(count, sizeof(ninja_order_compact_t));
+    if (!hot_array) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_order_cold_t* cold_array = NULL;
+    if (cold) {
+        cold_array = calloc(count, sizeof(ninja_order_cold_t));
+        if (!cold_array) {
+            free(hot_array);
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        ninja_order_to_compact(&orders[i], tick_size, &hot_array[i]);
+        hot_array[i].cold_index = (uint32_t)i;
+
+        if (cold_array) {
+            memcpy(cold_array[i].symbol, orders[i].symbol, sizeof(cold_array[i].symbol));
+            memcpy(cold_array[i].timestamp, orders[i].timestamp, sizeof(cold_array[i].timestamp));
+            memcpy(cold_array[i].error_text, orders[i].error_text, sizeof(cold_array[i].error_text));
+        }
+    }
+
+    *compact = hot_array;
+    if (cold) {
+        *cold = cold_array;
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_compact_positions(const ninja_position_t* positions,
+                                     size_t count,
+                                     ninja_position_compact_t** compact,
+                                     ninja_position_cold_t** cold) {
+    if (!positions || !compact) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *compact = NULL;
+    if (cold) {
+        *cold = NULL;
+    }
+
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    ninja_position_compact_t* hot_array = calloc(count, sizeof(ninja_position_compact_t));
+    if (!hot_array) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_position_cold_t* cold_array = NULL;
+    if (cold) {
+        cold_array = calloc(count, sizeof(ninja_position_cold_t));
+        if (!cold_array) {
+            free(hot_array);
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_position_t* position = &positions[i];
+        ninja_position_compact_t* hot = &hot_array[i];
+
+        hot->timestamp_ns = position->timestamp_ns;
+        hot->average_price = position->average_price;
+        hot->unrealized_pnl = position->unrealized_pnl;
+        hot->realized_pnl = position->realized_pnl;
+        hot->account_id = position->account_id;
+        hot->contract_id = position->contract_id;
+        hot->net_position = position->net_position;
+        hot->cold_index = (uint32_t)i;
+
+        if (cold_array) {
+            memcpy(cold_array[i].symbol, position->symbol, sizeof(cold_array[i].symbol));
+            memcpy(cold_array[i].timestamp, position->timestamp, sizeof(cold_array[i].timestamp));
+        }
+    }
+
+    *compact = hot_array;
+    if (cold) {
+        *cold = cold_array;
+    }
+
+    return NINJA_OK;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_context.h"
+#include "ninja_atomic.h"
+#include <string.h>
+
+static ninja_context_t ninja_context;
+
+// References held through ninja_library_init, a subset of the total
+static uint64_t ninja_library_references;
+
+// Spin lock over acquire/release. Held only while counting references, and
+// through global init and cleanup on the first and last one.
+static volatile uint64_t ninja_context_guard;
+
+// Helper function to take the context guard
+static void ninja_context_lock(void) {
+    uint64_t expected = 0;
+    while (!ninja_atomic_compare_exchange(&ninja_context_guard, &expected, 1)) {
+        expected = 0;
+        ninja_cpu_relax();
+    }
+}
+
+// Helper function to drop the context guard
+static void ninja_context_unlock(void) {
+    ninja_atomic_store_release(&ninja_context_guard, 0);
+}
+
+// Share lock callbacks for libcurl: one mutex per kind of shared data
+static void ninja_share_lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* user_data) {
+    (void)handle;
+    (void)access;
+    ninja_context_t* context = (ninja_context_t*)user_data;
+    ninja_mutex_lock(&context->locks[data]);
+}
+
+static void ninja_share_unlock(CURL* handle, curl_lock_data data, void* user_data) {
+    (void)handle;
+    ninja_context_t* context = (ninja_context_t*)user_data;
+    ninja_mutex_unlock(&context->locks[data]);
+}
+
+// Helper function to set up global state for the first reference
+static bool ninja_context_open(ninja_context_t* context) {
+    if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK) {
+        return false;
+    }
+
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        ninja_mutex_init(&context->locks[i]);
+    }
+
+    // Connections themselves stay per client: libcurl does not support one
+    // connection cache used from several threads at once. Resolved hosts and
+    // TLS sessions are what make a new client's first connection expensive.
+    context->share = curl_share_init();
+    if (context->share) {
+        curl_share_setopt(context->share, CURLSHOPT_LOCKFUNC, ninja_share_lock);
+        curl_share_setopt(context->share, CURLSHOPT_UNLOCKFUNC, ninja_share_unlock);
+        curl_share_setopt(context->share, CURLSHOPT_USERDATA, context);
+        curl_share_setopt(context->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(context->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+
+    return true;
+}
+
+// Helper function to tear down global state after the last reference
+static void ninja_context_close(ninja_context_t* context) {
+    if (context->share) {
+        curl_share_cleanup(context->share);
+        context->share = NULL;
+    }
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        ninja_mutex_destroy(&context->locks[i]);
+    }
+    curl_global_cleanup();
+}
+
+ninja_context_t* ninja_context_acquire(void) {
+    ninja_context_lock();
+    ninja_context_t* context = &ninja_context;
+    if (context->references == 0 && !ninja_context_open(context)) {
+        context = NULL;
+    } else {
+        context->references++;
+    }
+    ninja_context_unlock();
+
+    return context;
+}
+
+void ninja_context_release(ninja_context_t* context) {
+    if (!context) {
+        return;
+    }
+
+    ninja_context_lock();
+    if (context->references > 0 && --context->references == 0) {
+        ninja_context_close(context);
+    }
+    ninja_context_unlock();
+}
+
+ninja_error_t ninja_library_init(void) {
+    if (!ninja_context_acquire()) {
+        return NINJA_ERROR_CONNECTION;
+    }
+
+    ninja_context_lock();
+    ninja_library_references++;
+    ninja_context_unlock();
+
+    return NINJA_OK;
+}
+
+void ninja_library_cleanup(void) {
+    // Never drops a reference a live client holds
+    ninja_context_lock();
+    bool held = ninja_library_references > 0;
+    if (held) {
+        ninja_library_references--;
+    }
+    ninja_context_unlock();
+
+    if (held) {
+        ninja_context_release(&ninja_context);
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_thread.h"
+#include <curl/curl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Process-wide library state: libcurl's global init plus a share handle that
+// every client's connections use for DNS lookups and TLS sessions. Each live
+// client and each ninja_library_init() holds a reference; the last release
+// tears it down.
+typedef struct {
+    uint64_t references;
+    CURLSH* share;
+    ninja_mutex_t locks[CURL_LOCK_DATA_LAST];
+} ninja_context_t;
+
+// NULL if libcurl could not be initialized
+ninja_context_t* ninja_context_acquire(void);
+void ninja_context_release(ninja_context_t* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_contract_index.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Longest search term compared; full_name is the longest indexed field
+#define NINJA_CONTRACT_PREFIX_SIZE 128
+
+// Helper function to measure a fixed-size field that may fill its array
+static size_t ninja_field_length(const char* field, size_t size) {
+    size_t length = 0;
+    while (length < size - 1 && field[length] != '\0') {
+        length++;
+    }
+    return length;
+}
+
+// Helper function to copy a field upper-cased into the text pool
+static char* ninja_pool_add(char** pool, const char* field, size_t length) {
+    char* start = *pool;
+    for (size_t i = 0; i < length; i++) {
+        char c = field[i];
+        start[i] = c >= 'a' && c <= 'z' ? (char)(c - 'a' + 'A') : c;
+    }
+    start[length] = '\0';
+    *pool += length + 1;
+    return start;
+}
+
+// Helper function to tell whether a character can start a word of full_name
+static bool ninja_word_char(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || (unsigned char)c >= 0x80;
+}
+
+// Helper function to order keys by text, then record
+static int ninja_contract_key_compare(const void* a, const void* b) {
+    const ninja_contract_key_t* left = (const ninja_contract_key_t*)a;
+    const ninja_contract_key_t* right = (const ninja_contract_key_t*)b;
+    int order = strcmp(left->text, right->text);
+    if (order != 0) {
+        return order;
+    }
+    return left->record < right->record ? -1 : left->record > right->record ? 1 : 0;
+}
+
+// Helper function to rebuild the index from every catalog record
+static ninja_error_t ninja_contract_index_build(ninja_contract_index_t* index, const ninja_catalog_t* catalog) {
+    free(index->keys);
+    free(index->text);
+    free(index->seen);
+    index->keys = NULL;
+    index->text = NULL;
+    index->seen = NULL;
+    index->built = false;
+
+    // Size the pool and the keys: a name equal to the symbol is not indexed twice
+    size_t text_size = 0;
+    size_t counts[NINJA_CONTRACT_KEY_FULL_NAME + 1] = { 0, 0, 0 };
+    for (size_t r = 0; r < catalog->count; r++) {
+        const ninja_contract_t* contract = &catalog->records[r];
+        size_t symbol = ninja_field_length(contract->symbol, sizeof(contract->symbol));
+        size_t name = ninja_field_length(contract->name, sizeof(contract->name));
+        size_t full_name = ninja_field_length(contract->full_name, sizeof(contract->full_name));
+
+        text_size += symbol + 1 + name + 1 + full_name + 1;
+        counts[NINJA_CONTRACT_KEY_SYMBOL]++;
+        counts[NINJA_CONTRACT_KEY_NAME] += name > 0 ? 1 : 0;
+        for (size_t i = 0; i < full_name; i++) {
+            bool start = ninja_word_char(contract->full_name[i]) && (i == 0 || !ninja_word_char(contract->full_name[i - 1]));
+            counts[NINJA_CONTRACT_KEY_FULL_NAME] += start ? 1 : 0;
+        }
+    }
+
+    size_t key_count = counts[0] + counts[1] + counts[2];
+    index->text = malloc(text_size > 0 ? text_size : 1);
+    index->keys = malloc((key_count > 0 ? key_count : 1) * sizeof(ninja_contract_key_t));
+    index->seen = calloc(catalog->count > 0 ? catalog->count : 1, sizeof(uint32_t));
+    if (!index->text || !index->keys || !index->seen) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    size_t next[NINJA_CONTRACT_KEY_FULL_NAME + 1];
+    index->kind_start[0] = 0;
+    for (size_t k = 0; k <= NINJA_CONTRACT_KEY_FULL_NAME; k++) {
+        index->kind_start[k + 1] = index->kind_start[k] + counts[k];
+        next[k] = index->kind_start[k];
+    }
+
+    char* pool = index->text;
+    for (size_t r = 0; r < catalog->count; r++) {
+        const ninja_contract_t* contract = &catalog->records[r];
+        const char* symbol = ninja_pool_add(&pool, contract->symbol, ninja_field_length(contract->symbol, sizeof(contract->symbol)));
+        index->keys[next[NINJA_CONTRACT_KEY_SYMBOL]++] = (ninja_contract_key_t){ symbol, (uint32_t)r };
+
+        size_t name_length = ninja_field_length(contract->name, sizeof(contract->name));
+        if (name_length > 0) {
+            const char* name = ninja_pool_add(&pool, contract->name, name_length);
+            index->keys[next[NINJA_CONTRACT_KEY_NAME]++] = (ninja_contract_key_t){ name, (uint32_t)r };
+        }
+
+        // One key per word start, each running to the end of full_name
+        size_t full_length = ninja_field_length(contract->full_name, sizeof(contract->full_name));
+        const char* full_name = ninja_pool_add(&pool, contract->full_name, full_length);
+        for (size_t i = 0; i < full_length; i++) {
+            if (ninja_word_char(full_name[i]) && (i == 0 || !ninja_word_char(full_name[i - 1]))) {
+                index->keys[next[NINJA_CONTRACT_KEY_FULL_NAME]++] = (ninja_contract_key_t){ full_name + i, (uint32_t)r };
+            }
+        }
+    }
+
+    // Names equal to their symbol add nothing; drop them before sorting
+    size_t kept = index->kind_start[NINJA_CONTRACT_KEY_NAME];
+    for (size_t i = index->kind_start[NINJA_CONTRACT_KEY_NAME]; i < index->kind_start[NINJA_CONTRACT_KEY_NAME + 1]; i++) {
+        const ninja_contract_key_t* key = &index->keys[i];
+        if (strcmp(key->text, index->keys[key->record].text) != 0) {
+            index->keys[kept++] = *key;
+        }
+    }
+    size_t dropped = index->kind_start[NINJA_CONTRACT_KEY_NAME + 1] - kept;
+    if (dropped > 0) {
+        memmove(&index->keys[kept], &index->keys[index->kind_start[NINJA_CONTRACT_KEY_FULL_NAME]],
+                counts[NINJA_CONTRACT_KEY_FULL_NAME] * sizeof(ninja_contract_key_t));
+        index->kind_start[NINJA_CONTRACT_KEY_FULL_NAME] -= dropped;
+        index->kind_start[NINJA_CONTRACT_KEY_FULL_NAME + 1] -= dropped;
+    }
+
+    for (size_t k = 0; k <= NINJA_CONTRACT_KEY_FULL_NAME; k++) {
+        qsort(&index->keys[index->kind_start[k]], index->kind_start[k + 1] - index->kind_start[k],
+              sizeof(ninja_contract_key_t), ninja_contract_key_compare);
+    }
+
+    index->search = 0;
+    index->record_count = catalog->count;
+    index->revision = catalog->revision;
+    index->built = true;
+    return NINJA_OK;
+}
+
+// Helper function to upper-case a search term; false if it is too long to match anything
+static bool ninja_contract_term(const char* term, char* out, size_t size) {
+    size_t length = 0;
+    for (; term[length] != '\0'; length++) {
+        if (length + 1 >= size) {
+            return false;
+        }
+        char c = term[length];
+        out[length] = c >= 'a' && c <= 'z' ? (char)(c - 'a' + 'A') : c;
+    }
+    out[length] = '\0';
+    return true;
+}
+
+ninja_error_t ninja_contract_index_search(ninja_contract_index_t* index,
+                                          const ninja_catalog_t* catalog,
+                                          const char* prefix,
+                                          size_t max,
+                                          uint32_t** records,
+                                          size_t* count) {
+    if (!index || !catalog || !prefix || !records || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *records = NULL;
+    *count = 0;
+
+    if (!index->built || index->revision != catalog->revision || index->record_count != catalog->count) {
+        ninja_error_t result = ninja_contract_index_build(index, catalog);
+        if (result != NINJA_OK) {
+            return result;
+        }
+    }
+
+    char term[NINJA_CONTRACT_PREFIX_SIZE];
+    if (!ninja_contract_term(prefix, term, sizeof(term)) || index->record_count == 0) {
+        return NINJA_OK;
+    }
+    size_t length = strlen(term);
+
+    // A fresh stamp per search marks records already returned
+    if (++index->search == 0) {
+        memset(index->seen, 0, index->record_count * sizeof(uint32_t));
+        index->search = 1;
+    }
+
+    size_t capacity = max > 0 && max < 64 ? max : 64;
+    uint32_t* found = malloc(capacity * sizeof(uint32_t));
+    if (!found) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    size_t total = 0;
+    for (size_t k = 0; k <= NINJA_CONTRACT_KEY_FULL_NAME && (max == 0 || total < max); k++) {
+        // First key not below the term, then every key it prefixes
+        size_t low = index->kind_start[k];
+        size_t high = index->kind_start[k + 1];
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if (strcmp(index->keys[middle].text, term) < 0) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        for (size_t i = low; i < index->kind_start[k + 1] && (max == 0 || total < max); i++) {
+            const ninja_contract_key_t* key = &index->keys[i];
+            if (strncmp(key->text, term, length) != 0) {
+                break;
+            }
+            if (index->seen[key->record] == index->search) {
+                continue;
+            }
+            index->seen[key->record] = index->search;
+
+            if (total == capacity) {
+                uint32_t* grown = realloc(found, capacity * 2 * sizeof(uint32_t));
+                if (!grown) {
+                    free(found);
+                    return NINJA_ERROR_MEMORY;
+                }
+                found = grown;
+                capacity *= 2;
+            }
+            found[total++] = key->record;
+        }
+    }
+
+    if (total == 0) {
+        free(found);
+        return NINJA_OK;
+    }
+
+    *records = found;
+    *count = total;
+    return NINJA_OK;
+}
+
+void ninja_contract_index_add_miss(ninja_contract_index_t* index, const ninja_catalog_t* catalog, const char* term) {
+    if (!index || !catalog || !term) {
+        return;
+    }
+
+    char upper[NINJA_CONTRACT_TERM_SIZE];
+    if (!ninja_contract_term(term, upper, sizeof(upper)) || upper[0] == '\0') {
+        return;
+    }
+
+    // Misses seen before the catalog last changed may have contracts by now
+    if (index->miss_revision != catalog->revision) {
+        index->miss_count = 0;
+        index->miss_revision = catalog->revision;
+    }
+
+    // Oldest entries are overwritten once the table is full
+    size_t slot = index->miss_count % NINJA_CONTRACT_MISSES;
+    memcpy(index->misses[slot], upper, sizeof(upper));
+    index->miss_ns[slot] = ninja_monotonic_ns();
+    index->miss_count++;
+}
+
+bool ninja_contract_index_known_miss(const ninja_contract_index_t* index,
+                                     const ninja_catalog_t* catalog,
+                                     const char* term) {
+    if (!index || !catalog || !term || index->miss_revision != catalog->revision) {
+        return false;
+    }
+
+    char upper[NINJA_CONTRACT_PREFIX_SIZE];
+    if (!ninja_contract_term(term, upper, sizeof(upper))) {
+        return false;
+    }
+
+    int64_t now_ns = ninja_monotonic_ns();
+    size_t stored = index->miss_count < NINJA_CONTRACT_MISSES ? index->miss_count : NINJA_CONTRACT_MISSES;
+    for (size_t i = 0; i < stored; i++) {
+        if (now_ns - index->miss_ns[i] > NINJA_CONTRACT_MISS_TTL_NS) {
+            continue;
+        }
+        size_t length = strlen(index->misses[i]);
+        if (strncmp(upper, index->misses[i], length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ninja_contract_index_free(ninja_contract_index_t* index) {
+    if (!index) {
+        return;
+    }
+
+    free(index->keys);
+    free(index->text);
+    free(index->seen);
+    memset(index, 0, sizeof(ninja_contract_index_t));
+}
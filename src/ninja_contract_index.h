@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_catalog.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Search terms the server had no contracts for; any longer term starting
+// with one is answered locally until the catalog changes or the miss is
+// older than the TTL, after which the server is asked again
+#define NINJA_CONTRACT_MISSES 64
+#define NINJA_CONTRACT_TERM_SIZE 32
+#define NINJA_CONTRACT_MISS_TTL_NS (300LL * 1000000000LL)
+
+// What a key matched, in result order
+typedef enum {
+    NINJA_CONTRACT_KEY_SYMBOL,
+    NINJA_CONTRACT_KEY_NAME,
+    NINJA_CONTRACT_KEY_FULL_NAME    // full_name from the start of any word
+} ninja_contract_key_kind_t;
+
+typedef struct {
+    const char* text;           // Upper-cased, in the index's text pool
+    uint32_t record;            // Catalog record index
+} ninja_contract_key_t;
+
+// Sorted-prefix index over the catalog's symbol, name and full_name. Keys
+// are sorted within each kind, so a prefix is one binary search per kind
+// and results come out symbol matches first. Rebuilt lazily when the
+// catalog's revision moves.
+typedef struct {
+    ninja_contract_key_t* keys;
+    size_t kind_start[NINJA_CONTRACT_KEY_FULL_NAME + 2];
+    char* text;
+    uint32_t* seen;             // Per record: the search that last returned it
+    uint32_t search;
+    size_t record_count;
+    uint64_t revision;
+    bool built;
+
+    char misses[NINJA_CONTRACT_MISSES][NINJA_CONTRACT_TERM_SIZE];
+    int64_t miss_ns[NINJA_CONTRACT_MISSES];    // Monotonic time each miss was seen
+    size_t miss_count;
+    uint64_t miss_revision;     // Catalog revision the misses were seen at
+} ninja_contract_index_t;
+
+// Catalog record indexes of contracts matching prefix, at most max (0 for all)
+ninja_error_t ninja_contract_index_search(ninja_contract_index_t* index,
+                                          const ninja_catalog_t* catalog,
+                                          const char* prefix,
+                                          size_t max,
+                                          uint32_t** records,
+                                          size_t* count);
+
+// Remember a term the server had no contracts for
+void ninja_contract_index_add_miss(ninja_contract_index_t* index, const ninja_catalog_t* catalog, const char* term);
+
+// Whether term extends a term the server recently had no contracts for
+bool ninja_contract_index_known_miss(const ninja_contract_index_t* index,
+                                     const ninja_catalog_t* catalog,
+                                     const char* term);
+
+void ninja_contract_index_free(ninja_contract_index_t* index);
+
+#ifdef __cplusplus
+}
+#endif
@@ -22,79 +22,63 @@
 
 #include "../include/ninja/ninja_api.h"
 #include "ninja_client.h"
+#include "ninja_schema.h"
 #include "cJSON.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
-// Helper function to parse JSON contract into ninja_contract_t
-static ninja_error_t ninja_parse_contract(cJSON* contract_json, ninja_contract_t* contract) {
-    if (!contract_json || !contract) {
-        return NINJA_ERROR_INVALID_PARAM;
-    }
-
-    // Clear contract structure
-    memset(contract, 0, sizeof(ninja_contract_t));
-
-    // Parse contract fields
-    cJSON* id = cJSON_GetObjectItemCaseSensitive(contract_json, "id");
-    if (id && cJSON_IsNumber(id)) {
-        contract->contract_id = (int)cJSON_GetNumberValue(id);
-    }
-
-    cJSON* symbol = cJSON_GetObjectItemCaseSensitive(contract_json, "name");
-    if (symbol && cJSON_IsString(symbol)) {
-        strncpy(contract->symbol, cJSON_GetStringValue(symbol), sizeof(contract->symbol) - 1);
-        strncpy(contract->name, cJSON_GetStringValue(symbol), sizeof(contract->name) - 1);
-    }
-
-    cJSON* full_name = cJSON_GetObjectItemCaseSensitive(contract_json, "fullName");
-    if (full_name && cJSON_IsString(full_name)) {
-        strncpy(contract->full_name, cJSON_GetStringValue(full_name), sizeof(contract->full_name) - 1);
-    }
-
-    cJSON* exchange = cJSON_GetObjectItemCaseSensitive(contract_json, "exchange");
-    if (exchange && cJSON_IsString(exchange)) {
-        strncpy(contract->exchange, cJSON_GetStringValue(exchange), sizeof(contract->exchange) - 1);
-    }
-
-    cJSON* currency = cJSON_GetObjectItemCaseSensitive(contract_json, "currency");
-    if (currency && cJSON_IsString(currency)) {
-        strncpy(contract->currency, cJSON_GetStringValue(currency), sizeof(contract->currency) - 1);
-    } else {
-        strcpy(contract->currency, "USD"); // Default to USD
+// Helper function to decode the contract name, used as both symbol and name
+static void ninja_decode_contract_name(const cJSON* item, void* out) {
+    ninja_contract_t* contract = (ninja_contract_t*)out;
+    if (cJSON_IsString(item) && item->valuestring) {
+        strncpy(contract->symbol, item->valuestring, sizeof(contract->symbol) - 1);
+        strncpy(contract->name, item->valuestring, sizeof(contract->name) - 1);
     }
+}
 
-    cJSON* tick_size = cJSON_GetObjectItemCaseSensitive(contract_json, "tickSize");
-    if (tick_size && cJSON_IsNumber(tick_size)) {
-        contract->tick_size = cJSON_GetNumberValue(tick_size);
-    }
+// JSON schema of ninja_contract_t
+static const ninja_field_t ninja_contract_fields[] = {
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "id", NINJA_FIELD_INT, contract_id)
+    NINJA_SCHEMA_CUSTOM("name", ninja_decode_contract_name)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "fullName", NINJA_FIELD_STRING, full_name)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "exchange", NINJA_FIELD_STRING, exchange)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "currency", NINJA_FIELD_STRING, currency)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "tickSize", NINJA_FIELD_DOUBLE, tick_size)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "tickValue", NINJA_FIELD_DOUBLE, tick_value)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "contractSize", NINJA_FIELD_INT, contract_multiplier)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "expirationDate", NINJA_FIELD_STRING, expiry_date)
+    NINJA_SCHEMA_FIELD(ninja_contract_t, "isTradable", NINJA_FIELD_BOOL, is_tradable)
+};
+
+// Helper function to apply defaults for fields the server may omit
+static void ninja_init_contract(void* record) {
+    ninja_contract_t* contract = (ninja_contract_t*)record;
+    strcpy(contract->currency, "USD");
+    contract->contract_multiplier = 1; // Default multiplier
+    contract->is_tradable = true; // Assume tradable by default
+}
 
-    cJSON* tick_value = cJSON_GetObjectItemCaseSensitive(contract_json, "tickValue");
-    if (tick_value && cJSON_IsNumber(tick_value)) {
-        contract->tick_value = cJSON_GetNumberValue(tick_value);
-    }
+// Contracts per contract/items request when refreshing the catalog, sized so
+// the id list fits the request URL
+#define NINJA_CATALOG_REFRESH_BATCH 32
 
-    cJSON* contract_size = cJSON_GetObjectItemCaseSensitive(contract_json, "contractSize");
-    if (contract_size && cJSON_IsNumber(contract_size)) {
-        contract->contract_multiplier = (int)cJSON_GetNumberValue(contract_size);
-    } else {
-        contract->contract_multiplier = 1; // Default multiplier
-    }
+// Helper function to check whether the client keeps a contract catalog
+static bool ninja_catalog_enabled(const ninja_client_t* client) {
+    return client->contract_catalog.path[0] != '\0';
+}
 
-    cJSON* expiry_date = cJSON_GetObjectItemCaseSensitive(contract_json, "expirationDate");
-    if (expiry_date && cJSON_IsString(expiry_date)) {
-        strncpy(contract->expiry_date, cJSON_GetStringValue(expiry_date), sizeof(contract->expiry_date) - 1);
+// Helper function to parse JSON contract into ninja_contract_t
+ninja_error_t ninja_parse_contract(cJSON* contract_json, ninja_contract_t* contract) {
+    if (!contract_json || !contract) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    cJSON* tradable = cJSON_GetObjectItemCaseSensitive(contract_json, "isTradable");
-    if (tradable && cJSON_IsBool(tradable)) {
-        contract->is_tradable = cJSON_IsTrue(tradable);
-    } else {
-        contract->is_tradable = true; // Assume tradable by default
-    }
+    // Clear contract structure and apply defaults for optional fields
+    memset(contract, 0, sizeof(ninja_contract_t));
+    ninja_init_contract(contract);
 
-    return NINJA_OK;
+    return ninja_schema_decode(ninja_contract_fields, NINJA_SCHEMA_COUNT(ninja_contract_fields), contract_json, contract);
 }
 
 ninja_error_t ninja_get_contract_by_symbol(ninja_client_t* client,
@@ -104,6 +88,13 @@ ninja_error_t ninja_get_contract_by_symbol(ninja_client_t* client,
         return NINJA_ERROR_INVALID_PARAM;
     }
 
+    // Serve from the catalog, even when stale, so startup needs no round trip
+    const ninja_contract_t* cached = ninja_catalog_find_symbol(&client->contract_catalog, symbol);
+    if (cached) {
+        *contract = *cached;
+        return NINJA_OK;
+    }
+
     char endpoint[256];
     snprintf(endpoint, sizeof(endpoint), "contract/find?name=%s", symbol);
 
@@ -126,6 +117,10 @@ ninja_error_t ninja_get_contract_by_symbol(ninja_client_t* client,
     result = ninja_parse_contract(response_json, contract);
     cJSON_Delete(response_json);
 
+    if (result == NINJA_OK && ninja_catalog_enabled(client)) {
+        ninja_catalog_put(&client->contract_catalog, contract);
+    }
+
     return result;
 }
 
@@ -136,6 +131,12 @@ ninja_error_t ninja_get_contract_by_id(ninja_client_t* client,
         return NINJA_ERROR_INVALID_PARAM;
     }
 
+    const ninja_contract_t* cached = ninja_catalog_find_id(&client->contract_catalog, contract_id);
+    if (cached) {
+        *contract = *cached;
+        return NINJA_OK;
+    }
+
     char endpoint[256];
     snprintf(endpoint, sizeof(endpoint), "contract/item?id=%d", contract_id);
 
@@ -158,9 +159,48 @@ ninja_error_t ninja_get_contract_by_id(ninja_client_t* client,
     result = ninja_parse_contract(response_json, contract);
     cJSON_Delete(response_json);
 
+    if (result == NINJA_OK && ninja_catalog_enabled(client)) {
+        ninja_catalog_put(&client->contract_catalog, contract);
+    }
+
     return result;
 }
 
+ninja_error_t ninja_search_contracts(ninja_client_t* client,
+                                    const char* prefix,
+                                    size_t max,
+                                    ninja_contract_t** contracts,
+                                    size_t* count) {
+    if (!client || !prefix || !contracts || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *contracts = NULL;
+    *count = 0;
+
+    uint32_t* records = NULL;
+    size_t found = 0;
+    ninja_error_t result = ninja_contract_index_search(&client->contract_index, &client->contract_catalog,
+                                                       prefix, max, &records, &found);
+    if (result != NINJA_OK || found == 0) {
+        return result;
+    }
+
+    ninja_contract_t* matches = malloc(found * sizeof(ninja_contract_t));
+    if (!matches) {
+        free(records);
+        return NINJA_ERROR_MEMORY;
+    }
+    for (size_t i = 0; i < found; i++) {
+        matches[i] = client->contract_catalog.records[records[i]];
+    }
+    free(records);
+
+    *contracts = matches;
+    *count = found;
+    return NINJA_OK;
+}
+
 ninja_error_t ninja_find_contracts(ninja_client_t* client,
                                   const char* search_term,
                                   ninja_contract_t** contracts,
@@ -172,6 +212,16 @@ ninja_error_t ninja_find_contracts(ninja_client_t* client,
     *contracts = NULL;
     *count = 0;
 
+    // Answer from the catalog when it has matches, or the server had none
+    // for this term or a shorter one
+    if (ninja_catalog_enabled(client)) {
+        ninja_error_t result = ninja_search_contracts(client, search_term, 0, contracts, count);
+        if (result != NINJA_OK || *count > 0 ||
+            ninja_contract_index_known_miss(&client->contract_index, &client->contract_catalog, search_term)) {
+            return result;
+        }
+    }
+
     char endpoint[256];
     snprintf(endpoint, sizeof(endpoint), "contract/suggest?t=%s", search_term);
 
@@ -184,43 +234,121 @@ ninja_error_t ninja_find_contracts(ninja_client_t* client,
     }
 
     // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
+    result = ninja_parse_contracts(response.data, response.size, contracts, count);
     ninja_http_response_free(&response);
 
-    if (!response_json) {
-        return NINJA_ERROR_JSON_PARSE;
+    if (result == NINJA_OK && ninja_catalog_enabled(client)) {
+        ninja_add_catalog_contracts(client, *contracts, *count);
+        if (*count == 0) {
+            ninja_contract_index_add_miss(&client->contract_index, &client->contract_catalog, search_term);
+        }
     }
 
-    if (!cJSON_IsArray(response_json)) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_JSON_PARSE;
+    return result;
+}
+
+ninja_error_t ninja_add_catalog_contracts(ninja_client_t* client,
+                                         const ninja_contract_t* contracts,
+                                         size_t count) {
+    if (!client || (!contracts && count > 0) || !ninja_catalog_enabled(client)) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    size_t contract_count = cJSON_GetArraySize(response_json);
-    if (contract_count == 0) {
-        cJSON_Delete(response_json);
-        return NINJA_OK;
+    for (size_t i = 0; i < count; i++) {
+        ninja_error_t result = ninja_catalog_put(&client->contract_catalog, &contracts[i]);
+        if (result != NINJA_OK) {
+            return result;
+        }
     }
 
-    // Allocate memory for contracts
-    ninja_contract_t* contract_array = calloc(contract_count, sizeof(ninja_contract_t));
-    if (!contract_array) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_MEMORY;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_refresh_contract_catalog(ninja_client_t* client,
+                                            size_t max_contracts,
+                                            size_t* remaining) {
+    if (!client || !ninja_catalog_enabled(client)) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Parse each contract
-    for (size_t i = 0; i < contract_count; i++) {
-        cJSON* contract_json = cJSON_GetArrayItem(response_json, i);
-        if (contract_json) {
-            ninja_parse_contract(contract_json, &contract_array[i]);
+    ninja_catalog_t* catalog = &client->contract_catalog;
+    size_t budget = max_contracts > 0 ? max_contracts : catalog->stale_count;
+    ninja_error_t result = NINJA_OK;
+
+    // Refresh queued contracts in batches; a failed batch stays queued
+    while (catalog->stale_count > 0 && budget > 0) {
+        size_t batch = catalog->stale_count < NINJA_CATALOG_REFRESH_BATCH ? catalog->stale_count : NINJA_CATALOG_REFRESH_BATCH;
+        if (batch > budget) {
+            batch = budget;
+        }
+        const int* ids = catalog->stale_ids + catalog->stale_count - batch;
+
+        char endpoint[448];
+        int length = snprintf(endpoint, sizeof(endpoint), "contract/items?ids=");
+        for (size_t i = 0; i < batch; i++) {
+            length += snprintf(endpoint + length, sizeof(endpoint) - length, i > 0 ? ",%d" : "%d", ids[i]);
+        }
+
+        ninja_http_response_t response;
+        result = ninja_http_get(client, endpoint, &response);
+        if (result != NINJA_OK) {
+            break;
+        }
+
+        ninja_contract_t* contracts = NULL;
+        size_t count = 0;
+        result = ninja_parse_contracts(response.data, response.size, &contracts, &count);
+        ninja_http_response_free(&response);
+        if (result == NINJA_OK) {
+            result = ninja_add_catalog_contracts(client, contracts, count);
         }
+        ninja_free_array(contracts);
+        if (result != NINJA_OK) {
+            break;
+        }
+
+        ninja_catalog_mark_refreshed(catalog, batch);
+        budget -= batch;
+    }
+
+    if (remaining) {
+        *remaining = catalog->stale_count;
+    }
+
+    return result;
+}
+
+ninja_error_t ninja_save_contract_catalog(ninja_client_t* client) {
+    if (!client || !ninja_catalog_enabled(client)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_catalog_save(&client->contract_catalog);
+}
+
+ninja_error_t ninja_parse_contracts(const char* json,
+                                   size_t length,
+                                   ninja_contract_t** contracts,
+                                   size_t* count) {
+    if (!json || !contracts || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
+    *contracts = NULL;
+    *count = 0;
+
+    cJSON* response_json = cJSON_ParseWithLength(json, length);
+    if (!response_json) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    // Decode every contract in one pass over the array
+    void* contract_array = NULL;
+    ninja_error_t result = ninja_schema_decode_array(ninja_contract_fields, NINJA_SCHEMA_COUNT(ninja_contract_fields),
+                                                     response_json, sizeof(ninja_contract_t), ninja_init_contract,
+                                                     &contract_array, count);
     cJSON_Delete(response_json);
 
     *contracts = contract_array;
-    *count = contract_count;
-
-    return NINJA_OK;
-}
\ No newline at end of file
+    return result;
+}
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_delta.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+
+uint64_t ninja_hash_bytes(const void* data, size_t length) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)length;
+
+    // Eight bytes per multiply; bodies are hashed on every poll
+    while (length >= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof(word));
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 32;
+        bytes += sizeof(word);
+        length -= sizeof(word);
+    }
+
+    uint64_t tail = 0;
+    memcpy(&tail, bytes, length);
+    hash = (hash ^ tail) * 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 29;
+
+    return hash;
+}
+
+// Helper function to order index entries by key
+static int ninja_compare_entries(const void* a, const void* b) {
+    uint64_t left = ((const ninja_delta_entry_t*)a)->key;
+    uint64_t right = ((const ninja_delta_entry_t*)b)->key;
+    return (left > right) - (left < right);
+}
+
+ninja_error_t ninja_delta_index(const void* records,
+                               size_t count,
+                               size_t record_size,
+                               ninja_record_key_fn key,
+                               ninja_delta_entry_t** index) {
+    if ((!records && count > 0) || !key || !index) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *index = malloc((count + 1) * sizeof(ninja_delta_entry_t));
+    if (!*index) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    // Decoded records start zeroed, so hashing the raw bytes is stable
+    const char* record = (const char*)records;
+    for (size_t i = 0; i < count; i++, record += record_size) {
+        (*index)[i].key = key(record);
+        (*index)[i].hash = ninja_hash_bytes(record, record_size);
+        (*index)[i].index = i;
+    }
+    qsort(*index, count, sizeof(ninja_delta_entry_t), ninja_compare_entries);
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_delta_diff(const void* previous,
+                              const ninja_delta_entry_t* previous_index,
+                              size_t previous_count,
+                              const void* current,
+                              const ninja_delta_entry_t* current_index,
+                              size_t current_count,
+                              size_t record_size,
+                              ninja_list_delta_t* delta) {
+    if (!delta) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(delta, 0, sizeof(ninja_list_delta_t));
+
+    // Count first so the delta is one allocation in added/changed/removed order
+    size_t i = 0;
+    size_t j = 0;
+    while (i < previous_count || j < current_count) {
+        if (j == current_count || (i < previous_count && previous_index[i].key < current_index[j].key)) {
+            delta->removed++;
+            i++;
+        } else if (i == previous_count || current_index[j].key < previous_index[i].key) {
+            delta->added++;
+            j++;
+        } else {
+            delta->changed += previous_index[i].hash != current_index[j].hash;
+            i++;
+            j++;
+        }
+    }
+
+    size_t total = delta->added + delta->changed + delta->removed;
+    if (total == 0) {
+        return NINJA_OK;
+    }
+
+    char* records = malloc(total * record_size);
+    if (!records) {
+        memset(delta, 0, sizeof(ninja_list_delta_t));
+        return NINJA_ERROR_MEMORY;
+    }
+
+    char* added = records;
+    char* changed = added + delta->added * record_size;
+    char* removed = changed + delta->changed * record_size;
+    const char* previous_records = (const char*)previous;
+    const char* current_records = (const char*)current;
+
+    i = 0;
+    j = 0;
+    while (i < previous_count || j < current_count) {
+        if (j == current_count || (i < previous_count && previous_index[i].key < current_index[j].key)) {
+            memcpy(removed, previous_records + previous_index[i].index * record_size, record_size);
+            removed += record_size;
+            i++;
+        } else if (i == previous_count || current_index[j].key < previous_index[i].key) {
+            memcpy(added, current_records + current_index[j].index * record_size, record_size);
+            added += record_size;
+            j++;
+        } else {
+            if (previous_index[i].hash != current_index[j].hash) {
+                memcpy(changed, current_records + current_index[j].index * record_size, record_size);
+                changed += record_size;
+            }
+            i++;
+            j++;
+        }
+    }
+
+    delta->records = records;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_delta_compare(const void* previous,
+                                 size_t previous_count,
+                                 const void* current,
+                                 size_t current_count,
+                                 size_t record_size,
+                                 ninja_record_key_fn key,
+                                 ninja_list_delta_t* delta) {
+    if (!delta) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(delta, 0, sizeof(ninja_list_delta_t));
+
+    ninja_delta_entry_t* previous_index = NULL;
+    ninja_delta_entry_t* current_index = NULL;
+
+    ninja_error_t result = ninja_delta_index(previous, previous_count, record_size, key, &previous_index);
+    if (result == NINJA_OK) {
+        result = ninja_delta_index(current, current_count, record_size, key, &current_index);
+    }
+    if (result == NINJA_OK) {
+        result = ninja_delta_diff(previous, previous_index, previous_count,
+                                  current, current_index, current_count,
+                                  record_size, delta);
+    }
+
+    free(previous_index);
+    free(current_index);
+    return result;
+}
+
+ninja_error_t ninja_list_fetch(ninja_client_t* client,
+                              const ninja_list_cache_t* cache,
+                              const char* endpoint,
+                              ninja_http_response_t* response,
+                              ninja_list_version_t* version,
+                              bool* unchanged) {
+    if (!client || !cache || !endpoint || !response || !version || !unchanged) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *unchanged = false;
+    memset(version, 0, sizeof(ninja_list_version_t));
+
+    // Validators are only sent when there is a cached body to fall back on
+    if (cache->valid) {
+        version->validators = cache->version.validators;
+    }
+
+    ninja_error_t result = ninja_http_get_conditional(client, endpoint, &version->validators, response);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    if (response->status_code == 304) {
+        *unchanged = cache->valid;
+        if (!cache->valid) {
+            ninja_http_response_free(response);
+            return NINJA_ERROR_HTTP;
+        }
+        return NINJA_OK;
+    }
+
+    version->body_hash = ninja_hash_bytes(response->data, response->size);
+    *unchanged = cache->valid && version->body_hash == cache->version.body_hash;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_list_store(ninja_list_cache_t* cache,
+                              const ninja_list_version_t* version,
+                              const void* records,
+                              size_t count,
+                              size_t record_size,
+                              ninja_record_key_fn key,
+                              ninja_list_delta_t* delta) {
+    if (!cache || !version || (!records && count > 0) || !key || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_delta_entry_t* index = NULL;
+    ninja_error_t result = ninja_delta_index(records, count, record_size, key, &index);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    // Until the first response everything is new
+    result = ninja_delta_diff(cache->records, cache->index, cache->valid ? cache->count : 0,
+                              records, index, count, record_size, delta);
+    if (result != NINJA_OK) {
+        free(index);
+        return result;
+    }
+
+    if (count > cache->capacity) {
+        char* grown = realloc(cache->records, count * record_size);
+        if (!grown) {
+            free(delta->records);
+            memset(delta, 0, sizeof(ninja_list_delta_t));
+            free(index);
+            return NINJA_ERROR_MEMORY;
+        }
+        cache->records = grown;
+        cache->capacity = count;
+    }
+
+    if (count > 0) {
+        memcpy(cache->records, records, count * record_size);
+    }
+    free(cache->index);
+    cache->index = index;
+    cache->count = count;
+    cache->version = *version;
+    cache->valid = true;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_list_sync(ninja_client_t* client,
+                             ninja_list_cache_t* cache,
+                             const char* endpoint,
+                             ninja_list_parse_fn parse,
+                             size_t record_size,
+                             ninja_record_key_fn key,
+                             void** records,
+                             size_t* count,
+                             ninja_list_delta_t* delta) {
+    if (!client || !cache || !endpoint || !parse || !key || !delta || (records && !count)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(delta, 0, sizeof(ninja_list_delta_t));
+
+    ninja_http_response_t response;
+    ninja_list_version_t version;
+    bool unchanged = false;
+    ninja_error_t result = ninja_list_fetch(client, cache, endpoint, &response, &version, &unchanged);
+
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    if (unchanged) {
+        ninja_http_response_free(&response);
+        return records ? ninja_list_copy(cache, record_size, records, count) : NINJA_OK;
+    }
+
+    // Parse response
+    void* parsed = NULL;
+    size_t parsed_count = 0;
+    result = parse(response.data, response.size, &parsed, &parsed_count);
+    ninja_http_response_free(&response);
+
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    result = ninja_list_store(cache, &version, parsed, parsed_count, record_size, key, delta);
+    if (result != NINJA_OK || !records) {
+        free(parsed);
+        return result;
+    }
+
+    *records = parsed;
+    *count = parsed_count;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_list_copy(const ninja_list_cache_t* cache,
+                             size_t record_size,
+                             void** records,
+                             size_t* count) {
+    if (!cache || !records || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *records = NULL;
+    *count = 0;
+
+    if (cache->count == 0) {
+        return NINJA_OK;
+    }
+
+    *records = malloc(cache->count * record_size);
+    if (!*records) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    memcpy(*records, cache->records, cache->count * record_size);
+    *count = cache->count;
+    return NINJA_OK;
+}
+
+void ninja_list_cache_free(ninja_list_cache_t* cache) {
+    if (!cache) {
+        return;
+    }
+
+    free(cache->records);
+    free(cache->index);
+    memset(cache, 0, sizeof(ninja_list_cache_t));
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Response validators of a conditional GET
+typedef struct {
+    char etag[128];
+    char last_modified[64];
+} ninja_http_validators_t;
+
+// Version of a list response: server validators plus a hash of the body,
+// which catches identical bodies from servers that send no validators
+typedef struct {
+    ninja_http_validators_t validators;
+    uint64_t body_hash;
+} ninja_list_version_t;
+
+// Record key and content hash, kept sorted by key
+typedef struct {
+    uint64_t key;
+    uint64_t hash;
+    size_t index;
+} ninja_delta_entry_t;
+
+typedef uint64_t (*ninja_record_key_fn)(const void* record);
+
+// Records that differ between two snapshots, ordered by key within each group:
+// records[0, added) are new, the next changed were updated and the last
+// removed are gone (as last seen)
+typedef struct {
+    void* records;
+    size_t added;
+    size_t changed;
+    size_t removed;
+} ninja_list_delta_t;
+
+// Last response of one list endpoint
+typedef struct {
+    bool valid;
+    ninja_list_version_t version;
+    char* records;
+    size_t count;
+    size_t capacity;
+    ninja_delta_entry_t* index;
+} ninja_list_cache_t;
+
+uint64_t ninja_hash_bytes(const void* data, size_t length);
+
+ninja_error_t ninja_delta_index(const void* records,
+                               size_t count,
+                               size_t record_size,
+                               ninja_record_key_fn key,
+                               ninja_delta_entry_t** index);
+
+ninja_error_t ninja_delta_diff(const void* previous,
+                              const ninja_delta_entry_t* previous_index,
+                              size_t previous_count,
+                              const void* current,
+                              const ninja_delta_entry_t* current_index,
+                              size_t current_count,
+                              size_t record_size,
+                              ninja_list_delta_t* delta);
+
+// Diff two unindexed snapshots
+ninja_error_t ninja_delta_compare(const void* previous,
+                                 size_t previous_count,
+                                 const void* current,
+                                 size_t current_count,
+                                 size_t record_size,
+                                 ninja_record_key_fn key,
+                                 ninja_list_delta_t* delta);
+
+// Conditional GET of a list endpoint. *unchanged is set when the server
+// answered 304 or repeated the cached body; otherwise response holds the new
+// body and version the values to store with it.
+ninja_error_t ninja_list_fetch(ninja_client_t* client,
+                              const ninja_list_cache_t* cache,
+                              const char* endpoint,
+                              ninja_http_response_t* response,
+                              ninja_list_version_t* version,
+                              bool* unchanged);
+
+// Replace the cached records with a decoded response and report what changed
+ninja_error_t ninja_list_store(ninja_list_cache_t* cache,
+                              const ninja_list_version_t* version,
+                              const void* records,
+                              size_t count,
+                              size_t record_size,
+                              ninja_record_key_fn key,
+                              ninja_list_delta_t* delta);
+
+typedef ninja_error_t (*ninja_list_parse_fn)(const char* json, size_t length, void** records, size_t* count);
+
+// Fetch a list endpoint through its cache. records/count receive the full list
+// (pass NULL to skip), copied from the cache when nothing changed; delta
+// receives the changes and is empty when there were none.
+ninja_error_t ninja_list_sync(ninja_client_t* client,
+                             ninja_list_cache_t* cache,
+                             const char* endpoint,
+                             ninja_list_parse_fn parse,
+                             size_t record_size,
+                             ninja_record_key_fn key,
+                             void** records,
+                             size_t* count,
+                             ninja_list_delta_t* delta);
+
+// Copy of the cached records, freed with ninja_free_array()
+ninja_error_t ninja_list_copy(const ninja_list_cache_t* cache,
+                             size_t record_size,
+                             void** records,
+                             size_t* count);
+
+void ninja_list_cache_free(ninja_list_cache_t* cache);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include <string.h>
+
+// Decoders switch on length (and a distinguishing character where lengths
+// collide) to pick a single candidate, then confirm it with one memcmp.
+// Adding a vocabulary word means adding it to both the decoder and encoder
+// below; the enum round-trip test catches a missing side.
+
+static inline int ninja_enum_confirm(const char* text, size_t length,
+                                     const char* name, int value, int unknown) {
+    return memcmp(text, name, length) == 0 ? value : unknown;
+}
+
+ninja_order_side_t ninja_order_side_from_string(const char* text, size_t length) {
+    if (!text) {
+        return NINJA_SIDE_UNKNOWN;
+    }
+
+    switch (length) {
+        case 3: return ninja_enum_confirm(text, length, "Buy", NINJA_SIDE_BUY, NINJA_SIDE_UNKNOWN);
+        case 4: return ninja_enum_confirm(text, length, "Sell", NINJA_SIDE_SELL, NINJA_SIDE_UNKNOWN);
+        default: return NINJA_SIDE_UNKNOWN;
+    }
+}
+
+ninja_order_type_t ninja_order_type_from_string(const char* text, size_t length) {
+    if (!text) {
+        return NINJA_ORDER_TYPE_UNKNOWN;
+    }
+
+    const int unknown = NINJA_ORDER_TYPE_UNKNOWN;
+    switch (length) {
+        case 3:
+            return text[0] == 'M' ? ninja_enum_confirm(text, length, "MIT", NINJA_ORDER_MIT, unknown)
+                                  : ninja_enum_confirm(text, length, "QTS", NINJA_ORDER_QTS, unknown);
+        case 4: return ninja_enum_confirm(text, length, "Stop", NINJA_ORDER_STOP, unknown);
+        case 5: return ninja_enum_confirm(text, length, "Limit", NINJA_ORDER_LIMIT, unknown);
+        case 6: return ninja_enum_confirm(text, length, "Market", NINJA_ORDER_MARKET, unknown);
+        case 9: return ninja_enum_confirm(text, length, "StopLimit", NINJA_ORDER_STOP_LIMIT, unknown);
+        case 12: return ninja_enum_confirm(text, length, "TrailingStop", NINJA_ORDER_TRAILING_STOP, unknown);
+        case 17: return ninja_enum_confirm(text, length, "TrailingStopLimit", NINJA_ORDER_TRAILING_STOP_LIMIT, unknown);
+        default: return NINJA_ORDER_TYPE_UNKNOWN;
+    }
+}
+
+ninja_order_status_t ninja_order_status_from_string(const char* text, size_t length) {
+    if (!text || length == 0) {
+        return NINJA_ORDER_STATUS_UNKNOWN;
+    }
+
+    const int unknown = NINJA_ORDER_STATUS_UNKNOWN;
+    switch (length) {
+        case 6: return ninja_enum_confirm(text, length, "Filled", NINJA_ORDER_FILLED, unknown);
+        case 7:
+            switch (text[0]) {
+                case 'W': return ninja_enum_confirm(text, length, "Working", NINJA_ORDER_WORKING, unknown);
+                case 'E': return ninja_enum_confirm(text, length, "Expired", NINJA_ORDER_EXPIRED, unknown);
+                case 'P': return ninja_enum_confirm(text, length, "Pending", NINJA_ORDER_PENDING, unknown);
+                default: return NINJA_ORDER_STATUS_UNKNOWN;
+            }
+        case 8:
+            return text[0] == 'C' ? ninja_enum_confirm(text, length, "Canceled", NINJA_ORDER_CANCELLED, unknown)
+                                  : ninja_enum_confirm(text, length, "Rejected", NINJA_ORDER_REJECTED, unknown);
+        case 9:
+            switch (text[2]) {
+                case 'n': return ninja_enum_confirm(text, length, "Cancelled", NINJA_ORDER_CANCELLED, unknown);
+                case 'm': return ninja_enum_confirm(text, length, "Completed", NINJA_ORDER_COMPLETED, unknown);
+                case 's': return ninja_enum_confirm(text, length, "Suspended", NINJA_ORDER_SUSPENDED, unknown);
+                default: return NINJA_ORDER_STATUS_UNKNOWN;
+            }
+        case 10: return ninja_enum_confirm(text, length, "PendingNew", NINJA_ORDER_PENDING, unknown);
+        case 13: return ninja_enum_confirm(text, length, "PendingCancel", NINJA_ORDER_PENDING_CANCEL, unknown);
+        case 14: return ninja_enum_confirm(text, length, "PendingReplace", NINJA_ORDER_PENDING_REPLACE, unknown);
+        case 15: return ninja_enum_confirm(text, length, "PartiallyFilled", NINJA_ORDER_PARTIALLY_FILLED, unknown);
+        default: return NINJA_ORDER_STATUS_UNKNOWN;
+    }
+}
+
+const char* ninja_order_side_to_string(ninja_order_side_t side) {
+    switch (side) {
+        case NINJA_SIDE_BUY: return "Buy";
+        case NINJA_SIDE_SELL: return "Sell";
+        default: return "Unknown";
+    }
+}
+
+const char* ninja_order_type_to_string(ninja_order_type_t type) {
+    switch (type) {
+        case NINJA_ORDER_MARKET: return "Market";
+        case NINJA_ORDER_LIMIT: return "Limit";
+        case NINJA_ORDER_STOP: return "Stop";
+        case NINJA_ORDER_STOP_LIMIT: return "StopLimit";
+        case NINJA_ORDER_MIT: return "MIT";
+        case NINJA_ORDER_TRAILING_STOP: return "TrailingStop";
+        case NINJA_ORDER_TRAILING_STOP_LIMIT: return "TrailingStopLimit";
+        case NINJA_ORDER_QTS: return "QTS";
+        default: return "Unknown";
+    }
+}
+
+const char* ninja_order_status_to_string(ninja_order_status_t status) {
+    switch (status) {
+        case NINJA_ORDER_PENDING: return "PendingNew";
+        case NINJA_ORDER_WORKING: return "Working";
+        case NINJA_ORDER_FILLED: return "Filled";
+        case NINJA_ORDER_CANCELLED: return "Canceled";
+        case NINJA_ORDER_REJECTED: return "Rejected";
+        case NINJA_ORDER_PARTIALLY_FILLED: return "PartiallyFilled";
+        case NINJA_ORDER_SUSPENDED: return "Suspended";
+        case NINJA_ORDER_EXPIRED: return "Expired";
+        case NINJA_ORDER_COMPLETED: return "Completed";
+        case NINJA_ORDER_PENDING_CANCEL: return "PendingCancel";
+        case NINJA_ORDER_PENDING_REPLACE: return "PendingReplace";
+        default: return "Unknown";
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Totals over the active fills of one run
+typedef struct {
+    int64_t quantity;
+    double notional;
+    int64_t first_ns;
+    int64_t last_ns;
+    int fills;
+} ninja_fill_totals_t;
+
+// Helper function to total a run of fills from the contiguous arrays in one
+// branch-free pass; busted fills count as zero
+static void ninja_fill_totals(const ninja_fill_columns_t* columns, size_t begin, size_t end, ninja_fill_totals_t* totals) {
+    const double* price = columns->price;
+    const int32_t* quantity = columns->quantity;
+    const int64_t* timestamp = columns->timestamp_ns;
+    const uint8_t* active = columns->active;
+
+    double notional = 0.0;
+    int64_t filled = 0;
+    int64_t first = totals->first_ns;
+    int64_t last = totals->last_ns;
+    int fills = 0;
+    for (size_t i = begin; i < end; i++) {
+        int64_t q = active[i] ? quantity[i] : 0;
+        notional += price[i] * (double)q;
+        filled += q;
+        first = active[i] && timestamp[i] < first ? timestamp[i] : first;
+        last = active[i] && timestamp[i] > last ? timestamp[i] : last;
+        fills += active[i] ? 1 : 0;
+    }
+
+    totals->quantity += filled;
+    totals->notional += notional;
+    totals->first_ns = first;
+    totals->last_ns = last;
+    totals->fills += fills;
+}
+
+// Helper function to find an order's slot in the arrival table; returns the
+// empty slot where it belongs if absent
+static size_t ninja_arrival_slot(const uint32_t* table, size_t mask, const ninja_arrival_t* arrivals, int64_t order_id) {
+    uint64_t hash = (uint64_t)order_id * 0x9E3779B97F4A7C15ULL;
+    size_t slot = (size_t)(hash ^ (hash >> 32)) & mask;
+    while (table[slot] != 0 && arrivals[table[slot] - 1].order_id != order_id) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+ninja_error_t ninja_execution_quality(const ninja_fill_columns_t* fills,
+                                     const ninja_arrival_t* arrivals,
+                                     size_t count,
+                                     ninja_execution_t* results) {
+    if (!fills || (count > 0 && (!arrivals || !results)) || (fills->count > 0 && !fills->order_id)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    if (count == 0) {
+        return NINJA_OK;
+    }
+
+    size_t capacity = 16;
+    while (capacity < count * 2) {
+        capacity *= 2;
+    }
+    uint32_t* table = calloc(capacity, sizeof(uint32_t));       // Arrival index + 1, 0 when empty
+    ninja_fill_totals_t* totals = malloc(count * sizeof(ninja_fill_totals_t));
+    if (!table || !totals) {
+        free(table);
+        free(totals);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = ninja_arrival_slot(table, capacity - 1, arrivals, arrivals[i].order_id);
+        if (table[slot] != 0) {
+            free(table);
+            free(totals);
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+        table[slot] = (uint32_t)i + 1;
+        totals[i].quantity = 0;
+        totals[i].notional = 0.0;
+        totals[i].first_ns = INT64_MAX;
+        totals[i].last_ns = INT64_MIN;
+        totals[i].fills = 0;
+    }
+
+    // One lookup per run of fills for the same order; fill/deps and lists
+    // sorted by order give one run per order
+    size_t begin = 0;
+    while (begin < fills->count) {
+        int64_t order_id = fills->order_id[begin];
+        size_t end = begin + 1;
+        while (end < fills->count && fills->order_id[end] == order_id) {
+            end++;
+        }
+
+        uint32_t index = table[ninja_arrival_slot(table, capacity - 1, arrivals, order_id)];
+        if (index != 0) {
+            ninja_fill_totals(fills, begin, end, &totals[index - 1]);
+        }
+        begin = end;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ninja_arrival_t* arrival = &arrivals[i];
+        const ninja_fill_totals_t* total = &totals[i];
+        ninja_execution_t* result = &results[i];
+        memset(result, 0, sizeof(ninja_execution_t));
+
+        result->order_id = arrival->order_id;
+        result->fills = total->fills;
+        result->quantity = (int)total->quantity;
+        if (total->quantity == 0) {
+            continue;
+        }
+
+        result->vwap = total->notional / (double)total->quantity;
+        if (arrival->arrival_price > 0.0) {
+            double paid = result->vwap - arrival->arrival_price;
+            result->slippage = arrival->side == NINJA_SIDE_SELL ? -paid : paid;
+            result->slippage_bps = result->slippage / arrival->arrival_price * 10000.0;
+        }
+        if (arrival->arrival_ns != 0) {
+            result->first_fill_latency_ns = total->first_ns - arrival->arrival_ns;
+            result->last_fill_latency_ns = total->last_ns - arrival->arrival_ns;
+        }
+    }
+
+    free(table);
+    free(totals);
+    return NINJA_OK;
+}
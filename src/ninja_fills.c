@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_client.h"
+#include "ninja_schema.h"
+#include "cJSON.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// JSON schema of ninja_fill_t, in the key order the server sends
+static const ninja_field_t ninja_fill_fields[] = {
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "id", NINJA_FIELD_INT64, fill_id)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "orderId", NINJA_FIELD_INT64, order_id)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "contractId", NINJA_FIELD_INT, contract_id)
+    NINJA_SCHEMA_TIMESTAMP(ninja_fill_t, "timestamp", timestamp, timestamp_ns)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "action", NINJA_FIELD_SIDE, side)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "qty", NINJA_FIELD_INT, quantity)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "price", NINJA_FIELD_DOUBLE, price)
+    NINJA_SCHEMA_FIELD(ninja_fill_t, "active", NINJA_FIELD_BOOL, active)
+};
+
+// Helper function to order fills by id
+static int ninja_fill_compare(const void* a, const void* b) {
+    int64_t left = ((const ninja_fill_t*)a)->fill_id;
+    int64_t right = ((const ninja_fill_t*)b)->fill_id;
+    return left < right ? -1 : left > right ? 1 : 0;
+}
+
+// Helper function to GET a fill list endpoint and decode it
+static ninja_error_t ninja_fetch_fills(ninja_client_t* client,
+                                       const char* endpoint,
+                                       ninja_fill_t** fills,
+                                       size_t* count) {
+    ninja_http_response_t response;
+    ninja_error_t result = ninja_http_get(client, endpoint, &response);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    result = ninja_parse_fills(response.data, response.size, fills, count);
+    ninja_http_response_free(&response);
+    return result;
+}
+
+ninja_error_t ninja_get_fills(ninja_client_t* client, ninja_fill_t** fills, size_t* count) {
+    if (!client || !fills || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *fills = NULL;
+    *count = 0;
+
+    return ninja_fetch_fills(client, "fill/list", fills, count);
+}
+
+ninja_error_t ninja_get_order_fills(ninja_client_t* client,
+                                   ninja_order_id_t order_id,
+                                   ninja_fill_t** fills,
+                                   size_t* count) {
+    if (!client || order_id <= 0 || !fills || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *fills = NULL;
+    *count = 0;
+
+    char endpoint[256];
+    snprintf(endpoint, sizeof(endpoint), "fill/deps?masterid=%lld", (long long)order_id);
+
+    return ninja_fetch_fills(client, endpoint, fills, count);
+}
+
+ninja_error_t ninja_get_fills_since(ninja_client_t* client,
+                                   int64_t after_fill_id,
+                                   size_t max_fills,
+                                   ninja_fill_t** fills,
+                                   size_t* count) {
+    if (!client || after_fill_id < 0 || !fills || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *fills = NULL;
+    *count = 0;
+
+    ninja_fill_t* all = NULL;
+    size_t total = 0;
+    ninja_error_t result = ninja_fetch_fills(client, "fill/list", &all, &total);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    // Keep fills past the cursor in place, in id order
+    size_t kept = 0;
+    bool sorted = true;
+    for (size_t i = 0; i < total; i++) {
+        if (all[i].fill_id > after_fill_id) {
+            sorted = sorted && (kept == 0 || all[kept - 1].fill_id < all[i].fill_id);
+            all[kept++] = all[i];
+        }
+    }
+    if (!sorted) {
+        qsort(all, kept, sizeof(ninja_fill_t), ninja_fill_compare);
+    }
+    if (max_fills > 0 && kept > max_fills) {
+        kept = max_fills;
+    }
+
+    if (kept == 0) {
+        free(all);
+        return NINJA_OK;
+    }
+
+    *fills = all;
+    *count = kept;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_parse_fills(const char* json,
+                               size_t length,
+                               ninja_fill_t** fills,
+                               size_t* count) {
+    if (!json || !fills || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *fills = NULL;
+    *count = 0;
+
+    cJSON* response_json = cJSON_ParseWithLength(json, length);
+    if (!response_json) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    // Decode every fill in one pass over the array
+    void* fill_array = NULL;
+    ninja_error_t result = ninja_schema_decode_array(ninja_fill_fields, NINJA_SCHEMA_COUNT(ninja_fill_fields),
+                                                     response_json, sizeof(ninja_fill_t), NULL,
+                                                     &fill_array, count);
+    cJSON_Delete(response_json);
+
+    *fills = fill_array;
+    return result;
+}
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_io.h"
+#include "ninja_atomic.h"
+#include "ninja_client.h"
+#include "ninja_trace.h"
+#include "../include/ninja/ninja_api.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Empty polls before the thread goes to sleep
+#define NINJA_IO_SPIN_LIMIT 4096
+
+// Longest sleep; bounds the cost of a missed wake-up
+#define NINJA_IO_SLEEP_MS 10
+
+// Helper function to run a batch concurrently and report completions in submission order
+static void ninja_io_process(ninja_client_t* client, uint64_t first_id, size_t count) {
+    ninja_io_t* io = client->io;
+    ninja_order_op_t ops[NINJA_IO_BATCH];
+
+    for (size_t i = 0; i < count; i++) {
+        ninja_trace_span(io->batch[i].trace_id, NINJA_SPAN_QUEUE, io->batch[i].trace_start);
+
+        ninja_completion_t* completion = &io->completions[i];
+        memset(completion, 0, sizeof(ninja_completion_t));
+        completion->request_id = first_id + i;
+        completion->kind = io->batch[i].kind;
+        completion->order_id = io->batch[i].order_id;
+        memcpy(completion->client_order_id, io->batch[i].order.client_order_id, sizeof(completion->client_order_id));
+
+        ops[i].kind = io->batch[i].kind;
+        ops[i].request = &io->batch[i].order;
+        ops[i].order_id = io->batch[i].order_id;
+        ops[i].order = &completion->order;
+        ops[i].trace_id = io->batch[i].trace_id;
+        ops[i].result = NINJA_OK;
+    }
+
+    ninja_error_t result = ninja_run_order_ops(client, ops, count);
+
+    for (size_t i = 0; i < count; i++) {
+        ninja_completion_t* completion = &io->completions[i];
+        completion->result = result != NINJA_OK && ops[i].result == NINJA_OK ? result : ops[i].result;
+        if (completion->kind == NINJA_REQUEST_PLACE_ORDER) {
+            completion->order_id = completion->order.order_id;
+        }
+
+        if (io->callback) {
+            uint64_t trace_start = ninja_trace_start(ops[i].trace_id);
+            io->callback(completion, io->user_data);
+            ninja_trace_span(ops[i].trace_id, NINJA_SPAN_CALLBACK, trace_start);
+        }
+    }
+}
+
+// Helper function to wait for work once spinning has found none
+static void ninja_io_sleep(ninja_io_t* io) {
+    ninja_mutex_lock(&io->wake_lock);
+    ninja_atomic_store_relaxed(&io->sleeping, 1);
+    ninja_atomic_fence_seq_cst();
+
+    // Recheck after announcing the sleep; pairs with the fence in ninja_io_submit
+    if (ninja_ring_empty(&io->ring) && ninja_atomic_load_acquire(&io->running)) {
+        ninja_cond_wait(&io->wake, &io->wake_lock, NINJA_IO_SLEEP_MS);
+    }
+
+    ninja_atomic_store_relaxed(&io->sleeping, 0);
+    ninja_mutex_unlock(&io->wake_lock);
+}
+
+// Helper function for the I/O thread: drain the queue until stopped
+static void ninja_io_main(void* arg) {
+    ninja_client_t* client = arg;
+    ninja_io_t* io = client->io;
+    int idle = 0;
+
+    // Wait until ninja_io_start has stored this thread's handle
+    ninja_mutex_lock(&io->wake_lock);
+    ninja_mutex_unlock(&io->wake_lock);
+
+    for (;;) {
+        // Requests pop in submission order, so the ring position names them
+        uint64_t first_id = io->ring.dequeue_position + 1;
+        size_t count = 0;
+        while (count < NINJA_IO_BATCH && ninja_ring_pop(&io->ring, &io->batch[count])) {
+            count++;
+        }
+        if (count > 0) {
+            ninja_io_process(client, first_id, count);
+            idle = 0;
+            continue;
+        }
+
+        // Stop only once everything submitted before shutdown has run
+        if (!ninja_atomic_load_acquire(&io->running)) {
+            if (ninja_ring_empty(&io->ring)) {
+                break;
+            }
+            continue;
+        }
+
+        if (io->busy_poll || ++idle < NINJA_IO_SPIN_LIMIT) {
+            ninja_cpu_relax();
+        } else {
+            ninja_io_sleep(io);
+            idle = 0;
+        }
+    }
+}
+
+// Helper function to hand a request to the I/O thread; its trace starts here
+static ninja_error_t ninja_io_submit(ninja_io_t* io, ninja_io_request_t* request, uint64_t* request_id) {
+    request->trace_id = ninja_trace_begin();
+    request->trace_start = ninja_trace_start(request->trace_id);
+
+    uint64_t position = 0;
+    ninja_error_t result = ninja_ring_push(&io->ring, request, &position);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    if (request_id) {
+        *request_id = position + 1;
+    }
+
+    // Only a sleeping thread needs a signal; the fence orders the push before the check
+    ninja_atomic_fence_seq_cst();
+    if (ninja_atomic_load_relaxed(&io->sleeping)) {
+        ninja_mutex_lock(&io->wake_lock);
+        ninja_cond_signal(&io->wake);
+        ninja_mutex_unlock(&io->wake_lock);
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_io_start(ninja_client_t* client, const ninja_client_options_t* options) {
+    if (!client || !options || client->io) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_io_t* io = calloc(1, sizeof(ninja_io_t));
+    if (!io) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_error_t result = ninja_ring_init(&io->ring, options->io_queue_capacity, sizeof(ninja_io_request_t));
+    if (result != NINJA_OK) {
+        free(io);
+        return result;
+    }
+
+    // A connection of its own keeps the thread off the caller's handle
+    io->curl = curl_easy_duphandle(client->curl);
+    if (!io->curl) {
+        ninja_ring_free(&io->ring);
+        free(io);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    io->busy_poll = options->io_busy_poll;
+    io->callback = options->completion_callback;
+    io->user_data = options->completion_user_data;
+    ninja_mutex_init(&io->wake_lock);
+    ninja_cond_init(&io->wake);
+    io->running = 1;
+
+    client->io = io;
+    ninja_mutex_lock(&io->wake_lock);
+    result = ninja_thread_start(&io->thread, ninja_io_main, client, options->io_thread_cpu);
+    ninja_mutex_unlock(&io->wake_lock);
+    if (result != NINJA_OK) {
+        client->io = NULL;
+        ninja_cond_destroy(&io->wake);
+        ninja_mutex_destroy(&io->wake_lock);
+        curl_easy_cleanup(io->curl);
+        ninja_ring_free(&io->ring);
+        free(io);
+    }
+
+    return result;
+}
+
+void ninja_io_stop(ninja_client_t* client) {
+    if (!client || !client->io) {
+        return;
+    }
+
+    ninja_io_t* io = client->io;
+    ninja_atomic_store_release(&io->running, 0);
+    ninja_mutex_lock(&io->wake_lock);
+    ninja_cond_signal(&io->wake);
+    ninja_mutex_unlock(&io->wake_lock);
+    ninja_thread_join(&io->thread);
+
+    client->io = NULL;
+    ninja_cond_destroy(&io->wake);
+    ninja_mutex_destroy(&io->wake_lock);
+    ninja_pipeline_free(&io->pipeline);
+    curl_easy_cleanup(io->curl);
+    if (io->headers) {
+        curl_slist_free_all(io->headers);
+    }
+    ninja_ring_free(&io->ring);
+    free(io);
+}
+
+CURL* ninja_io_connection(ninja_client_t* client, struct curl_slist** headers) {
+    ninja_io_t* io = client->io;
+    if (!io || !ninja_thread_is_current(&io->thread)) {
+        return NULL;
+    }
+
+    // Rebuild the headers once per token change; the token is read under the lock
+    ninja_mutex_lock(&client->lock);
+    if (io->auth_generation != client->auth_generation) {
+        if (io->headers) {
+            curl_slist_free_all(io->headers);
+        }
+        io->headers = curl_slist_append(NULL, "Content-Type: application/json");
+        if (client->auth_header[0] != '\0') {
+            io->headers = curl_slist_append(io->headers, client->auth_header);
+        }
+        io->auth_generation = client->auth_generation;
+    }
+    ninja_mutex_unlock(&client->lock);
+
+    *headers = io->headers;
+    return io->curl;
+}
+
+ninja_error_t ninja_submit_order(ninja_client_t* client,
+                                const ninja_order_request_t* request,
+                                uint64_t* request_id) {
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE];
+    return ninja_submit_order_with_id(client, request, client_order_id, request_id);
+}
+
+ninja_error_t ninja_submit_order_with_id(ninja_client_t* client,
+                                        const ninja_order_request_t* request,
+                                        char* client_order_id,
+                                        uint64_t* request_id) {
+    if (!client || !client->io || !request || !client_order_id) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Validation happens on the I/O thread and is reported in the completion;
+    // the clOrdId is settled here, without locking, so the caller has it
+    // before the round trip. The I/O thread starts tracking it.
+    ninja_io_request_t item;
+    item.kind = NINJA_REQUEST_PLACE_ORDER;
+    item.order_id = 0;
+    item.order = *request;
+    if (item.order.client_order_id[0] == '\0') {
+        ninja_next_client_order_id(client, item.order.client_order_id, sizeof(item.order.client_order_id));
+    }
+    item.order.client_order_id[sizeof(item.order.client_order_id) - 1] = '\0';
+
+    ninja_error_t result = ninja_io_submit(client->io, &item, request_id);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    memcpy(client_order_id, item.order.client_order_id, NINJA_CLIENT_ORDER_ID_SIZE);
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_submit_cancel(ninja_client_t* client,
+                                 ninja_order_id_t order_id,
+                                 uint64_t* request_id) {
+    if (!client || !client->io || order_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_io_request_t item;
+    memset(&item.order, 0, sizeof(item.order));
+    item.kind = NINJA_REQUEST_CANCEL_ORDER;
+    item.order_id = order_id;
+
+    return ninja_io_submit(client->io, &item, request_id);
+}
+
+ninja_error_t ninja_submit_order_query(ninja_client_t* client,
+                                      ninja_order_id_t order_id,
+                                      uint64_t* request_id) {
+    if (!client || !client->io || order_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_io_request_t item;
+    memset(&item.order, 0, sizeof(item.order));
+    item.kind = NINJA_REQUEST_GET_ORDER;
+    item.order_id = order_id;
+
+    return ninja_io_submit(client->io, &item, request_id);
+}
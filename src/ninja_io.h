@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_ring.h"
+#include "ninja_thread.h"
+#include "ninja_pipeline.h"
+#include <curl/curl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Requests taken off the ring and run concurrently at once
+#define NINJA_IO_BATCH 32
+
+// Request queued for the I/O thread
+typedef struct {
+    ninja_request_kind_t kind;
+    ninja_order_id_t order_id;
+    ninja_order_request_t order;
+    uint64_t trace_id;
+    uint64_t trace_start;       // Submission, the start of the queue span
+} ninja_io_request_t;
+
+// Dedicated I/O thread with its own connection
+typedef struct ninja_io {
+    ninja_ring_t ring;
+    ninja_thread_t thread;
+    uint64_t running;
+    uint64_t sleeping;          // Set while the thread waits on wake
+    ninja_mutex_t wake_lock;
+    ninja_cond_t wake;
+    bool busy_poll;
+
+    CURL* curl;
+    struct curl_slist* headers;
+    uint64_t auth_generation;   // Client auth generation the headers were built for
+    ninja_pipeline_t pipeline;
+
+    // Batch being run and its completions
+    ninja_io_request_t batch[NINJA_IO_BATCH];
+    ninja_completion_t completions[NINJA_IO_BATCH];
+
+    ninja_completion_callback_t callback;
+    void* user_data;
+} ninja_io_t;
+
+ninja_error_t ninja_io_start(ninja_client_t* client, const ninja_client_options_t* options);
+
+// Drain queued requests, then stop and free the thread
+void ninja_io_stop(ninja_client_t* client);
+
+// Connection for the calling thread if it is the I/O thread, otherwise NULL
+CURL* ninja_io_connection(ninja_client_t* client, struct curl_slist** headers);
+
+#ifdef __cplusplus
+}
+#endif
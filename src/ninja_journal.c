@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_journal.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Request state while scanning the journal
+#define NINJA_JOURNAL_SEEN 1
+#define NINJA_JOURNAL_CLOSED 2
+
+// State of one sequence; sequences start at 1, so 0 marks a free slot
+typedef struct {
+    uint64_t sequence;
+    uint8_t state;
+} ninja_journal_state_t;
+
+// Helper function to checksum everything after the checksum field
+static uint64_t ninja_journal_checksum(const ninja_journal_record_t* record) {
+    const unsigned char* bytes = (const unsigned char*)record + sizeof(record->checksum);
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < sizeof(ninja_journal_record_t) - sizeof(record->checksum); i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    // Zero marks a slot that was never written
+    return hash ? hash : 1;
+}
+
+static bool ninja_journal_is_request(uint8_t kind) {
+    return kind == NINJA_JOURNAL_PLACE || kind == NINJA_JOURNAL_CANCEL;
+}
+
+// Helper function to find the state slot of a sequence, claiming a free one
+// if it has none; the table is never more than half full
+static uint8_t* ninja_journal_state(ninja_journal_state_t* states, size_t mask, uint64_t sequence) {
+    size_t index = (size_t)(sequence * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+    while (states[index].sequence != 0 && states[index].sequence != sequence) {
+        index = (index + 1) & mask;
+    }
+    states[index].sequence = sequence;
+    return &states[index].state;
+}
+
+static size_t ninja_journal_offset(size_t index) {
+    return sizeof(ninja_journal_header_t) + index * sizeof(ninja_journal_record_t);
+}
+
+ninja_error_t ninja_journal_open(ninja_journal_t* journal,
+                                const char* path,
+                                size_t capacity,
+                                ninja_journal_flush_t flush,
+                                int group_commit) {
+    if (!journal || !path || capacity == 0 || group_commit <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(journal, 0, sizeof(ninja_journal_t));
+
+    // Check an existing file through a read-only map so a foreign file is left as it was
+    ninja_mmap_t existing;
+    if (ninja_mmap_open(&existing, path, 0, false) == NINJA_OK) {
+        const ninja_journal_header_t* header = (const ninja_journal_header_t*)existing.data;
+        bool valid = existing.size >= sizeof(ninja_journal_header_t) &&
+                     memcmp(header->magic, NINJA_JOURNAL_MAGIC, sizeof(NINJA_JOURNAL_MAGIC)) == 0 &&
+                     header->version == NINJA_JOURNAL_VERSION &&
+                     header->record_size == sizeof(ninja_journal_record_t) &&
+                     header->capacity > 0 &&
+                     existing.size == ninja_journal_offset((size_t)header->capacity);
+        if (valid) {
+            capacity = (size_t)header->capacity;
+        }
+        ninja_mmap_close(&existing);
+        if (!valid) {
+            return NINJA_ERROR_INVALID_PARAM;
+        }
+    }
+
+    ninja_error_t result = ninja_mmap_open(&journal->map, path, ninja_journal_offset(capacity), true);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    ninja_journal_header_t* header = (ninja_journal_header_t*)journal->map.data;
+    if (header->magic[0] == '\0') {
+        // Fresh file
+        memset(header, 0, sizeof(ninja_journal_header_t));
+        memcpy(header->magic, NINJA_JOURNAL_MAGIC, sizeof(NINJA_JOURNAL_MAGIC));
+        header->version = NINJA_JOURNAL_VERSION;
+        header->record_size = sizeof(ninja_journal_record_t);
+        header->capacity = capacity;
+    }
+
+    journal->records = (ninja_journal_record_t*)((char*)journal->map.data + sizeof(ninja_journal_header_t));
+    journal->capacity = capacity;
+    journal->flush = flush;
+    journal->group_commit = group_commit;
+
+    // The journal ends at the first record that was never or only partly written
+    uint64_t last_sequence = 0;
+    while (journal->head < capacity) {
+        const ninja_journal_record_t* record = &journal->records[journal->head];
+        if (record->checksum == 0 || record->checksum != ninja_journal_checksum(record)) {
+            break;
+        }
+        if (record->sequence > last_sequence) {
+            last_sequence = record->sequence;
+        }
+        journal->head++;
+    }
+    journal->flushed = journal->head;
+    journal->next_sequence = last_sequence + 1;
+
+    return NINJA_OK;
+}
+
+void ninja_journal_close(ninja_journal_t* journal) {
+    if (!journal) {
+        return;
+    }
+
+    if (journal->records && journal->flush != NINJA_JOURNAL_FLUSH_NONE && journal->head > journal->flushed) {
+        ninja_mmap_sync(&journal->map, ninja_journal_offset(journal->flushed),
+                        (journal->head - journal->flushed) * sizeof(ninja_journal_record_t), false);
+    }
+    ninja_mmap_close(&journal->map);
+    memset(journal, 0, sizeof(ninja_journal_t));
+}
+
+ninja_error_t ninja_journal_open_requests(const ninja_journal_t* journal,
+                                         ninja_journal_record_t** requests,
+                                         size_t* count) {
+    if (!journal || !journal->records || !requests || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *requests = NULL;
+    *count = 0;
+    if (journal->head == 0) {
+        return NINJA_OK;
+    }
+
+    // One state per sequence, in a table sized by the records rather than the
+    // sequence range, which a long-open request would keep growing. A
+    // compaction cut short by a crash can leave a request twice, so only its
+    // first copy is reported.
+    size_t slots = 16;
+    while (slots < journal->head * 2) {
+        slots <<= 1;
+    }
+    size_t mask = slots - 1;
+    ninja_journal_state_t* states = calloc(slots, sizeof(ninja_journal_state_t));
+    if (!states) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    for (size_t i = 0; i < journal->head; i++) {
+        if (!ninja_journal_is_request(journal->records[i].kind)) {
+            *ninja_journal_state(states, mask, journal->records[i].sequence) |= NINJA_JOURNAL_CLOSED;
+        }
+    }
+
+    size_t open_count = 0;
+    for (size_t i = 0; i < journal->head; i++) {
+        if (!ninja_journal_is_request(journal->records[i].kind)) {
+            continue;
+        }
+        uint8_t* request_state = ninja_journal_state(states, mask, journal->records[i].sequence);
+        if (*request_state == 0) {
+            *request_state = NINJA_JOURNAL_SEEN;
+            open_count++;
+        }
+    }
+
+    if (open_count > 0) {
+        *requests = malloc(open_count * sizeof(ninja_journal_record_t));
+        if (!*requests) {
+            free(states);
+            return NINJA_ERROR_MEMORY;
+        }
+
+        size_t n = 0;
+        for (size_t i = 0; i < journal->head; i++) {
+            if (!ninja_journal_is_request(journal->records[i].kind)) {
+                continue;
+            }
+            uint8_t* request_state = ninja_journal_state(states, mask, journal->records[i].sequence);
+            if (*request_state == NINJA_JOURNAL_SEEN) {
+                *request_state = 0;
+                (*requests)[n++] = journal->records[i];
+            }
+        }
+        *count = n;
+    }
+
+    free(states);
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_journal_sync(ninja_journal_t* journal) {
+    if (!journal || !journal->records) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_error_t result = ninja_mmap_sync(&journal->map, 0, ninja_journal_offset(journal->head), true);
+    if (result == NINJA_OK) {
+        journal->flushed = journal->head;
+    }
+    return result;
+}
+
+// Helper function to keep only open requests once the journal is full
+static ninja_error_t ninja_journal_compact(ninja_journal_t* journal) {
+    ninja_journal_record_t* requests = NULL;
+    size_t count = 0;
+    ninja_error_t result = ninja_journal_open_requests(journal, &requests, &count);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    if (count > 0) {
+        memcpy(journal->records, requests, count * sizeof(ninja_journal_record_t));
+    }
+    memset(&journal->records[count], 0, (journal->head - count) * sizeof(ninja_journal_record_t));
+    free(requests);
+
+    journal->head = count;
+    journal->flushed = count;
+    return ninja_mmap_sync(&journal->map, 0, journal->map.size, journal->flush == NINJA_JOURNAL_FLUSH_SYNC);
+}
+
+// Helper function to append a record and apply the flush policy
+static ninja_error_t ninja_journal_append(ninja_journal_t* journal, ninja_journal_record_t* record) {
+    if (journal->head == journal->capacity) {
+        ninja_error_t result = ninja_journal_compact(journal);
+        if (result != NINJA_OK) {
+            return result;
+        }
+        if (journal->head == journal->capacity) {
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    record->checksum = ninja_journal_checksum(record);
+    journal->records[journal->head++] = *record;
+
+    switch (journal->flush) {
+        case NINJA_JOURNAL_FLUSH_SYNC:
+            journal->flushed = journal->head;
+            return ninja_mmap_sync(&journal->map, ninja_journal_offset(journal->head - 1),
+                                   sizeof(ninja_journal_record_t), true);
+        case NINJA_JOURNAL_FLUSH_ASYNC:
+            // Group commit: one write-back request per group_commit records
+            if (journal->head - journal->flushed >= (size_t)journal->group_commit) {
+                size_t first = journal->flushed;
+                journal->flushed = journal->head;
+                return ninja_mmap_sync(&journal->map, ninja_journal_offset(first),
+                                       (journal->head - first) * sizeof(ninja_journal_record_t), false);
+            }
+            return NINJA_OK;
+        default:
+            return NINJA_OK;
+    }
+}
+
+uint64_t ninja_journal_log_request(ninja_journal_t* journal,
+                                  ninja_journal_kind_t kind,
+                                  const ninja_order_request_t* request,
+                                  ninja_order_id_t order_id) {
+    if (!journal || !journal->records) {
+        return 0;
+    }
+
+    ninja_journal_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.sequence = journal->next_sequence++;
+    record.timestamp_ns = ninja_wall_clock_ns();
+    record.order_id = order_id;
+    record.kind = (uint8_t)kind;
+
+    if (request) {
+        record.side = (uint8_t)request->side;
+        record.type = (uint8_t)request->type;
+        record.is_automated = request->is_automated;
+        record.account_id = request->account_id;
+        record.quantity = request->quantity;
+        record.price = request->price;
+        record.stop_price = request->stop_price;
+        memcpy(record.symbol, request->symbol, sizeof(record.symbol));
+        memcpy(record.account_spec, request->account_spec, sizeof(record.account_spec));
+        memcpy(record.client_order_id, request->client_order_id, sizeof(record.client_order_id));
+    }
+
+    if (ninja_journal_append(journal, &record) != NINJA_OK) {
+        return 0;
+    }
+    return record.sequence;
+}
+
+void ninja_journal_log_completion(ninja_journal_t* journal,
+                                 ninja_journal_kind_t kind,
+                                 uint64_t sequence,
+                                 ninja_order_id_t order_id) {
+    if (!journal || !journal->records || sequence == 0) {
+        return;
+    }
+
+    ninja_journal_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.sequence = sequence;
+    record.timestamp_ns = ninja_wall_clock_ns();
+    record.order_id = order_id;
+    record.kind = (uint8_t)kind;
+
+    ninja_journal_append(journal, &record);
+}
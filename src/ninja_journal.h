@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_mmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NINJA_JOURNAL_MAGIC "NJJRNL"
+#define NINJA_JOURNAL_VERSION 2
+
+// Journal record kinds. Requests are written before they are sent; completions
+// repeat the request sequence once the outcome is known.
+typedef enum {
+    NINJA_JOURNAL_PLACE = 1,    // Order about to be placed
+    NINJA_JOURNAL_CANCEL,       // Cancel about to be sent for order_id
+    NINJA_JOURNAL_ACK,          // Request accepted; order_id is the broker id
+    NINJA_JOURNAL_REJECT,       // Request definitively refused
+    NINJA_JOURNAL_LOST          // Recovery found no trace of the request
+} ninja_journal_kind_t;
+
+// Fixed-size journal record. A record is valid when its checksum matches, so a
+// write torn by a crash reads as the end of the journal.
+typedef struct {
+    uint64_t checksum;
+    uint64_t sequence;
+    int64_t timestamp_ns;
+    ninja_order_id_t order_id;
+    uint8_t kind;
+    uint8_t side;
+    uint8_t type;
+    uint8_t is_automated;
+    int32_t account_id;
+    int32_t quantity;
+    uint32_t reserved;
+    double price;
+    double stop_price;
+    char symbol[32];
+    char account_spec[64];
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE]; // Placements: the clOrdId sent
+} ninja_journal_record_t;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;
+    uint8_t reserved[40];
+} ninja_journal_header_t;
+
+// Append-only order journal over a mapped file
+typedef struct {
+    ninja_mmap_t map;
+    ninja_journal_record_t* records;
+    size_t capacity;
+    size_t head;                // Next free record
+    size_t flushed;             // Records before this have been handed to the OS
+    uint64_t next_sequence;
+    ninja_journal_flush_t flush;
+    int group_commit;
+} ninja_journal_t;
+
+// Open or create the journal at path. An existing journal keeps the capacity
+// it was created with; a file that is not a journal is left untouched.
+ninja_error_t ninja_journal_open(ninja_journal_t* journal,
+                                const char* path,
+                                size_t capacity,
+                                ninja_journal_flush_t flush,
+                                int group_commit);
+void ninja_journal_close(ninja_journal_t* journal);
+
+// Log a request and return its sequence, or 0 if it could not be written
+uint64_t ninja_journal_log_request(ninja_journal_t* journal,
+                                  ninja_journal_kind_t kind,
+                                  const ninja_order_request_t* request,
+                                  ninja_order_id_t order_id);
+
+// Log the outcome of the request with the given sequence
+void ninja_journal_log_completion(ninja_journal_t* journal,
+                                 ninja_journal_kind_t kind,
+                                 uint64_t sequence,
+                                 ninja_order_id_t order_id);
+
+// Copy out every request without a completion, oldest first
+ninja_error_t ninja_journal_open_requests(const ninja_journal_t* journal,
+                                         ninja_journal_record_t** requests,
+                                         size_t* count);
+
+// Wait until every record written so far is on disk
+ninja_error_t ninja_journal_sync(ninja_journal_t* journal);
+
+#ifdef __cplusplus
+}
+#endif
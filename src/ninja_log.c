@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_log.h"
+#include "ninja_client.h"
+#include "ninja_atomic.h"
+#include "../include/ninja/ninja_api.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Longest the log thread sleeps; bounds how stale the file can be
+#define NINJA_LOG_POLL_MS 50
+
+// Helper function to write one record as a line of text
+static void ninja_log_format(FILE* file, const ninja_log_record_t* record) {
+    char timestamp[32];
+    if (ninja_format_timestamp(record->timestamp_ns, timestamp, sizeof(timestamp)) != NINJA_OK) {
+        snprintf(timestamp, sizeof(timestamp), "%lld", (long long)record->timestamp_ns);
+    }
+
+    const char* method = record->method == 'P' ? "POST" : record->method == 'D' ? "DELETE" : "GET";
+    double milliseconds = (double)record->duration_ns / 1e6;
+    const char* error_text = record->text + strlen(record->text) + 1;
+
+    switch (record->event) {
+        case NINJA_LOG_RESPONSE:
+            fprintf(file, "%s %s %s -> %d in %.3f ms, %lld bytes",
+                    timestamp, method, record->text, (int)record->status, milliseconds, (long long)record->value);
+            break;
+        case NINJA_LOG_RETRY:
+            if (record->status > 0) {
+                fprintf(file, "%s %s %s -> %d, retrying (attempt %u)",
+                        timestamp, method, record->text, (int)record->status, (unsigned)record->attempts);
+            } else {
+                fprintf(file, "%s %s %s failed: %s, retrying (attempt %u)",
+                        timestamp, method, record->text, curl_easy_strerror((CURLcode)record->value),
+                        (unsigned)record->attempts);
+            }
+            break;
+        case NINJA_LOG_TRANSPORT:
+            fprintf(file, "%s %s %s failed: %s in %.3f ms",
+                    timestamp, method, record->text, curl_easy_strerror((CURLcode)record->value), milliseconds);
+            break;
+        case NINJA_LOG_ORDER_ACK:
+            fprintf(file, "%s order %lld acknowledged (clOrdId %s)",
+                    timestamp, (long long)record->value, record->text);
+            break;
+        case NINJA_LOG_ORDER_REJECT:
+            fprintf(file, "%s order rejected (clOrdId %s)%s%s",
+                    timestamp, record->text, error_text[0] ? ": " : "", error_text);
+            break;
+        default:
+            fprintf(file, "%s unknown record %u", timestamp, (unsigned)record->event);
+            break;
+    }
+    if (record->event == NINJA_LOG_RESPONSE || record->event == NINJA_LOG_TRANSPORT) {
+        if (record->attempts > 1) {
+            fprintf(file, " after %u attempts", (unsigned)record->attempts);
+        }
+    }
+    fputc('\n', file);
+}
+
+// Helper function for the log thread: format records until stopped
+static void ninja_log_main(void* arg) {
+    ninja_log_t* log = arg;
+    ninja_log_record_t record;
+
+    for (;;) {
+        bool wrote = false;
+        while (ninja_ring_pop(&log->ring, &record)) {
+            ninja_log_format(log->file, &record);
+            wrote = true;
+        }
+
+        uint64_t dropped = ninja_atomic_load_relaxed(&log->dropped);
+        if (dropped != log->dropped_reported) {
+            fprintf(log->file, "debug log full: %llu records dropped\n",
+                    (unsigned long long)(dropped - log->dropped_reported));
+            log->dropped_reported = dropped;
+            wrote = true;
+        }
+        if (wrote) {
+            fflush(log->file);
+        }
+
+        // Producers never signal: the thread polls, so logging costs them one push
+        ninja_mutex_lock(&log->wake_lock);
+        bool running = ninja_atomic_load_acquire(&log->running) != 0;
+        if (running && ninja_ring_empty(&log->ring)) {
+            ninja_cond_wait(&log->wake, &log->wake_lock, NINJA_LOG_POLL_MS);
+        }
+        ninja_mutex_unlock(&log->wake_lock);
+
+        if (!running && ninja_ring_empty(&log->ring)) {
+            break;
+        }
+    }
+}
+
+ninja_error_t ninja_log_start(ninja_log_t** log_out, const char* path, size_t capacity) {
+    if (!log_out || capacity == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_log_t* log = calloc(1, sizeof(ninja_log_t));
+    if (!log) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_error_t result = ninja_ring_init(&log->ring, capacity, sizeof(ninja_log_record_t));
+    if (result != NINJA_OK) {
+        free(log);
+        return result;
+    }
+
+    log->file = path ? fopen(path, "a") : stderr;
+    log->owns_file = path != NULL;
+    if (!log->file) {
+        ninja_ring_free(&log->ring);
+        free(log);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    ninja_mutex_init(&log->wake_lock);
+    ninja_cond_init(&log->wake);
+    log->running = 1;
+
+    result = ninja_thread_start(&log->thread, ninja_log_main, log, -1);
+    if (result != NINJA_OK) {
+        ninja_cond_destroy(&log->wake);
+        ninja_mutex_destroy(&log->wake_lock);
+        if (log->owns_file) {
+            fclose(log->file);
+        }
+        ninja_ring_free(&log->ring);
+        free(log);
+        return result;
+    }
+
+    *log_out = log;
+    return NINJA_OK;
+}
+
+void ninja_log_stop(ninja_log_t* log) {
+    if (!log) {
+        return;
+    }
+
+    ninja_atomic_store_release(&log->running, 0);
+    ninja_mutex_lock(&log->wake_lock);
+    ninja_cond_signal(&log->wake);
+    ninja_mutex_unlock(&log->wake_lock);
+    ninja_thread_join(&log->thread);
+
+    ninja_cond_destroy(&log->wake);
+    ninja_mutex_destroy(&log->wake_lock);
+    if (log->owns_file) {
+        fclose(log->file);
+    }
+    ninja_ring_free(&log->ring);
+    free(log);
+}
+
+// Helper function to queue a record, counting it if the ring is full
+static void ninja_log_push(ninja_log_t* log, const ninja_log_record_t* record) {
+    if (ninja_ring_push(&log->ring, record, NULL) != NINJA_OK) {
+        ninja_atomic_fetch_add(&log->dropped, 1);
+    }
+}
+
+// Helper function to copy a string into a record field, keeping its tail
+// when it is too long: the end of a URL is the endpoint
+static size_t ninja_log_copy_tail(char* field, size_t size, const char* text) {
+    size_t length = text ? strlen(text) : 0;
+    size_t start = length >= size ? length - (size - 1) : 0;
+    if (length > start) {
+        memcpy(field, text + start, length - start);
+    }
+    field[length - start] = '\0';
+    return length - start;
+}
+
+void ninja_log_http(ninja_log_t* log,
+                    ninja_log_event_t event,
+                    char method,
+                    const char* url,
+                    long status,
+                    int64_t value,
+                    int64_t duration_ns,
+                    int attempts) {
+    if (!log) {
+        return;
+    }
+
+    ninja_log_record_t record;
+    record.timestamp_ns = ninja_wall_clock_ns();
+    record.duration_ns = duration_ns;
+    record.value = value;
+    record.status = (int32_t)status;
+    record.event = (uint8_t)event;
+    record.method = method;
+    record.attempts = (uint16_t)attempts;
+    ninja_log_copy_tail(record.text, sizeof(record.text), url);
+    ninja_log_push(log, &record);
+}
+
+void ninja_log_order(ninja_log_t* log,
+                     ninja_log_event_t event,
+                     ninja_order_id_t order_id,
+                     const char* client_order_id,
+                     const char* error_text) {
+    if (!log) {
+        return;
+    }
+
+    ninja_log_record_t record;
+    record.timestamp_ns = ninja_wall_clock_ns();
+    record.duration_ns = 0;
+    record.value = order_id;
+    record.status = 0;
+    record.event = (uint8_t)event;
+    record.method = 0;
+    record.attempts = 0;
+
+    // The clOrdId, then as much of the error text as fits; its start says the most
+    size_t used = ninja_log_copy_tail(record.text, NINJA_CLIENT_ORDER_ID_SIZE, client_order_id);
+    char* error_field = record.text + used + 1;
+    size_t length = error_text ? strlen(error_text) : 0;
+    size_t room = sizeof(record.text) - used - 2;
+    if (length > room) {
+        length = room;
+    }
+    if (length > 0) {
+        memcpy(error_field, error_text, length);
+    }
+    error_field[length] = '\0';
+    ninja_log_push(log, &record);
+}
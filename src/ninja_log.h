@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_ring.h"
+#include "ninja_thread.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// What a debug log record describes
+typedef enum {
+    NINJA_LOG_RESPONSE,         // HTTP request answered: status, duration, body bytes
+    NINJA_LOG_RETRY,            // Attempt failed and will be repeated
+    NINJA_LOG_TRANSPORT,        // Request failed without an answer; value is the curl code
+    NINJA_LOG_ORDER_ACK,        // Placement acknowledged; value is the order id
+    NINJA_LOG_ORDER_REJECT      // Placement refused
+} ninja_log_event_t;
+
+// Fixed-size binary record, copied into the ring as is. Formatting happens
+// on the log thread, so producers never touch a FILE or a format string.
+typedef struct {
+    int64_t timestamp_ns;       // Wall clock
+    int64_t duration_ns;
+    int64_t value;
+    int32_t status;
+    uint8_t event;              // ninja_log_event_t
+    char method;                // 'G', 'P' or 'D'; 0 for order events
+    uint16_t attempts;
+    // Endpoint (its tail if too long) for HTTP events; for order events the
+    // clOrdId, then the error text after its terminator
+    char text[96];
+} ninja_log_record_t;
+
+// Background debug log: a bounded lock-free ring the log thread drains into
+// a file. A full ring drops records rather than blocking; the log thread
+// reports how many were lost.
+typedef struct ninja_log {
+    ninja_ring_t ring;
+    ninja_thread_t thread;
+    FILE* file;
+    bool owns_file;
+    uint64_t running;
+    uint64_t dropped;
+    uint64_t dropped_reported;
+    ninja_mutex_t wake_lock;
+    ninja_cond_t wake;
+} ninja_log_t;
+
+// Start logging to path (appended to), or stderr if path is NULL
+ninja_error_t ninja_log_start(ninja_log_t** log, const char* path, size_t capacity);
+
+// Write out everything logged so far, then stop the thread and free the log
+void ninja_log_stop(ninja_log_t* log);
+
+// Producer side, any thread; a NULL log ignores the call
+void ninja_log_http(ninja_log_t* log,
+                    ninja_log_event_t event,
+                    char method,
+                    const char* url,
+                    long status,
+                    int64_t value,
+                    int64_t duration_ns,
+                    int attempts);
+void ninja_log_order(ninja_log_t* log,
+                     ninja_log_event_t event,
+                     ninja_order_id_t order_id,
+                     const char* client_order_id,
+                     const char* error_text);
+
+#ifdef __cplusplus
+}
+#endif
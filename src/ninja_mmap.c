@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_mmap.h"
+#include "ninja_platform.h"
+#include <string.h>
+
+#ifdef _WIN32
+
+static ninja_error_t ninja_mmap_map_view(ninja_mmap_t* map) {
+    DWORD protect = map->writable ? PAGE_READWRITE : PAGE_READONLY;
+    DWORD access = map->writable ? FILE_MAP_WRITE : FILE_MAP_READ;
+    LARGE_INTEGER size;
+    size.QuadPart = (LONGLONG)map->size;
+
+    map->mapping = CreateFileMappingA((HANDLE)map->file, NULL, protect, size.HighPart, size.LowPart, NULL);
+    if (!map->mapping) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    map->data = MapViewOfFile((HANDLE)map->mapping, access, 0, 0, map->size);
+    if (!map->data) {
+        CloseHandle((HANDLE)map->mapping);
+        map->mapping = NULL;
+        return NINJA_ERROR_MEMORY;
+    }
+
+    return NINJA_OK;
+}
+
+static void ninja_mmap_unmap_view(ninja_mmap_t* map) {
+    if (map->data) {
+        UnmapViewOfFile(map->data);
+        map->data = NULL;
+    }
+    if (map->mapping) {
+        CloseHandle((HANDLE)map->mapping);
+        map->mapping = NULL;
+    }
+}
+
+static ninja_error_t ninja_mmap_set_file_size(ninja_mmap_t* map, size_t size) {
+    LARGE_INTEGER position;
+    position.QuadPart = (LONGLONG)size;
+    if (!SetFilePointerEx((HANDLE)map->file, position, NULL, FILE_BEGIN) || !SetEndOfFile((HANDLE)map->file)) {
+        return NINJA_ERROR_MEMORY;
+    }
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_mmap_open(ninja_mmap_t* map, const char* path, size_t size, bool writable) {
+    if (!map || !path || (writable && size == 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(map, 0, sizeof(ninja_mmap_t));
+    map->writable = writable;
+
+    HANDLE file = CreateFileA(path,
+                              writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              NULL,
+                              writable ? OPEN_ALWAYS : OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+    map->file = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    map->size = writable ? size : (size_t)file_size.QuadPart;
+    if (map->size == 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    if (writable && (size_t)file_size.QuadPart < size && ninja_mmap_set_file_size(map, size) != NINJA_OK) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_error_t result = ninja_mmap_map_view(map);
+    if (result != NINJA_OK) {
+        ninja_mmap_close(map);
+    }
+    return result;
+}
+
+ninja_error_t ninja_mmap_resize(ninja_mmap_t* map, size_t size) {
+    if (!map || !map->writable || size == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_mmap_unmap_view(map);
+    if (ninja_mmap_set_file_size(map, size) != NINJA_OK) {
+        return NINJA_ERROR_MEMORY;
+    }
+    map->size = size;
+    return ninja_mmap_map_view(map);
+}
+
+ninja_error_t ninja_mmap_sync(ninja_mmap_t* map, size_t offset, size_t length, bool wait) {
+    if (!map || !map->data || offset + length > map->size) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    if (!FlushViewOfFile((char*)map->data + offset, length)) {
+        return NINJA_ERROR_CONNECTION;
+    }
+    if (wait && !FlushFileBuffers((HANDLE)map->file)) {
+        return NINJA_ERROR_CONNECTION;
+    }
+    return NINJA_OK;
+}
+
+void ninja_mmap_close(ninja_mmap_t* map) {
+    if (!map) {
+        return;
+    }
+
+    ninja_mmap_unmap_view(map);
+    if (map->file) {
+        CloseHandle((HANDLE)map->file);
+    }
+    memset(map, 0, sizeof(ninja_mmap_t));
+}
+
+ninja_error_t ninja_mmap_open_shared(ninja_mmap_t* map, const char* name, size_t size, bool create) {
+    if (!map || !name || (create && size == 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(map, 0, sizeof(ninja_mmap_t));
+    map->writable = create;
+
+    if (create) {
+        LARGE_INTEGER segment_size;
+        segment_size.QuadPart = (LONGLONG)size;
+        map->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                          segment_size.HighPart, segment_size.LowPart, name);
+    } else {
+        map->mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    }
+    if (!map->mapping) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    map->data = MapViewOfFile((HANDLE)map->mapping, create ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, create ? size : 0);
+    if (!map->data) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    MEMORY_BASIC_INFORMATION info;
+    map->size = create ? size : (VirtualQuery(map->data, &info, sizeof(info)) ? info.RegionSize : 0);
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_mmap_unlink_shared(const char* name) {
+    // Named mappings disappear with their last handle
+    return name ? NINJA_OK : NINJA_ERROR_INVALID_PARAM;
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static ninja_error_t ninja_mmap_map_view(ninja_mmap_t* map) {
+    int protect = PROT_READ | (map->writable ? PROT_WRITE : 0);
+    void* data = mmap(NULL, map->size, protect, MAP_SHARED, map->fd, 0);
+    if (data == MAP_FAILED) {
+        map->data = NULL;
+        return NINJA_ERROR_MEMORY;
+    }
+    map->data = data;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_mmap_open(ninja_mmap_t* map, const char* path, size_t size, bool writable) {
+    if (!map || !path || (writable && size == 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(map, 0, sizeof(ninja_mmap_t));
+    map->writable = writable;
+    map->fd = open(path, writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if (map->fd < 0) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    struct stat st;
+    if (fstat(map->fd, &st) != 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    map->size = writable ? size : (size_t)st.st_size;
+    if (map->size == 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    if (writable && (size_t)st.st_size < size && ftruncate(map->fd, (off_t)size) != 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_error_t result = ninja_mmap_map_view(map);
+    if (result != NINJA_OK) {
+        ninja_mmap_close(map);
+    }
+    return result;
+}
+
+ninja_error_t ninja_mmap_resize(ninja_mmap_t* map, size_t size) {
+    if (!map || !map->writable || size == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    if (map->data) {
+        munmap(map->data, map->size);
+        map->data = NULL;
+    }
+    if (ftruncate(map->fd, (off_t)size) != 0) {
+        return NINJA_ERROR_MEMORY;
+    }
+    map->size = size;
+    return ninja_mmap_map_view(map);
+}
+
+ninja_error_t ninja_mmap_sync(ninja_mmap_t* map, size_t offset, size_t length, bool wait) {
+    if (!map || !map->data || offset + length > map->size) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // msync needs a page-aligned start address
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t aligned = offset & ~(page - 1);
+    if (msync((char*)map->data + aligned, length + (offset - aligned), wait ? MS_SYNC : MS_ASYNC) != 0) {
+        return NINJA_ERROR_CONNECTION;
+    }
+    return NINJA_OK;
+}
+
+void ninja_mmap_close(ninja_mmap_t* map) {
+    if (!map) {
+        return;
+    }
+
+    if (map->data) {
+        munmap(map->data, map->size);
+    }
+    if (map->fd > 0) {
+        close(map->fd);
+    }
+    memset(map, 0, sizeof(ninja_mmap_t));
+}
+
+ninja_error_t ninja_mmap_open_shared(ninja_mmap_t* map, const char* name, size_t size, bool create) {
+    if (!map || !name || (create && size == 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(map, 0, sizeof(ninja_mmap_t));
+    map->writable = create;
+    map->fd = shm_open(name, create ? (O_RDWR | O_CREAT) : O_RDONLY, 0600);
+    if (map->fd < 0) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    struct stat st;
+    if (fstat(map->fd, &st) != 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    map->size = create ? size : (size_t)st.st_size;
+    if (map->size == 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    if (create && (size_t)st.st_size < size && ftruncate(map->fd, (off_t)size) != 0) {
+        ninja_mmap_close(map);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_error_t result = ninja_mmap_map_view(map);
+    if (result != NINJA_OK) {
+        ninja_mmap_close(map);
+    }
+    return result;
+}
+
+ninja_error_t ninja_mmap_unlink_shared(const char* name) {
+    if (!name) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return shm_unlink(name) == 0 ? NINJA_OK : NINJA_ERROR_NOT_FOUND;
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Memory-mapped file
+typedef struct {
+    void* data;
+    size_t size;
+    bool writable;
+#ifdef _WIN32
+    void* file;
+    void* mapping;
+#else
+    int fd;
+#endif
+} ninja_mmap_t;
+
+// Map path into memory. Read-only maps cover the whole existing file (size is
+// ignored); writable maps create the file if needed and extend it to size.
+ninja_error_t ninja_mmap_open(ninja_mmap_t* map, const char* path, size_t size, bool writable);
+
+// Grow or shrink a writable map; data may move
+ninja_error_t ninja_mmap_resize(ninja_mmap_t* map, size_t size);
+
+// Flush a byte range to disk; wait selects a synchronous flush
+ninja_error_t ninja_mmap_sync(ninja_mmap_t* map, size_t offset, size_t length, bool wait);
+
+void ninja_mmap_close(ninja_mmap_t* map);
+
+// Map a named shared memory segment. With create the segment is made (or
+// grown) to size and mapped writable; otherwise the existing segment is
+// mapped read-only at its current size.
+ninja_error_t ninja_mmap_open_shared(ninja_mmap_t* map, const char* name, size_t size, bool create);
+
+// Remove a named segment; mappings that are still open stay valid
+ninja_error_t ninja_mmap_unlink_shared(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
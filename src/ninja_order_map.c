@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_order_map.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Order id 0 is never assigned by the server and marks an empty slot
+#define NINJA_ORDER_MAP_EMPTY 0
+#define NINJA_ORDER_MAP_MIN_CAPACITY 64
+
+// splitmix64 finalizer: cheap and spreads sequential ids across the table
+static inline size_t ninja_order_map_hash(ninja_order_id_t order_id, size_t mask) {
+    uint64_t x = (uint64_t)order_id;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return (size_t)x & mask;
+}
+
+static ninja_error_t ninja_order_map_resize(ninja_order_map_t* map, size_t new_capacity) {
+
+    ninja_order_id_t* new_keys = calloc(new_capacity, sizeof(ninja_order_id_t));
+    ninja_order_t* new_values = malloc(new_capacity * sizeof(ninja_order_t));
+    if (!new_keys || !new_values) {
+        free(new_keys);
+        free(new_values);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    size_t mask = new_capacity - 1;
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->keys[i] == NINJA_ORDER_MAP_EMPTY) {
+            continue;
+        }
+
+        size_t slot = ninja_order_map_hash(map->keys[i], mask);
+        while (new_keys[slot] != NINJA_ORDER_MAP_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        new_keys[slot] = map->keys[i];
+        new_values[slot] = map->values[i];
+    }
+
+    free(map->keys);
+    free(map->values);
+    map->keys = new_keys;
+    map->values = new_values;
+    map->capacity = new_capacity;
+
+    return NINJA_OK;
+}
+
+static ninja_error_t ninja_order_map_grow(ninja_order_map_t* map) {
+    return ninja_order_map_resize(map, map->capacity ? map->capacity * 2 : NINJA_ORDER_MAP_MIN_CAPACITY);
+}
+
+void ninja_order_map_free(ninja_order_map_t* map) {
+    if (!map) {
+        return;
+    }
+
+    free(map->keys);
+    free(map->values);
+    memset(map, 0, sizeof(ninja_order_map_t));
+}
+
+void ninja_order_map_clear(ninja_order_map_t* map) {
+    if (map && map->keys) {
+        memset(map->keys, 0, map->capacity * sizeof(ninja_order_id_t));
+        map->count = 0;
+    }
+}
+
+ninja_error_t ninja_order_map_put(ninja_order_map_t* map, const ninja_order_t* order) {
+    if (!order) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_order_map_put_key(map, order->order_id, order);
+}
+
+ninja_error_t ninja_order_map_put_key(ninja_order_map_t* map, ninja_order_id_t key, const ninja_order_t* order) {
+    if (!map || !order || key == NINJA_ORDER_MAP_EMPTY) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Keep load factor at or below 70%
+    if (ninja_order_map_full(map)) {
+        ninja_error_t result = ninja_order_map_grow(map);
+        if (result != NINJA_OK) {
+            return result;
+        }
+    }
+
+    size_t mask = map->capacity - 1;
+    size_t slot = ninja_order_map_hash(key, mask);
+    while (map->keys[slot] != NINJA_ORDER_MAP_EMPTY && map->keys[slot] != key) {
+        slot = (slot + 1) & mask;
+    }
+
+    if (map->keys[slot] == NINJA_ORDER_MAP_EMPTY) {
+        map->keys[slot] = key;
+        map->count++;
+    }
+    map->values[slot] = *order;
+
+    return NINJA_OK;
+}
+
+ninja_order_t* ninja_order_map_get(const ninja_order_map_t* map, ninja_order_id_t order_id) {
+    if (!map || map->count == 0 || order_id == NINJA_ORDER_MAP_EMPTY) {
+        return NULL;
+    }
+
+    size_t mask = map->capacity - 1;
+    size_t slot = ninja_order_map_hash(order_id, mask);
+    while (map->keys[slot] != NINJA_ORDER_MAP_EMPTY) {
+        if (map->keys[slot] == order_id) {
+            return &map->values[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return NULL;
+}
+
+bool ninja_order_map_remove(ninja_order_map_t* map, ninja_order_id_t order_id) {
+    if (!map || map->count == 0 || order_id == NINJA_ORDER_MAP_EMPTY) {
+        return false;
+    }
+
+    size_t mask = map->capacity - 1;
+    size_t slot = ninja_order_map_hash(order_id, mask);
+    while (map->keys[slot] != order_id) {
+        if (map->keys[slot] == NINJA_ORDER_MAP_EMPTY) {
+            return false;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    size_t hole = slot;
+    size_t next = (hole + 1) & mask;
+    while (map->keys[next] != NINJA_ORDER_MAP_EMPTY) {
+        size_t home = ninja_order_map_hash(map->keys[next], mask);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            map->keys[hole] = map->keys[next];
+            map->values[hole] = map->values[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    map->keys[hole] = NINJA_ORDER_MAP_EMPTY;
+    map->count--;
+
+    return true;
+}
+
+bool ninja_order_map_full(const ninja_order_map_t* map) {
+    return (map->count + 1) * 10 > map->capacity * 7;
+}
+
+ninja_error_t ninja_order_map_reserve(ninja_order_map_t* map, size_t count) {
+    if (!map) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t capacity = map->capacity ? map->capacity : NINJA_ORDER_MAP_MIN_CAPACITY;
+    while (count * 10 > capacity * 7) {
+        capacity *= 2;
+    }
+    return capacity > map->capacity ? ninja_order_map_resize(map, capacity) : NINJA_OK;
+}
+
+size_t ninja_order_map_remove_if(ninja_order_map_t* map, bool (*match)(const ninja_order_t* order)) {
+    if (!map || !match) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    for (size_t i = 0; i < map->capacity;) {
+        if (map->keys[i] != NINJA_ORDER_MAP_EMPTY && match(&map->values[i])) {
+            // A key shifted back into this slot is checked next
+            ninja_order_map_remove(map, map->keys[i]);
+            removed++;
+            continue;
+        }
+        i++;
+    }
+
+    return removed;
+}
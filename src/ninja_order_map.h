@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Open-addressing hash map from numeric order id to the last known order state.
+// Keys and values are stored in separate arrays so probing only touches keys.
+typedef struct {
+    ninja_order_id_t* keys;
+    ninja_order_t* values;
+    size_t capacity;
+    size_t count;
+} ninja_order_map_t;
+
+void ninja_order_map_free(ninja_order_map_t* map);
+void ninja_order_map_clear(ninja_order_map_t* map);
+
+ninja_error_t ninja_order_map_put(ninja_order_map_t* map, const ninja_order_t* order);
+
+// Store order under a key other than its order id (any nonzero value)
+ninja_error_t ninja_order_map_put_key(ninja_order_map_t* map, ninja_order_id_t key, const ninja_order_t* order);
+ninja_order_t* ninja_order_map_get(const ninja_order_map_t* map, ninja_order_id_t order_id);
+bool ninja_order_map_remove(ninja_order_map_t* map, ninja_order_id_t order_id);
+
+// Whether adding one more key would grow the map
+bool ninja_order_map_full(const ninja_order_map_t* map);
+
+// Make room for count keys without growing again
+ninja_error_t ninja_order_map_reserve(ninja_order_map_t* map, size_t count);
+
+// Remove every order match selects; returns how many were removed
+size_t ninja_order_map_remove_if(ninja_order_map_t* map, bool (*match)(const ninja_order_t* order));
+
+#ifdef __cplusplus
+}
+#endif
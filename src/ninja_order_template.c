@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_order_template.h"
+#include "ninja_client.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Prices are scaled to units of 10^-9 in an int64, which bounds the integer
+// part at 9223372036 (INT64_MAX / 10^9); that also fits the 10-digit slot
+#define NINJA_TEMPLATE_PRICE_SCALE 1000000000.0
+#define NINJA_TEMPLATE_PRICE_LIMIT 9223372036.0
+
+bool ninja_template_write_int(char* slot, size_t width, int value) {
+    char digits[12];
+    size_t count = 0;
+    unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    size_t length = count + (value < 0 ? 1 : 0);
+    if (length > width) {
+        return false;
+    }
+
+    char* out = slot;
+    if (value < 0) {
+        *out++ = '-';
+    }
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+    memset(out, ' ', width - length);
+
+    return true;
+}
+
+bool ninja_template_write_price(char* slot, double price) {
+    // Also rejects NaN
+    if (!(price >= -NINJA_TEMPLATE_PRICE_LIMIT && price <= NINJA_TEMPLATE_PRICE_LIMIT)) {
+        return false;
+    }
+
+    double scaled = price * NINJA_TEMPLATE_PRICE_SCALE;
+    int64_t units = (int64_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    uint64_t magnitude = units < 0 ? (uint64_t)-units : (uint64_t)units;
+    uint64_t whole = magnitude / 1000000000ULL;
+    uint32_t fraction = (uint32_t)(magnitude % 1000000000ULL);
+
+    char* out = slot;
+    if (units < 0) {
+        *out++ = '-';
+    }
+
+    char digits[12];
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + whole % 10);
+        whole /= 10;
+    } while (whole > 0);
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+
+    if (fraction > 0) {
+        int decimals = 9;
+        while (fraction % 10 == 0) {
+            fraction /= 10;
+            decimals--;
+        }
+        *out++ = '.';
+        for (int i = decimals - 1; i >= 0; i--) {
+            out[i] = (char)('0' + fraction % 10);
+            fraction /= 10;
+        }
+        out += decimals;
+    }
+    memset(out, ' ', (size_t)(slot + NINJA_TEMPLATE_PRICE_WIDTH - out));
+
+    return true;
+}
+
+// Helper function to append a "key":<slot> member and return the slot's offset
+static size_t ninja_template_append_slot(char* body, size_t* length, const char* key, size_t width, bool quoted) {
+    size_t used = *length;
+    used += (size_t)sprintf(body + used, "%s\"%s\":%s", body[used - 1] == '{' ? "" : ",", key, quoted ? "\"" : "");
+
+    size_t slot = used;
+    memset(body + used, ' ', width);
+    used += width;
+    if (quoted) {
+        body[used++] = '"';
+    }
+
+    *length = used;
+    return slot;
+}
+
+ninja_error_t ninja_order_template_create(ninja_client_t* client,
+                                         const ninja_order_request_t* prototype,
+                                         ninja_order_template_t** order_template) {
+    if (!client || !prototype || !order_template) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *order_template = NULL;
+
+    if ((unsigned)prototype->side >= NINJA_SIDE_UNKNOWN || (unsigned)prototype->type >= NINJA_ORDER_TYPE_UNKNOWN) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // The fixed members go through the same encoder as every other placement
+    cJSON* json = ninja_order_request_json(prototype, false);
+    if (!json) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+    char* fixed = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (!fixed) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    size_t fixed_length = strlen(fixed);
+    ninja_order_template_t* created = calloc(1, sizeof(ninja_order_template_t));
+    char* body = malloc(fixed_length + 256);
+    if (!created || !body) {
+        free(created);
+        free(body);
+        free(fixed);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    // Everything up to the closing brace, then one slot per variable member
+    size_t length = fixed_length - 1;
+    memcpy(body, fixed, length);
+    free(fixed);
+
+    created->quantity_slot = ninja_template_append_slot(body, &length, "orderQty", NINJA_TEMPLATE_QUANTITY_WIDTH, false);
+    created->price_slot = ninja_order_type_uses_price(prototype->type)
+        ? ninja_template_append_slot(body, &length, "price", NINJA_TEMPLATE_PRICE_WIDTH, false)
+        : NINJA_TEMPLATE_NO_SLOT;
+    created->stop_price_slot = ninja_order_type_uses_stop_price(prototype->type)
+        ? ninja_template_append_slot(body, &length, "stopPrice", NINJA_TEMPLATE_PRICE_WIDTH, false)
+        : NINJA_TEMPLATE_NO_SLOT;
+    created->client_order_id_slot = ninja_template_append_slot(body, &length, "clOrdId", NINJA_TEMPLATE_KEY_WIDTH, true);
+    body[length++] = '}';
+    body[length] = '\0';
+
+    created->prototype = *prototype;
+    memset(created->prototype.client_order_id, 0, sizeof(created->prototype.client_order_id));
+    snprintf(created->url, sizeof(created->url), "%s/order/placeorder", client->base_url);
+    created->body = body;
+    created->length = length;
+
+    *order_template = created;
+    return NINJA_OK;
+}
+
+void ninja_order_template_free(ninja_order_template_t* order_template) {
+    if (!order_template) {
+        return;
+    }
+
+    free(order_template->body);
+    free(order_template);
+}
+
+ninja_error_t ninja_order_template_render(ninja_client_t* client,
+                                         ninja_order_template_t* order_template,
+                                         int quantity,
+                                         double price,
+                                         double stop_price,
+                                         const char** body,
+                                         size_t* length) {
+    if (!client || !order_template || !body || !length || quantity <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    char* rendered = order_template->body;
+    if (!ninja_template_write_int(rendered + order_template->quantity_slot, NINJA_TEMPLATE_QUANTITY_WIDTH, quantity)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    if (order_template->price_slot != NINJA_TEMPLATE_NO_SLOT &&
+        !ninja_template_write_price(rendered + order_template->price_slot, price)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    if (order_template->stop_price_slot != NINJA_TEMPLATE_NO_SLOT &&
+        !ninja_template_write_price(rendered + order_template->stop_price_slot, stop_price)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Every placement gets a fresh clOrdId, so a resent body is recognizable
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE];
+    ninja_next_client_order_id(client, client_order_id, sizeof(client_order_id));
+    memcpy(rendered + order_template->client_order_id_slot, client_order_id, NINJA_TEMPLATE_KEY_WIDTH);
+
+    *body = rendered;
+    *length = order_template->length;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_order_template_place(ninja_client_t* client,
+                                        ninja_order_template_t* order_template,
+                                        int quantity,
+                                        double price,
+                                        double stop_price,
+                                        ninja_order_t* order_out) {
+    if (!order_out) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    const char* body = NULL;
+    size_t length = 0;
+    ninja_error_t result = ninja_order_template_render(client, order_template, quantity, price, stop_price,
+                                                       &body, &length);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    // Journaled and tracked like any other placement
+    ninja_order_request_t request = order_template->prototype;
+    request.quantity = quantity;
+    request.price = price;
+    request.stop_price = stop_price;
+    memcpy(request.client_order_id, body + order_template->client_order_id_slot, NINJA_TEMPLATE_KEY_WIDTH);
+    uint64_t sequence = ninja_log_place(client, &request);
+
+    ninja_http_response_t response;
+    result = ninja_http_post_prepared(client, order_template->url, body, length, &response);
+
+    return ninja_end_place(client, sequence, request.client_order_id, result, &response, order_out);
+}
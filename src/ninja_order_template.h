@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Slot widths. Quantities are at most 10 digits; prices are sign, 10 integer
+// digits, point and 9 decimals; generated clOrdIds are "nt" plus 24 hex digits.
+#define NINJA_TEMPLATE_QUANTITY_WIDTH 10
+#define NINJA_TEMPLATE_PRICE_WIDTH 21
+#define NINJA_TEMPLATE_KEY_WIDTH 26
+
+// Marks a slot the template's order type does not send
+#define NINJA_TEMPLATE_NO_SLOT ((size_t)-1)
+
+// Rendered placeorder body plus the offsets of its variable slots. Numbers
+// are written left-aligned and padded with spaces, which JSON allows
+// between a value and the next token.
+struct ninja_order_template {
+    ninja_order_request_t prototype;
+    char url[512];
+    char* body;
+    size_t length;
+    size_t quantity_slot;
+    size_t price_slot;
+    size_t stop_price_slot;
+    size_t client_order_id_slot;
+};
+
+// Write value left-aligned into a width-byte slot; false if it does not fit
+bool ninja_template_write_int(char* slot, size_t width, int value);
+
+// Write price with up to 9 decimals (trailing zeros dropped) into a
+// NINJA_TEMPLATE_PRICE_WIDTH slot; false if it is not finite or too large
+bool ninja_template_write_price(char* slot, double price);
+
+#ifdef __cplusplus
+}
+#endif
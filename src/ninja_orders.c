@@ -22,119 +22,184 @@
 
 #include "../include/ninja/ninja_api.h"
 #include "ninja_client.h"
+#include "ninja_schema.h"
+#include "ninja_atomic.h"
+#include "ninja_trace.h"
 #include "cJSON.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
-// Helper function to convert order side enum to string
-static const char* ninja_order_side_to_string(ninja_order_side_t side) {
-    switch (side) {
-        case NINJA_SIDE_BUY: return "Buy";
-        case NINJA_SIDE_SELL: return "Sell";
-        default: return "Buy";
-    }
+// JSON schema of ninja_order_t, in the key order the server sends
+static const ninja_field_t ninja_order_fields[] = {
+    NINJA_SCHEMA_FIELD(ninja_order_t, "id", NINJA_FIELD_INT64, order_id)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "accountId", NINJA_FIELD_INT, account_id)
+    NINJA_SCHEMA_TIMESTAMP(ninja_order_t, "timestamp", timestamp, timestamp_ns)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "action", NINJA_FIELD_SIDE, side)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "ordStatus", NINJA_FIELD_ORDER_STATUS, status)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "isAutomated", NINJA_FIELD_BOOL, is_automated)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "orderType", NINJA_FIELD_ORDER_TYPE, type)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "orderQty", NINJA_FIELD_INT, quantity)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "price", NINJA_FIELD_DOUBLE, price)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "stopPrice", NINJA_FIELD_DOUBLE, stop_price)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "filledQty", NINJA_FIELD_INT, filled_quantity)
+    NINJA_SCHEMA_FIELD(ninja_order_t, "avgFillPrice", NINJA_FIELD_DOUBLE, filled_price)
+};
+
+// Request body of order/placeorder; the X-macro also yields field indices for the omit mask
+#define NINJA_ORDER_REQUEST_SCHEMA(FIELD) \
+    FIELD("accountSpec", NINJA_FIELD_STRING, account_spec) \
+    FIELD("accountId", NINJA_FIELD_INT, account_id) \
+    FIELD("symbol", NINJA_FIELD_STRING, symbol) \
+    FIELD("action", NINJA_FIELD_SIDE, side) \
+    FIELD("orderType", NINJA_FIELD_ORDER_TYPE, type) \
+    FIELD("orderQty", NINJA_FIELD_INT, quantity) \
+    FIELD("price", NINJA_FIELD_DOUBLE, price) \
+    FIELD("stopPrice", NINJA_FIELD_DOUBLE, stop_price) \
+    FIELD("isAutomated", NINJA_FIELD_BOOL, is_automated) \
+    FIELD("clOrdId", NINJA_FIELD_STRING, client_order_id)
+
+#define NINJA_ORDER_REQUEST_INDEX(key, kind, member) NINJA_ORDER_REQUEST_FIELD_##member,
+#define NINJA_ORDER_REQUEST_ENTRY(key, kind, member) NINJA_SCHEMA_FIELD(ninja_order_request_t, key, kind, member)
+
+enum { NINJA_ORDER_REQUEST_SCHEMA(NINJA_ORDER_REQUEST_INDEX) };
+
+static const ninja_field_t ninja_order_request_fields[] = {
+    NINJA_ORDER_REQUEST_SCHEMA(NINJA_ORDER_REQUEST_ENTRY)
+};
+
+bool ninja_order_type_uses_price(ninja_order_type_t type) {
+    return type == NINJA_ORDER_LIMIT || type == NINJA_ORDER_STOP_LIMIT || type == NINJA_ORDER_MIT;
 }
 
-// Helper function to convert order type enum to string
-static const char* ninja_order_type_to_string(ninja_order_type_t type) {
-    switch (type) {
-        case NINJA_ORDER_MARKET: return "Market";
-        case NINJA_ORDER_LIMIT: return "Limit";
-        case NINJA_ORDER_STOP: return "Stop";
-        case NINJA_ORDER_STOP_LIMIT: return "StopLimit";
-        default: return "Market";
-    }
+bool ninja_order_type_uses_stop_price(ninja_order_type_t type) {
+    return type == NINJA_ORDER_STOP || type == NINJA_ORDER_STOP_LIMIT ||
+           type == NINJA_ORDER_TRAILING_STOP || type == NINJA_ORDER_TRAILING_STOP_LIMIT;
 }
 
-// Helper function to parse order status from string
-static ninja_order_status_t ninja_parse_order_status(const char* status_str) {
-    if (!status_str) return NINJA_ORDER_PENDING;
-
-    if (strcmp(status_str, "Working") == 0) return NINJA_ORDER_WORKING;
-    if (strcmp(status_str, "Filled") == 0) return NINJA_ORDER_FILLED;
-    if (strcmp(status_str, "Cancelled") == 0) return NINJA_ORDER_CANCELLED;
-    if (strcmp(status_str, "Rejected") == 0) return NINJA_ORDER_REJECTED;
-
-    return NINJA_ORDER_PENDING;
+bool ninja_order_is_done(const ninja_order_t* order) {
+    ninja_order_status_t status = order->status;
+    return status == NINJA_ORDER_FILLED || status == NINJA_ORDER_CANCELLED || status == NINJA_ORDER_REJECTED ||
+           status == NINJA_ORDER_EXPIRED || status == NINJA_ORDER_COMPLETED;
 }
 
-// Helper function to parse JSON order into ninja_order_t
-static ninja_error_t ninja_parse_order(cJSON* order_json, ninja_order_t* order) {
-    if (!order_json || !order) {
-        return NINJA_ERROR_INVALID_PARAM;
-    }
+// Helper function to map a clOrdId to its key in the client order map
+static ninja_order_id_t ninja_client_order_key(const char* client_order_id) {
+    uint64_t hash = ninja_hash_bytes(client_order_id, strlen(client_order_id));
+    return (ninja_order_id_t)(hash ? hash : 1);
+}
 
-    // Clear order structure
-    memset(order, 0, sizeof(ninja_order_t));
+// Helper function to find a placement by clOrdId; call with client->lock held
+static ninja_order_t* ninja_client_order_get(ninja_client_t* client, const char* client_order_id) {
+    ninja_order_t* order = ninja_order_map_get(&client->client_order_map, ninja_client_order_key(client_order_id));
+    return order && strcmp(order->client_order_id, client_order_id) == 0 ? order : NULL;
+}
 
-    // Parse order fields
-    cJSON* id = cJSON_GetObjectItemCaseSensitive(order_json, "id");
-    if (id && cJSON_IsNumber(id)) {
-        snprintf(order->order_id, sizeof(order->order_id), "%d", (int)cJSON_GetNumberValue(id));
+// Helper function to store a placement under its clOrdId; call with
+// client->lock held. Before the map would grow, finished placements are
+// dropped, so it stays sized by the placements still in play. If that frees
+// less than a quarter of it the map grows anyway, so sweeps stay rare.
+static void ninja_client_order_put(ninja_client_t* client, const ninja_order_t* order) {
+    ninja_order_map_t* map = &client->client_order_map;
+    ninja_order_id_t key = ninja_client_order_key(order->client_order_id);
+    if (ninja_order_map_full(map) && !ninja_order_map_get(map, key)) {
+        size_t removed = ninja_order_map_remove_if(map, ninja_order_is_done);
+        if (removed < map->count / 4) {
+            ninja_order_map_reserve(map, map->count * 2);
+        }
     }
+    ninja_order_map_put_key(map, key, order);
+}
 
-    cJSON* account_id = cJSON_GetObjectItemCaseSensitive(order_json, "accountId");
-    if (account_id && cJSON_IsNumber(account_id)) {
-        order->account_id = (int)cJSON_GetNumberValue(account_id);
+// Helper function to record the latest state of an order locally and for
+// shared-memory readers; callers commit the shared-memory batch
+static void ninja_track_order(ninja_client_t* client, const ninja_order_t* order) {
+    // Broker updates carry no clOrdId; keep the one the order was placed with
+    ninja_order_t keyed;
+    if (order->client_order_id[0] == '\0') {
+        const ninja_order_t* known = ninja_order_map_get(&client->order_map, order->order_id);
+        if (known && known->client_order_id[0] != '\0') {
+            keyed = *order;
+            memcpy(keyed.client_order_id, known->client_order_id, sizeof(keyed.client_order_id));
+            order = &keyed;
+        }
     }
 
-    cJSON* action = cJSON_GetObjectItemCaseSensitive(order_json, "action");
-    if (action && cJSON_IsString(action)) {
-        const char* action_str = cJSON_GetStringValue(action);
-        order->side = (strcmp(action_str, "Buy") == 0) ? NINJA_SIDE_BUY : NINJA_SIDE_SELL;
+    ninja_order_map_put(&client->order_map, order);
+    if (order->client_order_id[0] != '\0') {
+        ninja_client_order_put(client, order);
     }
-
-    cJSON* order_type = cJSON_GetObjectItemCaseSensitive(order_json, "orderType");
-    if (order_type && cJSON_IsString(order_type)) {
-        const char* type_str = cJSON_GetStringValue(order_type);
-        if (strcmp(type_str, "Market") == 0) order->type = NINJA_ORDER_MARKET;
-        else if (strcmp(type_str, "Limit") == 0) order->type = NINJA_ORDER_LIMIT;
-        else if (strcmp(type_str, "Stop") == 0) order->type = NINJA_ORDER_STOP;
-        else order->type = NINJA_ORDER_MARKET;
+    if (client->shm.header) {
+        ninja_shm_publish_order(&client->shm, order);
     }
+}
 
-    cJSON* ord_status = cJSON_GetObjectItemCaseSensitive(order_json, "ordStatus");
-    if (ord_status && cJSON_IsString(ord_status)) {
-        order->status = ninja_parse_order_status(cJSON_GetStringValue(ord_status));
-    }
+// Helper function to record a placement as NINJA_ORDER_PENDING under its
+// clOrdId; call with client->lock held
+static void ninja_track_pending_order(ninja_client_t* client, const ninja_order_request_t* request) {
+    ninja_order_t pending;
+    memset(&pending, 0, sizeof(pending));
+    pending.account_id = request->account_id;
+    memcpy(pending.symbol, request->symbol, sizeof(pending.symbol));
+    pending.side = request->side;
+    pending.type = request->type;
+    pending.status = NINJA_ORDER_PENDING;
+    pending.quantity = request->quantity;
+    pending.price = request->price;
+    pending.stop_price = request->stop_price;
+    pending.timestamp_ns = ninja_wall_clock_ns();
+    pending.is_automated = request->is_automated;
+    memcpy(pending.client_order_id, request->client_order_id, sizeof(pending.client_order_id));
+
+    ninja_client_order_put(client, &pending);
+}
 
-    cJSON* order_qty = cJSON_GetObjectItemCaseSensitive(order_json, "orderQty");
-    if (order_qty && cJSON_IsNumber(order_qty)) {
-        order->quantity = (int)cJSON_GetNumberValue(order_qty);
+// Helper function to mark a placement refused by the broker
+static void ninja_reject_client_order(ninja_client_t* client, const char* client_order_id, const char* error_text) {
+    ninja_mutex_lock(&client->lock);
+    ninja_order_t* order = ninja_client_order_get(client, client_order_id);
+    if (order && order->status == NINJA_ORDER_PENDING) {
+        order->status = NINJA_ORDER_REJECTED;
+        if (error_text) {
+            snprintf(order->error_text, sizeof(order->error_text), "%s", error_text);
+        }
     }
+    ninja_mutex_unlock(&client->lock);
+}
 
-    cJSON* price = cJSON_GetObjectItemCaseSensitive(order_json, "price");
-    if (price && cJSON_IsNumber(price)) {
-        order->price = cJSON_GetNumberValue(price);
+ninja_error_t ninja_next_client_order_id(ninja_client_t* client, char* client_order_id, size_t size) {
+    if (!client || !client_order_id || size < NINJA_CLIENT_ORDER_ID_SIZE) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    cJSON* stop_price = cJSON_GetObjectItemCaseSensitive(order_json, "stopPrice");
-    if (stop_price && cJSON_IsNumber(stop_price)) {
-        order->stop_price = cJSON_GetNumberValue(stop_price);
+    // "nt", the client prefix, then the counter: fixed-width hex, so a
+    // client's ids also sort in the order they were generated
+    static const char hex[] = "0123456789abcdef";
+    uint64_t counter = ninja_atomic_fetch_add(&client->client_order_counter, 1) + 1;
+    char* out = client_order_id;
+    *out++ = 'n';
+    *out++ = 't';
+    for (int shift = 28; shift >= 0; shift -= 4) {
+        *out++ = hex[(client->client_order_prefix >> shift) & 0xf];
     }
-
-    cJSON* filled_qty = cJSON_GetObjectItemCaseSensitive(order_json, "filledQty");
-    if (filled_qty && cJSON_IsNumber(filled_qty)) {
-        order->filled_quantity = (int)cJSON_GetNumberValue(filled_qty);
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        *out++ = hex[(counter >> shift) & 0xf];
     }
+    *out = '\0';
 
-    cJSON* avg_fill_price = cJSON_GetObjectItemCaseSensitive(order_json, "avgFillPrice");
-    if (avg_fill_price && cJSON_IsNumber(avg_fill_price)) {
-        order->filled_price = cJSON_GetNumberValue(avg_fill_price);
-    }
+    return NINJA_OK;
+}
 
-    cJSON* timestamp = cJSON_GetObjectItemCaseSensitive(order_json, "timestamp");
-    if (timestamp && cJSON_IsString(timestamp)) {
-        strncpy(order->timestamp, cJSON_GetStringValue(timestamp), sizeof(order->timestamp) - 1);
+// Helper function to parse JSON order into ninja_order_t
+ninja_error_t ninja_parse_order(cJSON* order_json, ninja_order_t* order) {
+    if (!order_json || !order) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    cJSON* is_automated = cJSON_GetObjectItemCaseSensitive(order_json, "isAutomated");
-    if (is_automated && cJSON_IsBool(is_automated)) {
-        order->is_automated = cJSON_IsTrue(is_automated);
-    }
+    // Clear order structure
+    memset(order, 0, sizeof(ninja_order_t));
 
-    return NINJA_OK;
+    return ninja_schema_decode(ninja_order_fields, NINJA_SCHEMA_COUNT(ninja_order_fields), order_json, order);
 }
 
 ninja_error_t ninja_place_order(ninja_client_t* client,
@@ -152,130 +217,672 @@ ninja_error_t ninja_place_order(ninja_client_t* client,
         return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Create JSON request body
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strncpy(request.account_spec, account_spec, sizeof(request.account_spec) - 1);
+    request.account_id = account_id;
+    strncpy(request.symbol, symbol, sizeof(request.symbol) - 1);
+    request.side = side;
+    request.type = type;
+    request.quantity = quantity;
+    request.price = price;
+    request.stop_price = stop_price;
+    request.is_automated = is_automated;
+
+    return ninja_place_order_request(client, &request, order_out);
+}
+
+cJSON* ninja_order_request_json(const ninja_order_request_t* request, bool variable) {
+    // Price fields are only sent for order types that use them
+    uint32_t omit_mask = 0;
+    if (!variable) {
+        omit_mask |= 1u << NINJA_ORDER_REQUEST_FIELD_quantity;
+        omit_mask |= 1u << NINJA_ORDER_REQUEST_FIELD_client_order_id;
+    }
+    if (!variable || !ninja_order_type_uses_price(request->type)) {
+        omit_mask |= 1u << NINJA_ORDER_REQUEST_FIELD_price;
+    }
+    if (!variable || !ninja_order_type_uses_stop_price(request->type)) {
+        omit_mask |= 1u << NINJA_ORDER_REQUEST_FIELD_stop_price;
+    }
+
     cJSON* json = cJSON_CreateObject();
     if (!json) {
-        return NINJA_ERROR_JSON_PARSE;
+        return NULL;
     }
 
-    cJSON_AddStringToObject(json, "accountSpec", account_spec);
-    cJSON_AddNumberToObject(json, "accountId", account_id);
-    cJSON_AddStringToObject(json, "symbol", symbol);
-    cJSON_AddStringToObject(json, "action", ninja_order_side_to_string(side));
-    cJSON_AddStringToObject(json, "orderType", ninja_order_type_to_string(type));
-    cJSON_AddNumberToObject(json, "orderQty", quantity);
-    cJSON_AddBoolToObject(json, "isAutomated", is_automated);
+    if (ninja_schema_encode(ninja_order_request_fields,
+                            NINJA_SCHEMA_COUNT(ninja_order_request_fields),
+                            request, omit_mask, json) != NINJA_OK) {
+        cJSON_Delete(json);
+        return NULL;
+    }
+
+    return json;
+}
 
-    // Add price fields based on order type
-    if (type == NINJA_ORDER_LIMIT || type == NINJA_ORDER_STOP_LIMIT) {
-        cJSON_AddNumberToObject(json, "price", price);
+uint64_t ninja_log_place(ninja_client_t* client, const ninja_order_request_t* request) {
+    // Journal the intent before it can reach the broker
+    ninja_mutex_lock(&client->lock);
+    uint64_t sequence = ninja_journal_log_request(&client->journal, NINJA_JOURNAL_PLACE, request, 0);
+    ninja_track_pending_order(client, request);
+    ninja_mutex_unlock(&client->lock);
+
+    return sequence;
+}
+
+// Helper function to validate, encode and journal a placement before it is
+// sent; client_order_id receives the placement's clOrdId
+static ninja_error_t ninja_begin_place(ninja_client_t* client,
+                                      const ninja_order_request_t* request,
+                                      char** body,
+                                      uint64_t* sequence,
+                                      char* client_order_id) {
+    if (!request || request->quantity <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
-    if (type == NINJA_ORDER_STOP || type == NINJA_ORDER_STOP_LIMIT) {
-        cJSON_AddNumberToObject(json, "stopPrice", stop_price);
+
+    if ((unsigned)request->side >= NINJA_SIDE_UNKNOWN || (unsigned)request->type >= NINJA_ORDER_TYPE_UNKNOWN) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // The clOrdId lets a placement whose answer was lost be found again
+    // instead of being sent twice
+    ninja_order_request_t keyed = *request;
+    if (keyed.client_order_id[0] == '\0') {
+        ninja_next_client_order_id(client, keyed.client_order_id, sizeof(keyed.client_order_id));
+    }
+    keyed.client_order_id[sizeof(keyed.client_order_id) - 1] = '\0';
+    memcpy(client_order_id, keyed.client_order_id, sizeof(keyed.client_order_id));
+
+    // Create JSON request body
+    uint64_t trace_start = ninja_trace_start(ninja_trace_active());
+    cJSON* json = ninja_order_request_json(&keyed, true);
+    if (!json) {
+        return NINJA_ERROR_JSON_PARSE;
     }
 
-    char* json_string = cJSON_Print(json);
+    *body = cJSON_Print(json);
     cJSON_Delete(json);
+    ninja_trace_span(ninja_trace_active(), NINJA_SPAN_SERIALIZE, trace_start);
 
-    if (!json_string) {
+    if (!*body) {
         return NINJA_ERROR_JSON_PARSE;
     }
 
-    // Make HTTP request
-    ninja_http_response_t response;
-    ninja_error_t result = ninja_http_post(client, "order/placeorder", json_string, &response);
-    free(json_string);
+    *sequence = ninja_log_place(client, &keyed);
 
+    return NINJA_OK;
+}
+
+// Helper function to download command/list, the only place the broker reports
+// the clOrdId each command carried. The API has no clOrdId or per-account
+// filter on commands, so this is the whole list.
+static ninja_error_t ninja_fetch_commands(ninja_client_t* client, cJSON** commands) {
+    ninja_http_response_t response;
+    ninja_error_t result = ninja_http_get(client, "command/list", &response);
     if (result != NINJA_OK) {
+        ninja_http_response_free(&response);
         return result;
     }
 
-    // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
+    *commands = cJSON_Parse(response.data);
     ninja_http_response_free(&response);
+    if (!*commands || !cJSON_IsArray(*commands)) {
+        cJSON_Delete(*commands);
+        *commands = NULL;
+        return NINJA_ERROR_JSON_PARSE;
+    }
 
-    if (!response_json) {
+    return NINJA_OK;
+}
+
+// Helper function to find the order created by the command with the given
+// clOrdId, 0 if there is none
+static ninja_order_id_t ninja_command_order_id(const cJSON* commands, const char* client_order_id) {
+    if (client_order_id[0] == '\0') {
+        return 0;
+    }
+
+    cJSON* command = NULL;
+    cJSON_ArrayForEach(command, commands) {
+        cJSON* key = cJSON_GetObjectItemCaseSensitive(command, "clOrdId");
+        cJSON* id = cJSON_GetObjectItemCaseSensitive(command, "orderId");
+        if (cJSON_IsString(key) && cJSON_IsNumber(id) && strcmp(key->valuestring, client_order_id) == 0) {
+            return (ninja_order_id_t)cJSON_GetNumberValue(id);
+        }
+    }
+
+    return 0;
+}
+
+// Helper function to find the order a placement created from its clOrdId,
+// for placements whose answer was lost or did not parse. NINJA_ERROR_NOT_FOUND
+// if the broker has no command with that clOrdId. Each call downloads the
+// whole command/list, which is acceptable only because lost answers are rare.
+static ninja_error_t ninja_reconcile_place(ninja_client_t* client,
+                                          const char* client_order_id,
+                                          ninja_order_t* order_out) {
+    cJSON* commands = NULL;
+    ninja_error_t result = ninja_fetch_commands(client, &commands);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    ninja_order_id_t order_id = ninja_command_order_id(commands, client_order_id);
+    cJSON_Delete(commands);
+
+    if (order_id <= 0) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    char endpoint[64];
+    snprintf(endpoint, sizeof(endpoint), "order/item?id=%lld", (long long)order_id);
+    ninja_http_response_t response;
+    result = ninja_http_get(client, endpoint, &response);
+    if (result != NINJA_OK) {
+        ninja_http_response_free(&response);
+        return result;
+    }
+
+    cJSON* order_json = cJSON_Parse(response.data);
+    ninja_http_response_free(&response);
+    if (!order_json) {
         return NINJA_ERROR_JSON_PARSE;
     }
 
-    // Check for error in response
-    cJSON* error_text = cJSON_GetObjectItemCaseSensitive(response_json, "errorText");
-    if (error_text && cJSON_IsString(error_text)) {
-        strncpy(order_out->error_text, cJSON_GetStringValue(error_text), sizeof(order_out->error_text) - 1);
+    result = ninja_parse_order(order_json, order_out);
+    cJSON_Delete(order_json);
+
+    return result;
+}
+
+ninja_error_t ninja_end_place(ninja_client_t* client,
+                             uint64_t sequence,
+                             const char* client_order_id,
+                             ninja_error_t result,
+                             ninja_http_response_t* response,
+                             ninja_order_t* order_out) {
+    // Parse response
+    uint64_t trace_start = 0;
+    cJSON* response_json = NULL;
+    if (result == NINJA_OK) {
+        trace_start = ninja_trace_start(ninja_trace_active());
+        response_json = cJSON_Parse(response->data);
+        ninja_http_response_free(response);
+
+        // An answer that does not parse says nothing about the order
+        if (!response_json) {
+            result = NINJA_ERROR_JSON_PARSE;
+        }
+    }
+
+    if (result != NINJA_OK) {
+        // Only a 4xx answer proves the order was refused
+        bool refused = result == NINJA_ERROR_HTTP && response->status_code < 500;
+        ninja_http_response_free(response);
+        if (refused) {
+            ninja_mutex_lock(&client->lock);
+            ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_REJECT, sequence, 0);
+            ninja_mutex_unlock(&client->lock);
+            ninja_reject_client_order(client, client_order_id, NULL);
+            ninja_log_order(client->debug_log, NINJA_LOG_ORDER_REJECT, 0, client_order_id, ninja_error_string(result));
+            return result;
+        }
+
+        // Otherwise the order may have been placed: look it up rather than
+        // resend it. If it cannot be found it stays in flight in the journal.
+        if (ninja_reconcile_place(client, client_order_id, order_out) != NINJA_OK || order_out->order_id == 0) {
+            return result;
+        }
+        result = NINJA_OK;
+    } else {
+        // Check for error in response
+        cJSON* error_text = cJSON_GetObjectItemCaseSensitive(response_json, "errorText");
+        if (error_text && cJSON_IsString(error_text)) {
+            strncpy(order_out->error_text, cJSON_GetStringValue(error_text), sizeof(order_out->error_text) - 1);
+            cJSON_Delete(response_json);
+            ninja_mutex_lock(&client->lock);
+            ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_REJECT, sequence, 0);
+            ninja_mutex_unlock(&client->lock);
+            ninja_reject_client_order(client, client_order_id, order_out->error_text);
+            ninja_log_order(client->debug_log, NINJA_LOG_ORDER_REJECT, 0, client_order_id, order_out->error_text);
+            return NINJA_ERROR_ORDER_REJECTED;
+        }
+
+        // Parse order data from response
+        result = ninja_parse_order(response_json, order_out);
         cJSON_Delete(response_json);
-        return NINJA_ERROR_ORDER_REJECTED;
+        ninja_trace_span(ninja_trace_active(), NINJA_SPAN_PARSE, trace_start);
     }
 
-    // Parse order data from response
-    result = ninja_parse_order(response_json, order_out);
-    cJSON_Delete(response_json);
+    if (result == NINJA_OK && order_out->order_id != 0) {
+        strncpy(order_out->client_order_id, client_order_id, sizeof(order_out->client_order_id) - 1);
+        ninja_mutex_lock(&client->lock);
+        ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_ACK, sequence, order_out->order_id);
+        ninja_track_order(client, order_out);
+        ninja_shm_commit(&client->shm);
+        ninja_mutex_unlock(&client->lock);
+        ninja_log_order(client->debug_log, NINJA_LOG_ORDER_ACK, order_out->order_id, client_order_id, NULL);
+    }
 
     return result;
 }
 
-ninja_error_t ninja_cancel_order(ninja_client_t* client, const char* order_id) {
-    if (!client || !order_id) {
-        return NINJA_ERROR_INVALID_PARAM;
+char* ninja_cancel_request_body(ninja_order_id_t order_id) {
+    cJSON* json = cJSON_CreateObject();
+    if (!json) {
+        return NULL;
     }
 
-    // Create JSON request body
+    cJSON_AddNumberToObject(json, "orderId", (double)order_id);
+
+    char* body = cJSON_Print(json);
+    cJSON_Delete(json);
+    return body;
+}
+
+char* ninja_modify_request_body(ninja_order_id_t order_id, int quantity, double price) {
     cJSON* json = cJSON_CreateObject();
     if (!json) {
-        return NINJA_ERROR_JSON_PARSE;
+        return NULL;
     }
 
-    cJSON_AddStringToObject(json, "orderId", order_id);
+    cJSON_AddNumberToObject(json, "orderId", (double)order_id);
+    cJSON_AddNumberToObject(json, "orderQty", quantity);
+    cJSON_AddNumberToObject(json, "price", price);
 
-    char* json_string = cJSON_Print(json);
+    char* body = cJSON_Print(json);
     cJSON_Delete(json);
+    return body;
+}
 
-    if (!json_string) {
+// Helper function to encode and journal a cancel before it is sent
+static ninja_error_t ninja_begin_cancel(ninja_client_t* client,
+                                       ninja_order_id_t order_id,
+                                       char** body,
+                                       uint64_t* sequence) {
+    if (order_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Create JSON request body
+    uint64_t trace_start = ninja_trace_start(ninja_trace_active());
+    *body = ninja_cancel_request_body(order_id);
+    ninja_trace_span(ninja_trace_active(), NINJA_SPAN_SERIALIZE, trace_start);
+
+    if (!*body) {
         return NINJA_ERROR_JSON_PARSE;
     }
 
-    // Make HTTP request
-    ninja_http_response_t response;
-    ninja_error_t result = ninja_http_post(client, "order/cancelorder", json_string, &response);
-    free(json_string);
-    ninja_http_response_free(&response);
+    // Journal the cancel with the order's account so recovery can query it
+    *sequence = 0;
+    ninja_mutex_lock(&client->lock);
+    if (client->journal.records) {
+        ninja_order_request_t target;
+        memset(&target, 0, sizeof(target));
+        const ninja_order_t* known = ninja_order_map_get(&client->order_map, order_id);
+        if (known) {
+            target.account_id = known->account_id;
+            memcpy(target.client_order_id, known->client_order_id, sizeof(target.client_order_id));
+        }
+        *sequence = ninja_journal_log_request(&client->journal, NINJA_JOURNAL_CANCEL, &target, order_id);
+    }
+    ninja_mutex_unlock(&client->lock);
+
+    return NINJA_OK;
+}
+
+// Helper function to settle a cancel from its HTTP outcome; frees the response
+static ninja_error_t ninja_end_cancel(ninja_client_t* client,
+                                     ninja_order_id_t order_id,
+                                     uint64_t sequence,
+                                     ninja_error_t result,
+                                     ninja_http_response_t* response) {
+    ninja_mutex_lock(&client->lock);
+    if (result == NINJA_OK) {
+        ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_ACK, sequence, order_id);
+    } else if (result == NINJA_ERROR_HTTP && response->status_code < 500) {
+        ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_REJECT, sequence, order_id);
+    }
+    ninja_mutex_unlock(&client->lock);
+    ninja_http_response_free(response);
 
     return result;
 }
 
-ninja_error_t ninja_modify_order(ninja_client_t* client,
-                                const char* order_id,
-                                int new_quantity,
-                                double new_price) {
-    if (!client || !order_id || new_quantity <= 0) {
-        return NINJA_ERROR_INVALID_PARAM;
+// Helper function to settle an order query from its HTTP outcome; frees the response
+static ninja_error_t ninja_end_query(ninja_client_t* client,
+                                    ninja_error_t result,
+                                    ninja_http_response_t* response,
+                                    ninja_order_t* order) {
+    if (result != NINJA_OK) {
+        ninja_http_response_free(response);
+        return result;
     }
 
-    // Create JSON request body
-    cJSON* json = cJSON_CreateObject();
-    if (!json) {
+    uint64_t trace_start = ninja_trace_start(ninja_trace_active());
+    cJSON* response_json = cJSON_Parse(response->data);
+    ninja_http_response_free(response);
+
+    if (!response_json) {
         return NINJA_ERROR_JSON_PARSE;
     }
 
-    cJSON_AddStringToObject(json, "orderId", order_id);
-    cJSON_AddNumberToObject(json, "orderQty", new_quantity);
-    cJSON_AddNumberToObject(json, "price", new_price);
+    result = ninja_parse_order(response_json, order);
+    cJSON_Delete(response_json);
+    ninja_trace_span(ninja_trace_active(), NINJA_SPAN_PARSE, trace_start);
 
-    char* json_string = cJSON_Print(json);
-    cJSON_Delete(json);
+    if (result == NINJA_OK && order->order_id != 0) {
+        ninja_mutex_lock(&client->lock);
+        ninja_track_order(client, order);
+        ninja_shm_commit(&client->shm);
+        ninja_mutex_unlock(&client->lock);
+    }
+
+    return result;
+}
 
+ninja_error_t ninja_place_order_request(ninja_client_t* client,
+                                       const ninja_order_request_t* request,
+                                       ninja_order_t* order_out) {
+    if (!client || !request || !order_out) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Every phase of the placement records into one trace
+    uint64_t previous_trace = ninja_trace_enter(ninja_trace_begin());
+
+    char* json_string = NULL;
+    uint64_t sequence = 0;
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE];
+    ninja_error_t result = ninja_begin_place(client, request, &json_string, &sequence, client_order_id);
+    if (result == NINJA_OK) {
+        // Make HTTP request
+        ninja_http_response_t response;
+        result = ninja_http_post(client, "order/placeorder", json_string, &response);
+        free(json_string);
+
+        result = ninja_end_place(client, sequence, client_order_id, result, &response, order_out);
+    }
+
+    ninja_trace_enter(previous_trace);
+    return result;
+}
+
+ninja_error_t ninja_cancel_order(ninja_client_t* client, ninja_order_id_t order_id) {
+    if (!client || order_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    uint64_t previous_trace = ninja_trace_enter(ninja_trace_begin());
+
+    char* json_string = NULL;
+    uint64_t sequence = 0;
+    ninja_error_t result = ninja_begin_cancel(client, order_id, &json_string, &sequence);
+    if (result == NINJA_OK) {
+        // Make HTTP request
+        ninja_http_response_t response;
+        result = ninja_http_post_idempotent(client, "order/cancelorder", json_string, &response);
+        free(json_string);
+
+        result = ninja_end_cancel(client, order_id, sequence, result, &response);
+    }
+
+    ninja_trace_enter(previous_trace);
+    return result;
+}
+
+ninja_error_t ninja_run_order_ops(ninja_client_t* client, ninja_order_op_t* ops, size_t count) {
+    if (!client || (!ops && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_http_request_t* requests = calloc(count + 1, sizeof(ninja_http_request_t));
+    char** bodies = calloc(count + 1, sizeof(char*));
+    char (*endpoints)[48] = calloc(count + 1, sizeof(*endpoints));
+    uint64_t* sequences = calloc(count + 1, sizeof(uint64_t));
+    char (*keys)[NINJA_CLIENT_ORDER_ID_SIZE] = calloc(count + 1, sizeof(*keys));
+    if (!requests || !bodies || !endpoints || !sequences || !keys) {
+        free(requests);
+        free(bodies);
+        free(endpoints);
+        free(sequences);
+        free(keys);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    // Everything is encoded and journaled before the first stream opens. Each
+    // op is its own trace; the thread's trace follows the op being worked on.
+    uint64_t previous_trace = ninja_trace_active();
+    for (size_t i = 0; i < count; i++) {
+        ninja_order_op_t* op = &ops[i];
+        ninja_http_request_t* request = &requests[i];
+        if (!op->trace_id) {
+            op->trace_id = ninja_trace_begin();
+        }
+        request->trace_id = op->trace_id;
+        ninja_trace_enter(op->trace_id);
+
+        switch (op->kind) {
+            case NINJA_REQUEST_PLACE_ORDER:
+                op->result = op->order ? ninja_begin_place(client, op->request, &bodies[i], &sequences[i], keys[i])
+                                       : NINJA_ERROR_INVALID_PARAM;
+                request->endpoint = "order/placeorder";
+                request->weight = NINJA_STREAM_WEIGHT_ORDER;
+                break;
+            case NINJA_REQUEST_CANCEL_ORDER:
+                op->result = ninja_begin_cancel(client, op->order_id, &bodies[i], &sequences[i]);
+                request->endpoint = "order/cancelorder";
+                request->weight = NINJA_STREAM_WEIGHT_CANCEL;
+                request->idempotent = true;
+                break;
+            case NINJA_REQUEST_GET_ORDER:
+                op->result = op->order && op->order_id > 0 ? NINJA_OK : NINJA_ERROR_INVALID_PARAM;
+                snprintf(endpoints[i], sizeof(endpoints[i]), "order/item?id=%lld", (long long)op->order_id);
+                request->endpoint = endpoints[i];
+                request->weight = NINJA_STREAM_WEIGHT_QUERY;
+                break;
+            default:
+                op->result = NINJA_ERROR_INVALID_PARAM;
+                break;
+        }
+
+        request->body = bodies[i];
+        if (op->result != NINJA_OK) {
+            request->endpoint = NULL;
+        }
+    }
+
+    ninja_error_t result = ninja_http_perform_many(client, requests, count);
+
+    for (size_t i = 0; i < count; i++) {
+        ninja_order_op_t* op = &ops[i];
+        ninja_http_request_t* request = &requests[i];
+        if (!request->endpoint) {
+            continue;
+        }
+
+        // Nothing of a batch that could not run was sent: its intents are
+        // settled and its placements refused rather than left pending
+        if (result != NINJA_OK) {
+            op->result = result;
+            ninja_mutex_lock(&client->lock);
+            ninja_journal_log_completion(&client->journal, NINJA_JOURNAL_REJECT, sequences[i], 0);
+            ninja_mutex_unlock(&client->lock);
+            if (op->kind == NINJA_REQUEST_PLACE_ORDER) {
+                ninja_reject_client_order(client, keys[i], ninja_error_string(result));
+            }
+            continue;
+        }
+
+        ninja_trace_enter(op->trace_id);
+        switch (op->kind) {
+            case NINJA_REQUEST_PLACE_ORDER:
+                op->result = ninja_end_place(client, sequences[i], keys[i], request->result,
+                                             &request->response, op->order);
+                break;
+            case NINJA_REQUEST_CANCEL_ORDER:
+                op->result = ninja_end_cancel(client, op->order_id, sequences[i], request->result, &request->response);
+                break;
+            default:
+                op->result = ninja_end_query(client, request->result, &request->response, op->order);
+                break;
+        }
+    }
+
+    ninja_trace_enter(previous_trace);
+
+    for (size_t i = 0; i < count; i++) {
+        free(bodies[i]);
+    }
+    free(requests);
+    free(bodies);
+    free(endpoints);
+    free(sequences);
+    free(keys);
+
+    return result;
+}
+
+ninja_error_t ninja_place_orders(ninja_client_t* client,
+                                const ninja_order_request_t* requests,
+                                size_t count,
+                                ninja_order_t* orders,
+                                ninja_error_t* results) {
+    if (!client || !requests || !orders || !results || count == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_order_op_t* ops = calloc(count, sizeof(ninja_order_op_t));
+    if (!ops) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        memset(&orders[i], 0, sizeof(ninja_order_t));
+        ops[i].kind = NINJA_REQUEST_PLACE_ORDER;
+        ops[i].request = &requests[i];
+        ops[i].order = &orders[i];
+    }
+
+    ninja_error_t result = ninja_run_order_ops(client, ops, count);
+    for (size_t i = 0; i < count; i++) {
+        results[i] = ops[i].result;
+        if (result == NINJA_OK && results[i] != NINJA_OK) {
+            result = results[i];
+        }
+    }
+
+    free(ops);
+    return result;
+}
+
+ninja_error_t ninja_cancel_orders(ninja_client_t* client,
+                                 const ninja_order_id_t* order_ids,
+                                 size_t count,
+                                 ninja_error_t* results) {
+    if (!client || !order_ids || !results || count == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_order_op_t* ops = calloc(count, sizeof(ninja_order_op_t));
+    if (!ops) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        ops[i].kind = NINJA_REQUEST_CANCEL_ORDER;
+        ops[i].order_id = order_ids[i];
+    }
+
+    ninja_error_t result = ninja_run_order_ops(client, ops, count);
+    for (size_t i = 0; i < count; i++) {
+        results[i] = ops[i].result;
+        if (result == NINJA_OK && results[i] != NINJA_OK) {
+            result = results[i];
+        }
+    }
+
+    free(ops);
+    return result;
+}
+
+ninja_error_t ninja_modify_order(ninja_client_t* client,
+                                ninja_order_id_t order_id,
+                                int new_quantity,
+                                double new_price) {
+    if (!client || order_id <= 0 || new_quantity <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    uint64_t trace_id = ninja_trace_begin();
+    uint64_t trace_start = ninja_trace_start(trace_id);
+
+    // Create JSON request body
+    char* json_string = ninja_modify_request_body(order_id, new_quantity, new_price);
     if (!json_string) {
         return NINJA_ERROR_JSON_PARSE;
     }
+    ninja_trace_span(trace_id, NINJA_SPAN_SERIALIZE, trace_start);
 
     // Make HTTP request
+    uint64_t previous_trace = ninja_trace_enter(trace_id);
     ninja_http_response_t response;
-    ninja_error_t result = ninja_http_post(client, "order/modifyorder", json_string, &response);
+    ninja_error_t result = ninja_http_post_idempotent(client, "order/modifyorder", json_string, &response);
     free(json_string);
     ninja_http_response_free(&response);
+    ninja_trace_enter(previous_trace);
 
     return result;
 }
 
+// Helper function to key orders for delta sync
+static uint64_t ninja_order_key(const void* record) {
+    return (uint64_t)((const ninja_order_t*)record)->order_id;
+}
+
+// Helper function to adapt ninja_parse_orders to ninja_list_sync
+static ninja_error_t ninja_parse_order_list(const char* json, size_t length, void** records, size_t* count) {
+    ninja_order_t* orders = NULL;
+    ninja_error_t result = ninja_parse_orders(json, length, &orders, count);
+    *records = orders;
+    return result;
+}
+
+// Helper function to fetch order/list and track the orders that changed
+static ninja_error_t ninja_fetch_order_list(ninja_client_t* client,
+                                           ninja_order_t** orders,
+                                           size_t* count,
+                                           ninja_list_delta_t* delta) {
+    void* records = NULL;
+    ninja_error_t result = ninja_list_sync(client, &client->order_list, "order/list",
+                                           ninja_parse_order_list, sizeof(ninja_order_t), ninja_order_key,
+                                           orders ? &records : NULL, count, delta);
+    if (orders) {
+        *orders = records;
+    }
+
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    // Only added and changed orders can move the local order map
+    const ninja_order_t* updated = delta->records;
+    if (delta->added + delta->changed > 0) {
+        ninja_mutex_lock(&client->lock);
+        for (size_t i = 0; i < delta->added + delta->changed; i++) {
+            if (updated[i].order_id != 0) {
+                ninja_track_order(client, &updated[i]);
+            }
+        }
+        ninja_shm_commit(&client->shm);
+        ninja_mutex_unlock(&client->lock);
+    }
+
+    return NINJA_OK;
+}
+
 ninja_error_t ninja_get_orders(ninja_client_t* client,
                               ninja_order_t** orders,
                               size_t* count) {
@@ -286,65 +893,88 @@ ninja_error_t ninja_get_orders(ninja_client_t* client,
     *orders = NULL;
     *count = 0;
 
-    // Make HTTP request
-    ninja_http_response_t response;
-    ninja_error_t result = ninja_http_get(client, "order/list", &response);
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_fetch_order_list(client, orders, count, &changes);
+    free(changes.records);
 
-    if (result != NINJA_OK) {
-        return result;
+    return result;
+}
+
+ninja_error_t ninja_sync_orders(ninja_client_t* client, ninja_order_delta_t* delta) {
+    if (!client || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
-    ninja_http_response_free(&response);
+    memset(delta, 0, sizeof(ninja_order_delta_t));
 
-    if (!response_json) {
-        return NINJA_ERROR_JSON_PARSE;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_fetch_order_list(client, NULL, NULL, &changes);
+    if (result == NINJA_OK) {
+        delta->records = changes.records;
+        delta->added = changes.added;
+        delta->changed = changes.changed;
+        delta->removed = changes.removed;
     }
 
-    if (!cJSON_IsArray(response_json)) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_JSON_PARSE;
-    }
+    return result;
+}
 
-    size_t order_count = cJSON_GetArraySize(response_json);
-    if (order_count == 0) {
-        cJSON_Delete(response_json);
-        return NINJA_OK;
+ninja_error_t ninja_diff_orders(const ninja_order_t* previous,
+                               size_t previous_count,
+                               const ninja_order_t* current,
+                               size_t current_count,
+                               ninja_order_delta_t* delta) {
+    if ((!previous && previous_count > 0) || (!current && current_count > 0) || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Allocate memory for orders
-    ninja_order_t* order_array = calloc(order_count, sizeof(ninja_order_t));
-    if (!order_array) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_MEMORY;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_delta_compare(previous, previous_count, current, current_count,
+                                               sizeof(ninja_order_t), ninja_order_key, &changes);
+    delta->records = changes.records;
+    delta->added = changes.added;
+    delta->changed = changes.changed;
+    delta->removed = changes.removed;
+
+    return result;
+}
+
+ninja_error_t ninja_parse_orders(const char* json,
+                                size_t length,
+                                ninja_order_t** orders,
+                                size_t* count) {
+    if (!json || !orders || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Parse each order
-    for (size_t i = 0; i < order_count; i++) {
-        cJSON* order_json = cJSON_GetArrayItem(response_json, i);
-        if (order_json) {
-            ninja_parse_order(order_json, &order_array[i]);
-        }
+    *orders = NULL;
+    *count = 0;
+
+    cJSON* response_json = cJSON_ParseWithLength(json, length);
+    if (!response_json) {
+        return NINJA_ERROR_JSON_PARSE;
     }
 
+    // Decode every order in one pass over the array
+    void* order_array = NULL;
+    ninja_error_t result = ninja_schema_decode_array(ninja_order_fields, NINJA_SCHEMA_COUNT(ninja_order_fields),
+                                                     response_json, sizeof(ninja_order_t), NULL,
+                                                     &order_array, count);
     cJSON_Delete(response_json);
 
     *orders = order_array;
-    *count = order_count;
-
-    return NINJA_OK;
+    return result;
 }
 
 ninja_error_t ninja_get_order_by_id(ninja_client_t* client,
-                                   const char* order_id,
+                                   ninja_order_id_t order_id,
                                    ninja_order_t* order) {
-    if (!client || !order_id || !order) {
+    if (!client || order_id <= 0 || !order) {
         return NINJA_ERROR_INVALID_PARAM;
     }
 
     char endpoint[256];
-    snprintf(endpoint, sizeof(endpoint), "order/item?id=%s", order_id);
+    snprintf(endpoint, sizeof(endpoint), "order/item?id=%lld", (long long)order_id);
 
     // Make HTTP request
     ninja_http_response_t response;
@@ -365,5 +995,187 @@ ninja_error_t ninja_get_order_by_id(ninja_client_t* client,
     result = ninja_parse_order(response_json, order);
     cJSON_Delete(response_json);
 
+    if (result == NINJA_OK && order->order_id != 0) {
+        ninja_mutex_lock(&client->lock);
+        ninja_track_order(client, order);
+        ninja_shm_commit(&client->shm);
+        ninja_mutex_unlock(&client->lock);
+    }
+
+    return result;
+}
+
+ninja_error_t ninja_lookup_client_order(ninja_client_t* client,
+                                       const char* client_order_id,
+                                       ninja_order_t* order) {
+    if (!client || !client_order_id || client_order_id[0] == '\0' || !order) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_mutex_lock(&client->lock);
+    const ninja_order_t* cached = ninja_client_order_get(client, client_order_id);
+    if (cached) {
+        *order = *cached;
+    }
+    ninja_mutex_unlock(&client->lock);
+
+    return cached ? NINJA_OK : NINJA_ERROR_NOT_FOUND;
+}
+
+ninja_error_t ninja_lookup_order(ninja_client_t* client,
+                                ninja_order_id_t order_id,
+                                ninja_order_t* order) {
+    if (!client || order_id <= 0 || !order) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_mutex_lock(&client->lock);
+    const ninja_order_t* cached = ninja_order_map_get(&client->order_map, order_id);
+    if (cached) {
+        *order = *cached;
+    }
+    ninja_mutex_unlock(&client->lock);
+
+    return cached ? NINJA_OK : NINJA_ERROR_NOT_FOUND;
+}
+
+ninja_error_t ninja_recover_orders(ninja_client_t* client,
+                                  ninja_recovered_order_t** orders,
+                                  size_t* count) {
+    if (!client || !orders || !count || !client->journal.records) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *orders = NULL;
+    *count = 0;
+
+    ninja_journal_record_t* pending = NULL;
+    size_t pending_count = 0;
+    ninja_mutex_lock(&client->lock);
+    ninja_error_t result = ninja_journal_open_requests(&client->journal, &pending, &pending_count);
+    ninja_mutex_unlock(&client->lock);
+    if (result != NINJA_OK || pending_count == 0) {
+        return result;
+    }
+
+    // Placements are found by their clOrdId, the same way a lost answer is
+    cJSON* commands = NULL;
+    for (size_t i = 0; i < pending_count && !commands; i++) {
+        if (pending[i].kind == NINJA_JOURNAL_PLACE) {
+            result = ninja_fetch_commands(client, &commands);
+            if (result != NINJA_OK) {
+                free(pending);
+                return result;
+            }
+        }
+    }
+
+    // One query covers every account with a request in flight
+    char endpoint[448];
+    int length = snprintf(endpoint, sizeof(endpoint), "order/ldeps?masterids=");
+    size_t account_count = 0;
+    for (size_t i = 0; i < pending_count; i++) {
+        int account_id = pending[i].account_id;
+        bool listed = account_id <= 0;
+        for (size_t j = 0; j < i && !listed; j++) {
+            listed = pending[j].account_id == account_id;
+        }
+        if (!listed && length < (int)sizeof(endpoint) - 12) {
+            length += snprintf(endpoint + length, sizeof(endpoint) - length, account_count > 0 ? ",%d" : "%d", account_id);
+            account_count++;
+        }
+    }
+
+    ninja_http_response_t response;
+    result = ninja_http_get(client, account_count > 0 ? endpoint : "order/list", &response);
+    if (result != NINJA_OK) {
+        ninja_http_response_free(&response);
+        cJSON_Delete(commands);
+        free(pending);
+        return result;
+    }
+
+    ninja_order_t* broker_orders = NULL;
+    size_t broker_count = 0;
+    result = ninja_parse_orders(response.data, response.size, &broker_orders, &broker_count);
+    ninja_http_response_free(&response);
+    if (result != NINJA_OK) {
+        cJSON_Delete(commands);
+        free(pending);
+        return result;
+    }
+
+    ninja_recovered_order_t* recovered = calloc(pending_count, sizeof(ninja_recovered_order_t));
+    if (!recovered) {
+        cJSON_Delete(commands);
+        free(broker_orders);
+        free(pending);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ninja_mutex_lock(&client->lock);
+    for (size_t i = 0; i < pending_count; i++) {
+        const ninja_journal_record_t* intent = &pending[i];
+        ninja_recovered_order_t* entry = &recovered[i];
+
+        memcpy(entry->request.account_spec, intent->account_spec, sizeof(entry->request.account_spec));
+        memcpy(entry->request.symbol, intent->symbol, sizeof(entry->request.symbol));
+        memcpy(entry->request.client_order_id, intent->client_order_id, sizeof(entry->request.client_order_id));
+        entry->request.client_order_id[sizeof(entry->request.client_order_id) - 1] = '\0';
+        entry->request.account_id = intent->account_id;
+        entry->request.side = (ninja_order_side_t)intent->side;
+        entry->request.type = (ninja_order_type_t)intent->type;
+        entry->request.quantity = intent->quantity;
+        entry->request.price = intent->price;
+        entry->request.stop_price = intent->stop_price;
+        entry->request.is_automated = intent->is_automated;
+        entry->is_cancel = intent->kind == NINJA_JOURNAL_CANCEL;
+        entry->order_id = entry->is_cancel ? intent->order_id
+                                           : ninja_command_order_id(commands, entry->request.client_order_id);
+
+        // Cancels name their order; placements are known once the broker has their clOrdId
+        bool found = !entry->is_cancel && entry->order_id > 0;
+        for (size_t j = 0; j < broker_count; j++) {
+            if (entry->order_id != 0 && broker_orders[j].order_id == entry->order_id) {
+                memcpy(broker_orders[j].client_order_id, entry->request.client_order_id,
+                       sizeof(broker_orders[j].client_order_id));
+                entry->order = broker_orders[j];
+                found = true;
+                break;
+            }
+        }
+
+        // The outcome is now known, so the request is not reported again
+        ninja_journal_log_completion(&client->journal, found ? NINJA_JOURNAL_ACK : NINJA_JOURNAL_LOST,
+                                     intent->sequence, entry->order_id);
+    }
+
+    // The query returned current broker state; keep the local order map in step
+    for (size_t j = 0; j < broker_count; j++) {
+        if (broker_orders[j].order_id != 0) {
+            ninja_track_order(client, &broker_orders[j]);
+        }
+    }
+    ninja_shm_commit(&client->shm);
+    ninja_mutex_unlock(&client->lock);
+
+    cJSON_Delete(commands);
+    free(broker_orders);
+    free(pending);
+
+    *orders = recovered;
+    *count = pending_count;
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_sync_journal(ninja_client_t* client) {
+    if (!client || !client->journal.records) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_mutex_lock(&client->lock);
+    ninja_error_t result = ninja_journal_sync(&client->journal);
+    ninja_mutex_unlock(&client->lock);
+
     return result;
-}
\ No newline at end of file
+}
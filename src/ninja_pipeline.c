@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_pipeline.h"
+#include "ninja_client.h"
+#include "ninja_io.h"
+#include "ninja_trace.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Longest wait for socket activity before curl's timers are serviced again
+#define NINJA_PIPELINE_POLL_MS 100
+
+ninja_error_t ninja_pipeline_init(ninja_pipeline_t* pipeline, long max_connections) {
+    if (!pipeline) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(pipeline, 0, sizeof(ninja_pipeline_t));
+    pipeline->multi = curl_multi_init();
+    if (!pipeline->multi) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    pipeline->max_connections = max_connections > 0 ? max_connections : 1;
+    curl_multi_setopt(pipeline->multi, CURLMOPT_PIPELINING, (long)CURLPIPE_MULTIPLEX);
+    curl_multi_setopt(pipeline->multi, CURLMOPT_MAX_HOST_CONNECTIONS, pipeline->max_connections);
+
+    return NINJA_OK;
+}
+
+void ninja_pipeline_free(ninja_pipeline_t* pipeline) {
+    if (!pipeline) {
+        return;
+    }
+
+    for (size_t i = 0; i < pipeline->handle_count; i++) {
+        curl_easy_cleanup(pipeline->handles[i]);
+    }
+    free(pipeline->handles);
+
+    if (pipeline->multi) {
+        curl_multi_cleanup(pipeline->multi);
+    }
+    memset(pipeline, 0, sizeof(ninja_pipeline_t));
+}
+
+// Helper function to grow the handle pool, cloning the client's configured handle
+static ninja_error_t ninja_pipeline_reserve(ninja_pipeline_t* pipeline, CURL* prototype, size_t count) {
+    if (count <= pipeline->handle_count) {
+        return NINJA_OK;
+    }
+
+    CURL** handles = realloc(pipeline->handles, count * sizeof(CURL*));
+    if (!handles) {
+        return NINJA_ERROR_MEMORY;
+    }
+    pipeline->handles = handles;
+
+    while (pipeline->handle_count < count) {
+        CURL* handle = curl_easy_duphandle(prototype);
+        if (!handle) {
+            return NINJA_ERROR_MEMORY;
+        }
+
+        // Wait for the connection in progress to report multiplexing rather
+        // than opening a new one per stream
+        curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+        pipeline->handles[pipeline->handle_count++] = handle;
+    }
+
+    return NINJA_OK;
+}
+
+// Helper function to pick the calling thread's pipeline, creating it on first use
+static ninja_pipeline_t* ninja_pipeline_for_thread(ninja_client_t* client, CURL** prototype) {
+    ninja_pipeline_t* pipeline = &client->pipeline;
+    *prototype = client->curl;
+    if (client->io && ninja_thread_is_current(&client->io->thread)) {
+        pipeline = &client->io->pipeline;
+        *prototype = client->io->curl;
+    }
+
+    if (!pipeline->multi && ninja_pipeline_init(pipeline, client->http_connections) != NINJA_OK) {
+        return NULL;
+    }
+    return pipeline;
+}
+
+// Helper function to set up a pooled handle for one request
+static void ninja_pipeline_prepare(ninja_client_t* client,
+                                   CURL* handle,
+                                   ninja_http_request_t* request,
+                                   struct curl_slist* headers) {
+    request->response.data = malloc(1);
+    request->response.size = 0;
+    request->response.capacity = 1;
+    request->response.status_code = 0;
+    request->result = NINJA_ERROR_CONNECTION;
+    if (!request->trace_id) {
+        request->trace_id = ninja_trace_begin();
+    }
+    request->trace_start = ninja_trace_start(request->trace_id);
+
+    char url[512];
+    if (request->url) {
+        snprintf(url, sizeof(url), "%s", request->url);
+    } else {
+        snprintf(url, sizeof(url), "%s/%s", client->base_url, request->endpoint);
+    }
+
+    int weight = request->weight;
+    curl_easy_setopt(handle, CURLOPT_URL, url);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &request->response);
+    curl_easy_setopt(handle, CURLOPT_HTTPHEADER, request->headers ? request->headers : headers);
+    curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, NULL);
+    curl_easy_setopt(handle, CURLOPT_PRIVATE, request);
+    curl_easy_setopt(handle, CURLOPT_STREAM_WEIGHT, (long)(weight > 0 ? weight : NINJA_STREAM_WEIGHT_QUERY));
+    if (request->body) {
+        curl_easy_setopt(handle, CURLOPT_POST, 1L);
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDS, request->body);
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, (long)strlen(request->body));
+    } else {
+        curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+    }
+}
+
+// Helper function to settle a finished transfer; returns its request
+static ninja_http_request_t* ninja_pipeline_complete(ninja_client_t* client, CURLMsg* message) {
+    ninja_http_request_t* request = NULL;
+    curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, (char**)&request);
+    if (request) {
+        ninja_trace_transfer(request->trace_id, message->easy_handle, request->trace_start);
+    }
+    if (request && message->data.result == CURLE_OK) {
+        curl_easy_getinfo(message->easy_handle, CURLINFO_RESPONSE_CODE, &request->response.status_code);
+        ninja_http_record_transfer(client, message->easy_handle, &request->response);
+        request->result = request->response.status_code >= 400 ? NINJA_ERROR_HTTP : NINJA_OK;
+    }
+
+    if (request && client->debug_log) {
+        curl_off_t total_us = 0;
+        curl_easy_getinfo(message->easy_handle, CURLINFO_TOTAL_TIME_T, &total_us);
+        const char* target = request->url ? request->url : request->endpoint;
+        char method = request->body ? 'P' : 'G';
+        if (message->data.result != CURLE_OK) {
+            ninja_log_http(client->debug_log, NINJA_LOG_TRANSPORT, method, target, 0,
+                           message->data.result, (int64_t)total_us * 1000, request->attempts + 1);
+        } else {
+            ninja_log_http(client->debug_log, NINJA_LOG_RESPONSE, method, target, request->response.status_code,
+                           (int64_t)request->response.size, (int64_t)total_us * 1000, request->attempts + 1);
+        }
+    }
+    return request;
+}
+
+// Helper function to decide whether a settled transfer is sent again, as
+// ninja_http_perform would: a request that may have reached the server is
+// only resent when repeating it is harmless. A retried request's response
+// is discarded and retry_at_ns set from the jittered backoff.
+static bool ninja_pipeline_retry(ninja_client_t* client, CURLMsg* message, ninja_http_request_t* request) {
+    CURLcode code = message->data.result;
+    long status_code = code == CURLE_OK ? request->response.status_code : 0;
+    bool idempotent = !request->body || request->idempotent;
+
+    bool retry = code != CURLE_OK || status_code >= 400;
+    retry = retry && (idempotent ? ninja_retry_transient(code, status_code) : ninja_retry_unsent(code));
+    if (!retry || request->attempts >= client->retry.retries) {
+        return false;
+    }
+
+    ninja_log_http(client->debug_log, NINJA_LOG_RETRY, request->body ? 'P' : 'G',
+                   request->url ? request->url : request->endpoint, status_code, code, 0, request->attempts + 1);
+    long backoff_ms = ninja_retry_backoff_ms(&client->retry, request->attempts);
+    request->attempts++;
+    request->retry_at_ns = ninja_monotonic_ns() + (int64_t)backoff_ms * 1000000;
+    ninja_http_response_free(&request->response);
+    return true;
+}
+
+// Helper function to send again the waiting handles whose backoff is over;
+// returns how long to wait for the next one, at most NINJA_PIPELINE_POLL_MS
+static long ninja_pipeline_resume(ninja_client_t* client,
+                                  ninja_pipeline_t* pipeline,
+                                  CURL** waiting,
+                                  size_t* waiting_count,
+                                  struct curl_slist* headers) {
+    long wait_ms = NINJA_PIPELINE_POLL_MS;
+    int64_t now_ns = ninja_monotonic_ns();
+    size_t i = 0;
+    while (i < *waiting_count) {
+        CURL* handle = waiting[i];
+        ninja_http_request_t* request = NULL;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, (char**)&request);
+
+        if (request->retry_at_ns > now_ns) {
+            long remaining_ms = (long)((request->retry_at_ns - now_ns + 999999) / 1000000);
+            if (remaining_ms < wait_ms) {
+                wait_ms = remaining_ms;
+            }
+            i++;
+            continue;
+        }
+
+        ninja_pipeline_prepare(client, handle, request, headers);
+        curl_multi_add_handle(pipeline->multi, handle);
+        waiting[i] = waiting[--*waiting_count];
+    }
+
+    return wait_ms;
+}
+
+ninja_error_t ninja_http_perform_many(ninja_client_t* client,
+                                     ninja_http_request_t* requests,
+                                     size_t count) {
+    if (!client || (!requests && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    CURL* prototype = NULL;
+    ninja_pipeline_t* pipeline = ninja_pipeline_for_thread(client, &prototype);
+    if (!pipeline || ninja_pipeline_reserve(pipeline, prototype, count) != NINJA_OK) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    CURL** waiting = malloc((count + 1) * sizeof(CURL*));
+    if (!waiting) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    struct curl_slist* headers = NULL;
+    ninja_http_connection(client, &headers);
+
+    // Highest weight first, so the first streams opened are the most urgent
+    size_t active = 0;
+    for (int pass = 0; pass < 3; pass++) {
+        for (size_t i = 0; i < count; i++) {
+            ninja_http_request_t* request = &requests[i];
+            int weight = request->weight;
+            int tier = weight >= NINJA_STREAM_WEIGHT_CANCEL ? 0 : weight >= NINJA_STREAM_WEIGHT_ORDER ? 1 : 2;
+            if ((!request->endpoint && !request->url) || tier != pass) {
+                continue;
+            }
+
+            CURL* handle = pipeline->handles[active++];
+            request->attempts = 0;
+            ninja_pipeline_prepare(client, handle, request, headers);
+            curl_multi_add_handle(pipeline->multi, handle);
+        }
+    }
+
+    // Failed transfers wait out their backoff off the multi handle, so the
+    // rest of the batch is not held up by them
+    size_t unsettled = active;
+    size_t waiting_count = 0;
+    while (unsettled > 0) {
+        long wait_ms = ninja_pipeline_resume(client, pipeline, waiting, &waiting_count, headers);
+
+        int running = 0;
+        if (curl_multi_perform(pipeline->multi, &running) != CURLM_OK) {
+            break;
+        }
+
+        CURLMsg* message;
+        int queued = 0;
+        bool progressed = false;
+        while ((message = curl_multi_info_read(pipeline->multi, &queued)) != NULL) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+
+            CURL* handle = message->easy_handle;
+            ninja_http_request_t* request = ninja_pipeline_complete(client, message);
+            if (request && ninja_pipeline_retry(client, message, request)) {
+                curl_multi_remove_handle(pipeline->multi, handle);
+                waiting[waiting_count++] = handle;
+            } else {
+                unsettled--;
+            }
+            progressed = true;
+        }
+
+        if (!progressed && running > 0) {
+            curl_multi_poll(pipeline->multi, NULL, 0, (int)wait_ms, NULL);
+        } else if (!progressed && waiting_count > 0) {
+            ninja_sleep_ms((int)wait_ms);
+        }
+    }
+
+    for (size_t i = 0; i < active; i++) {
+        curl_multi_remove_handle(pipeline->multi, pipeline->handles[i]);
+    }
+
+    free(waiting);
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_http_perform_window(ninja_client_t* client,
+                                       ninja_http_request_t* requests,
+                                       size_t count,
+                                       size_t window,
+                                       ninja_http_done_fn done,
+                                       void* user_data) {
+    if (!client || (!requests && count > 0) || window == 0 || !done) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    if (window > count) {
+        window = count;
+    }
+    if (window == 0) {
+        return NINJA_OK;
+    }
+
+    CURL* prototype = NULL;
+    ninja_pipeline_t* pipeline = ninja_pipeline_for_thread(client, &prototype);
+    if (!pipeline || ninja_pipeline_reserve(pipeline, prototype, window) != NINJA_OK) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    bool* finished = calloc(count, sizeof(bool));
+    CURL** idle = malloc(window * sizeof(CURL*));
+    CURL** waiting = malloc(window * sizeof(CURL*));
+    if (!finished || !idle || !waiting) {
+        free(finished);
+        free(idle);
+        free(waiting);
+        return NINJA_ERROR_MEMORY;
+    }
+    memcpy(idle, pipeline->handles, window * sizeof(CURL*));
+
+    struct curl_slist* headers = NULL;
+    ninja_http_connection(client, &headers);
+
+    ninja_error_t result = NINJA_OK;
+    size_t idle_count = window;
+    size_t first_unfinished = 0;
+    size_t next = 0;
+    size_t active = 0;
+    size_t waiting_count = 0;
+    bool stopped = false;
+    for (;;) {
+        while (!stopped && next < count && idle_count > 0) {
+            while (first_unfinished < count && finished[first_unfinished]) {
+                first_unfinished++;
+            }
+            if (next >= first_unfinished + window) {
+                break;
+            }
+
+            ninja_http_request_t* request = &requests[next];
+            finished[next] = !request->endpoint && !request->url;
+            next++;
+            if (finished[next - 1]) {
+                continue;
+            }
+
+            CURL* handle = idle[--idle_count];
+            request->attempts = 0;
+            ninja_pipeline_prepare(client, handle, request, headers);
+            curl_multi_add_handle(pipeline->multi, handle);
+            active++;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        long wait_ms = ninja_pipeline_resume(client, pipeline, waiting, &waiting_count, headers);
+
+        int running = 0;
+        if (curl_multi_perform(pipeline->multi, &running) != CURLM_OK) {
+            result = NINJA_ERROR_CONNECTION;
+            break;
+        }
+
+        CURLMsg* message;
+        int queued = 0;
+        bool progressed = false;
+        while ((message = curl_multi_info_read(pipeline->multi, &queued)) != NULL) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+
+            CURL* handle = message->easy_handle;
+            ninja_http_request_t* request = ninja_pipeline_complete(client, message);
+            bool retry = ninja_pipeline_retry(client, message, request);
+            curl_multi_remove_handle(pipeline->multi, handle);
+            progressed = true;
+            if (retry) {
+                waiting[waiting_count++] = handle;
+                continue;
+            }
+            idle[idle_count++] = handle;
+            active--;
+
+            finished[request - requests] = true;
+            if (!done(request, user_data)) {
+                stopped = true;
+            }
+            ninja_http_response_free(&request->response);
+        }
+
+        if (!progressed && running > 0) {
+            curl_multi_poll(pipeline->multi, NULL, 0, (int)wait_ms, NULL);
+        } else if (!progressed && waiting_count > 0) {
+            ninja_sleep_ms((int)wait_ms);
+        }
+    }
+
+    // Only left behind when the multi handle failed
+    for (size_t i = 0; i < next; i++) {
+        if (!finished[i]) {
+            ninja_http_response_free(&requests[i].response);
+        }
+    }
+    for (size_t i = 0; i < window; i++) {
+        curl_multi_remove_handle(pipeline->multi, pipeline->handles[i]);
+    }
+
+    free(finished);
+    free(idle);
+    free(waiting);
+    return result;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include <curl/curl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// HTTP/2 stream weights (1-256): cancels are served first when streams compete
+#define NINJA_STREAM_WEIGHT_CANCEL 256
+#define NINJA_STREAM_WEIGHT_ORDER 128
+#define NINJA_STREAM_WEIGHT_QUERY 16
+
+// One request of a concurrent batch; entries with neither endpoint nor url
+// are skipped. Failed requests are retried like single calls: GETs and
+// idempotent POSTs on transient failures, other POSTs only when they were
+// never sent.
+typedef struct {
+    const char* endpoint;
+    const char* url;            // Full URL, used instead of base_url + endpoint
+    const char* body;           // POST body, NULL for GET
+    struct curl_slist* headers; // NULL for the client's
+    int weight;
+    bool idempotent;            // POST that is harmless to repeat (cancels)
+    uint64_t trace_id;          // 0 starts a trace of its own when tracing
+    uint64_t trace_start;
+    int attempts;               // Retries made so far
+    int64_t retry_at_ns;        // Monotonic time the next attempt may start
+    ninja_http_response_t response;
+    ninja_error_t result;
+} ninja_http_request_t;
+
+// Called as each request of a windowed run finishes; false stops the run
+// once the requests in flight are done
+typedef bool (*ninja_http_done_fn)(ninja_http_request_t* request, void* user_data);
+
+// Multi handle plus pooled easy handles. Requests multiplex as streams over
+// one HTTP/2 connection; against an HTTP/1.1 server they spread over at most
+// max_connections keep-alive connections instead.
+typedef struct {
+    CURLM* multi;
+    CURL** handles;
+    size_t handle_count;
+    long max_connections;
+} ninja_pipeline_t;
+
+ninja_error_t ninja_pipeline_init(ninja_pipeline_t* pipeline, long max_connections);
+void ninja_pipeline_free(ninja_pipeline_t* pipeline);
+
+// Run every request concurrently on the calling thread's pipeline and wait
+// for all of them. Results and responses are per request; free each response.
+ninja_error_t ninja_http_perform_many(ninja_client_t* client,
+                                     ninja_http_request_t* requests,
+                                     size_t count);
+
+// Run requests in order with at most window in flight, never starting one
+// window or more past the first unfinished request, so callers that consume
+// results in order buffer at most window of them. done runs on the calling
+// thread for each request; its response is freed when done returns.
+ninja_error_t ninja_http_perform_window(ninja_client_t* client,
+                                       ninja_http_request_t* requests,
+                                       size_t count,
+                                       size_t window,
+                                       ninja_http_done_fn done,
+                                       void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
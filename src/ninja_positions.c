@@ -22,13 +22,37 @@
 
 #include "../include/ninja/ninja_api.h"
 #include "ninja_client.h"
+#include "ninja_schema.h"
 #include "cJSON.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
+// Helper function to decode contractId into ninja_position_t
+static void ninja_decode_position_contract(const cJSON* item, void* out) {
+    ninja_position_t* position = (ninja_position_t*)out;
+    if (cJSON_IsNumber(item)) {
+        position->contract_id = (int)item->valuedouble;
+
+        // We'd need to make another API call to get the symbol from contract ID
+        // For now, just store a placeholder
+        snprintf(position->symbol, sizeof(position->symbol), "CONTRACT_%d", position->contract_id);
+    }
+}
+
+// JSON schema of ninja_position_t
+static const ninja_field_t ninja_position_fields[] = {
+    NINJA_SCHEMA_FIELD(ninja_position_t, "accountId", NINJA_FIELD_INT, account_id)
+    NINJA_SCHEMA_CUSTOM("contractId", ninja_decode_position_contract)
+    NINJA_SCHEMA_TIMESTAMP(ninja_position_t, "timestamp", timestamp, timestamp_ns)
+    NINJA_SCHEMA_FIELD(ninja_position_t, "netPos", NINJA_FIELD_INT, net_position)
+    NINJA_SCHEMA_FIELD(ninja_position_t, "avgPrice", NINJA_FIELD_DOUBLE, average_price)
+    NINJA_SCHEMA_FIELD(ninja_position_t, "unrealizedPnL", NINJA_FIELD_DOUBLE, unrealized_pnl)
+    NINJA_SCHEMA_FIELD(ninja_position_t, "realizedPnL", NINJA_FIELD_DOUBLE, realized_pnl)
+};
+
 // Helper function to parse JSON position into ninja_position_t
-static ninja_error_t ninja_parse_position(cJSON* position_json, ninja_position_t* position) {
+ninja_error_t ninja_parse_position(cJSON* position_json, ninja_position_t* position) {
     if (!position_json || !position) {
         return NINJA_ERROR_INVALID_PARAM;
     }
@@ -36,46 +60,52 @@ static ninja_error_t ninja_parse_position(cJSON* position_json, ninja_position_t
     // Clear position structure
     memset(position, 0, sizeof(ninja_position_t));
 
-    // Parse position fields
-    cJSON* account_id = cJSON_GetObjectItemCaseSensitive(position_json, "accountId");
-    if (account_id && cJSON_IsNumber(account_id)) {
-        position->account_id = (int)cJSON_GetNumberValue(account_id);
-    }
-
-    cJSON* net_pos = cJSON_GetObjectItemCaseSensitive(position_json, "netPos");
-    if (net_pos && cJSON_IsNumber(net_pos)) {
-        position->net_position = (int)cJSON_GetNumberValue(net_pos);
-    }
-
-    cJSON* avg_price = cJSON_GetObjectItemCaseSensitive(position_json, "avgPrice");
-    if (avg_price && cJSON_IsNumber(avg_price)) {
-        position->average_price = cJSON_GetNumberValue(avg_price);
-    }
-
-    cJSON* unrealized_pnl = cJSON_GetObjectItemCaseSensitive(position_json, "unrealizedPnL");
-    if (unrealized_pnl && cJSON_IsNumber(unrealized_pnl)) {
-        position->unrealized_pnl = cJSON_GetNumberValue(unrealized_pnl);
-    }
+    return ninja_schema_decode(ninja_position_fields, NINJA_SCHEMA_COUNT(ninja_position_fields), position_json, position);
+}
 
-    cJSON* realized_pnl = cJSON_GetObjectItemCaseSensitive(position_json, "realizedPnL");
-    if (realized_pnl && cJSON_IsNumber(realized_pnl)) {
-        position->realized_pnl = cJSON_GetNumberValue(realized_pnl);
-    }
+// Helper function to key positions by account and contract for delta sync
+static uint64_t ninja_position_key(const void* record) {
+    const ninja_position_t* position = (const ninja_position_t*)record;
+    return ((uint64_t)(uint32_t)position->account_id << 32) | (uint32_t)position->contract_id;
+}
 
-    cJSON* timestamp = cJSON_GetObjectItemCaseSensitive(position_json, "timestamp");
-    if (timestamp && cJSON_IsString(timestamp)) {
-        strncpy(position->timestamp, cJSON_GetStringValue(timestamp), sizeof(position->timestamp) - 1);
-    }
+// Helper function to adapt ninja_parse_positions to ninja_list_sync
+static ninja_error_t ninja_parse_position_list(const char* json, size_t length, void** records, size_t* count) {
+    ninja_position_t* positions = NULL;
+    ninja_error_t result = ninja_parse_positions(json, length, &positions, count);
+    *records = positions;
+    return result;
+}
 
-    // For symbol, we need to look up the contract
-    cJSON* contract_id = cJSON_GetObjectItemCaseSensitive(position_json, "contractId");
-    if (contract_id && cJSON_IsNumber(contract_id)) {
-        // We'd need to make another API call to get the symbol from contract ID
-        // For now, just store a placeholder
-        snprintf(position->symbol, sizeof(position->symbol), "CONTRACT_%d", (int)cJSON_GetNumberValue(contract_id));
+// Helper function to fetch position/list and publish the positions that changed
+static ninja_error_t ninja_fetch_position_list(ninja_client_t* client,
+                                              ninja_position_t** positions,
+                                              size_t* count,
+                                              ninja_list_delta_t* delta) {
+    void* records = NULL;
+    ninja_error_t result = ninja_list_sync(client, &client->position_list, "position/list",
+                                           ninja_parse_position_list, sizeof(ninja_position_t), ninja_position_key,
+                                           positions ? &records : NULL, count, delta);
+    if (positions) {
+        *positions = records;
+    }
+
+    if (result == NINJA_OK && client->shm.header && delta->added + delta->changed > 0) {
+        ninja_publish_positions(client, delta->records, delta->added + delta->changed);
+    }
+
+    // Closed positions leave the segment, so readers stop seeing them
+    if (result == NINJA_OK && client->shm.header && delta->removed > 0) {
+        const ninja_position_t* removed = (const ninja_position_t*)delta->records + delta->added + delta->changed;
+        ninja_mutex_lock(&client->lock);
+        for (size_t i = 0; i < delta->removed; i++) {
+            ninja_shm_remove_position(&client->shm, &removed[i]);
+        }
+        ninja_shm_commit(&client->shm);
+        ninja_mutex_unlock(&client->lock);
     }
 
-    return NINJA_OK;
+    return result;
 }
 
 ninja_error_t ninja_get_positions(ninja_client_t* client,
@@ -88,54 +118,50 @@ ninja_error_t ninja_get_positions(ninja_client_t* client,
     *positions = NULL;
     *count = 0;
 
-    // Make HTTP request
-    ninja_http_response_t response;
-    ninja_error_t result = ninja_http_get(client, "position/list", &response);
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_fetch_position_list(client, positions, count, &changes);
+    free(changes.records);
 
-    if (result != NINJA_OK) {
-        return result;
-    }
-
-    // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
-    ninja_http_response_free(&response);
+    return result;
+}
 
-    if (!response_json) {
-        return NINJA_ERROR_JSON_PARSE;
+ninja_error_t ninja_sync_positions(ninja_client_t* client, ninja_position_delta_t* delta) {
+    if (!client || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    if (!cJSON_IsArray(response_json)) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_JSON_PARSE;
-    }
+    memset(delta, 0, sizeof(ninja_position_delta_t));
 
-    size_t position_count = cJSON_GetArraySize(response_json);
-    if (position_count == 0) {
-        cJSON_Delete(response_json);
-        return NINJA_OK;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_fetch_position_list(client, NULL, NULL, &changes);
+    if (result == NINJA_OK) {
+        delta->records = changes.records;
+        delta->added = changes.added;
+        delta->changed = changes.changed;
+        delta->removed = changes.removed;
     }
 
-    // Allocate memory for positions
-    ninja_position_t* position_array = calloc(position_count, sizeof(ninja_position_t));
-    if (!position_array) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_MEMORY;
-    }
+    return result;
+}
 
-    // Parse each position
-    for (size_t i = 0; i < position_count; i++) {
-        cJSON* position_json = cJSON_GetArrayItem(response_json, i);
-        if (position_json) {
-            ninja_parse_position(position_json, &position_array[i]);
-        }
+ninja_error_t ninja_diff_positions(const ninja_position_t* previous,
+                                  size_t previous_count,
+                                  const ninja_position_t* current,
+                                  size_t current_count,
+                                  ninja_position_delta_t* delta) {
+    if ((!previous && previous_count > 0) || (!current && current_count > 0) || !delta) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    cJSON_Delete(response_json);
-
-    *positions = position_array;
-    *count = position_count;
+    ninja_list_delta_t changes;
+    ninja_error_t result = ninja_delta_compare(previous, previous_count, current, current_count,
+                                               sizeof(ninja_position_t), ninja_position_key, &changes);
+    delta->records = changes.records;
+    delta->added = changes.added;
+    delta->changed = changes.changed;
+    delta->removed = changes.removed;
 
-    return NINJA_OK;
+    return result;
 }
 
 ninja_error_t ninja_get_positions_by_account(ninja_client_t* client,
@@ -161,43 +187,39 @@ ninja_error_t ninja_get_positions_by_account(ninja_client_t* client,
     }
 
     // Parse response
-    cJSON* response_json = cJSON_Parse(response.data);
+    result = ninja_parse_positions(response.data, response.size, positions, count);
     ninja_http_response_free(&response);
 
-    if (!response_json) {
-        return NINJA_ERROR_JSON_PARSE;
+    if (result == NINJA_OK && client->shm.header) {
+        ninja_publish_positions(client, *positions, *count);
     }
 
-    if (!cJSON_IsArray(response_json)) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_JSON_PARSE;
-    }
+    return result;
+}
 
-    size_t position_count = cJSON_GetArraySize(response_json);
-    if (position_count == 0) {
-        cJSON_Delete(response_json);
-        return NINJA_OK;
+ninja_error_t ninja_parse_positions(const char* json,
+                                   size_t length,
+                                   ninja_position_t** positions,
+                                   size_t* count) {
+    if (!json || !positions || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
     }
 
-    // Allocate memory for positions
-    ninja_position_t* position_array = calloc(position_count, sizeof(ninja_position_t));
-    if (!position_array) {
-        cJSON_Delete(response_json);
-        return NINJA_ERROR_MEMORY;
-    }
+    *positions = NULL;
+    *count = 0;
 
-    // Parse each position
-    for (size_t i = 0; i < position_count; i++) {
-        cJSON* position_json = cJSON_GetArrayItem(response_json, i);
-        if (position_json) {
-            ninja_parse_position(position_json, &position_array[i]);
-        }
+    cJSON* response_json = cJSON_ParseWithLength(json, length);
+    if (!response_json) {
+        return NINJA_ERROR_JSON_PARSE;
     }
 
+    // Decode every position in one pass over the array
+    void* position_array = NULL;
+    ninja_error_t result = ninja_schema_decode_array(ninja_position_fields, NINJA_SCHEMA_COUNT(ninja_position_fields),
+                                                     response_json, sizeof(ninja_position_t), NULL,
+                                                     &position_array, count);
     cJSON_Delete(response_json);
 
     *positions = position_array;
-    *count = position_count;
-
-    return NINJA_OK;
-}
\ No newline at end of file
+    return result;
+}
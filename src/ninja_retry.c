@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_retry.h"
+#include "ninja_client.h"
+#include "ninja_atomic.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Longest wait for socket activity before the hedge timer is checked again
+#define NINJA_HEDGE_POLL_MS 100
+
+// Hedge delay is recomputed after this many new samples
+#define NINJA_HEDGE_REFRESH 16
+
+bool ninja_retry_unsent(CURLcode code) {
+    switch (code) {
+        case CURLE_COULDNT_RESOLVE_PROXY:
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_COULDNT_CONNECT:
+        case CURLE_SSL_CONNECT_ERROR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ninja_retry_transient(CURLcode code, long status_code) {
+    switch (code) {
+        case CURLE_OK:
+            return status_code == 429 || status_code == 502 || status_code == 503 || status_code == 504;
+        case CURLE_OPERATION_TIMEDOUT:
+        case CURLE_SEND_ERROR:
+        case CURLE_RECV_ERROR:
+        case CURLE_GOT_NOTHING:
+        case CURLE_PARTIAL_FILE:
+        case CURLE_HTTP2:
+        case CURLE_HTTP2_STREAM:
+            return true;
+        default:
+            return ninja_retry_unsent(code);
+    }
+}
+
+// Helper function to mix a counter into a well-distributed 64-bit value (splitmix64)
+static uint64_t ninja_retry_mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+long ninja_retry_backoff_ms(ninja_retry_policy_t* policy, int attempt) {
+    if (!policy || policy->backoff_ms <= 0) {
+        return 0;
+    }
+
+    long ceiling = policy->backoff_ms;
+    for (int i = 0; i < attempt && ceiling < policy->backoff_max_ms; i++) {
+        ceiling *= 2;
+    }
+    if (policy->backoff_max_ms > 0 && ceiling > policy->backoff_max_ms) {
+        ceiling = policy->backoff_max_ms;
+    }
+
+    uint64_t random = ninja_retry_mix(ninja_atomic_fetch_add(&policy->jitter, 1));
+    return (long)(random % (uint64_t)(ceiling + 1));
+}
+
+ninja_error_t ninja_hedge_init(ninja_hedge_t* hedge) {
+    if (!hedge) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    if (!hedge->multi) {
+        hedge->multi = curl_multi_init();
+        if (!hedge->multi) {
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    return NINJA_OK;
+}
+
+void ninja_hedge_free(ninja_hedge_t* hedge) {
+    if (!hedge) {
+        return;
+    }
+
+    if (hedge->secondary) {
+        curl_easy_cleanup(hedge->secondary);
+        hedge->secondary = NULL;
+    }
+    if (hedge->multi) {
+        curl_multi_cleanup(hedge->multi);
+        hedge->multi = NULL;
+    }
+}
+
+// Helper function to order latencies for the percentile
+static int ninja_latency_compare(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+void ninja_hedge_record(ninja_hedge_t* hedge, int64_t elapsed_ns) {
+    if (!hedge || elapsed_ns < 0) {
+        return;
+    }
+
+    int64_t elapsed_us = elapsed_ns / 1000;
+    hedge->latency_us[hedge->samples % NINJA_HEDGE_WINDOW] = elapsed_us > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed_us;
+    hedge->samples++;
+
+    if (hedge->samples < NINJA_HEDGE_MIN_SAMPLES || hedge->samples % NINJA_HEDGE_REFRESH != 0) {
+        return;
+    }
+
+    uint32_t sorted[NINJA_HEDGE_WINDOW];
+    size_t count = hedge->samples < NINJA_HEDGE_WINDOW ? hedge->samples : NINJA_HEDGE_WINDOW;
+    memcpy(sorted, hedge->latency_us, count * sizeof(uint32_t));
+    qsort(sorted, count, sizeof(uint32_t), ninja_latency_compare);
+
+    // Rounded up to whole milliseconds, and never below one
+    uint32_t p95_us = sorted[(count * 95) / 100];
+    hedge->delay_ms = (long)(p95_us / 1000) + 1;
+}
+
+CURLcode ninja_hedge_perform(ninja_hedge_t* hedge, CURL* primary, CURL* secondary, CURL** winner) {
+    *winner = primary;
+    if (curl_multi_add_handle(hedge->multi, primary) != CURLM_OK) {
+        return CURLE_FAILED_INIT;
+    }
+
+    int64_t start_ns = ninja_monotonic_ns();
+    int launched = 1;
+    int finished = 0;
+    CURLcode code = CURLE_OK;
+    CURL* done = NULL;
+
+    while (!done) {
+        int running = 0;
+        if (curl_multi_perform(hedge->multi, &running) != CURLM_OK) {
+            code = CURLE_FAILED_INIT;
+            break;
+        }
+
+        // The first success wins; a failure only ends the request once
+        // nothing else is still in flight
+        CURLMsg* message;
+        int queued = 0;
+        while ((message = curl_multi_info_read(hedge->multi, &queued))) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            finished++;
+            if (message->data.result == CURLE_OK) {
+                done = message->easy_handle;
+                code = CURLE_OK;
+                break;
+            }
+            *winner = message->easy_handle;
+            code = message->data.result;
+        }
+        if (done || finished == launched) {
+            break;
+        }
+
+        long elapsed_ms = (long)((ninja_monotonic_ns() - start_ns) / 1000000);
+        long wait_ms = NINJA_HEDGE_POLL_MS;
+        if (launched == 1 && secondary && hedge->delay_ms > 0) {
+            if (elapsed_ms >= hedge->delay_ms) {
+                if (curl_multi_add_handle(hedge->multi, secondary) == CURLM_OK) {
+                    launched++;
+                    hedge->hedges_sent++;
+                }
+                continue;
+            }
+            if (hedge->delay_ms - elapsed_ms < wait_ms) {
+                wait_ms = hedge->delay_ms - elapsed_ms;
+            }
+        }
+
+        curl_multi_poll(hedge->multi, NULL, 0, (int)wait_ms, NULL);
+    }
+
+    if (done) {
+        *winner = done;
+        if (done == secondary) {
+            hedge->hedges_won++;
+        }
+    }
+
+    curl_multi_remove_handle(hedge->multi, primary);
+    if (launched > 1) {
+        curl_multi_remove_handle(hedge->multi, secondary);
+    }
+
+    return code;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include <curl/curl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// GET latencies kept for the hedge delay, and how many are needed before
+// the first hedge is sent
+#define NINJA_HEDGE_WINDOW 128
+#define NINJA_HEDGE_MIN_SAMPLES 32
+
+// Retry schedule: attempt n waits a uniformly random time up to
+// min(backoff_max_ms, backoff_ms * 2^n) ("full jitter"), so clients that
+// failed together do not retry together
+typedef struct {
+    int retries;
+    long backoff_ms;
+    long backoff_max_ms;
+    uint64_t jitter;            // Counter hashed into the jitter, updated atomically
+} ninja_retry_policy_t;
+
+// GET hedging: a duplicate request is sent on a second handle once the
+// primary has run past the p95 of recent GET latencies. Runs on the caller's
+// thread only.
+typedef struct {
+    bool enabled;
+    CURLM* multi;
+    CURL* secondary;
+    uint32_t latency_us[NINJA_HEDGE_WINDOW];
+    size_t samples;
+    long delay_ms;              // -1 until enough samples are in
+    uint64_t hedges_sent;
+    uint64_t hedges_won;
+} ninja_hedge_t;
+
+// The request never reached the server, so any method can be sent again
+bool ninja_retry_unsent(CURLcode code);
+
+// The failure may clear up on its own; only idempotent requests may be
+// sent again, since the server may already have acted on the first one
+bool ninja_retry_transient(CURLcode code, long status_code);
+
+// Delay before retry attempt (0-based)
+long ninja_retry_backoff_ms(ninja_retry_policy_t* policy, int attempt);
+
+ninja_error_t ninja_hedge_init(ninja_hedge_t* hedge);
+void ninja_hedge_free(ninja_hedge_t* hedge);
+
+// Record the latency of a completed GET and refresh the hedge delay
+void ninja_hedge_record(ninja_hedge_t* hedge, int64_t elapsed_ns);
+
+// Perform the prepared primary; if it is still running after the hedge delay,
+// add the prepared secondary and return with whichever completes first.
+// *winner is the handle whose result is returned.
+CURLcode ninja_hedge_perform(ninja_hedge_t* hedge, CURL* primary, CURL* secondary, CURL** winner);
+
+#ifdef __cplusplus
+}
+#endif
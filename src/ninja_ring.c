@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_ring.h"
+#include "ninja_atomic.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NINJA_RING_CACHE_LINE 64
+
+static inline uint64_t* ninja_ring_sequence(const ninja_ring_t* ring, uint64_t position) {
+    return (uint64_t*)(ring->slots + (position & ring->mask) * ring->stride);
+}
+
+ninja_error_t ninja_ring_init(ninja_ring_t* ring, size_t capacity, size_t item_size) {
+    if (!ring || capacity == 0 || item_size == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(ring, 0, sizeof(ninja_ring_t));
+
+    size_t slots = 2;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+
+    size_t stride = sizeof(uint64_t) + item_size;
+    stride = (stride + NINJA_RING_CACHE_LINE - 1) & ~(size_t)(NINJA_RING_CACHE_LINE - 1);
+
+    ring->slots = calloc(slots, stride);
+    if (!ring->slots) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    ring->stride = stride;
+    ring->item_size = item_size;
+    ring->mask = slots - 1;
+
+    // A slot is free for the producer at position p when its sequence equals p
+    for (uint64_t i = 0; i < slots; i++) {
+        *ninja_ring_sequence(ring, i) = i;
+    }
+
+    return NINJA_OK;
+}
+
+void ninja_ring_free(ninja_ring_t* ring) {
+    if (!ring) {
+        return;
+    }
+
+    free(ring->slots);
+    memset(ring, 0, sizeof(ninja_ring_t));
+}
+
+ninja_error_t ninja_ring_push(ninja_ring_t* ring, const void* item, uint64_t* position) {
+    uint64_t claimed = ninja_atomic_load_relaxed(&ring->enqueue_position);
+    uint64_t* sequence;
+
+    for (;;) {
+        sequence = ninja_ring_sequence(ring, claimed);
+        int64_t distance = (int64_t)(ninja_atomic_load_acquire(sequence) - claimed);
+        if (distance == 0) {
+            if (ninja_atomic_compare_exchange(&ring->enqueue_position, &claimed, claimed + 1)) {
+                break;
+            }
+        } else if (distance < 0) {
+            return NINJA_ERROR_MEMORY;
+        } else {
+            claimed = ninja_atomic_load_relaxed(&ring->enqueue_position);
+        }
+    }
+
+    memcpy(sequence + 1, item, ring->item_size);
+    ninja_atomic_store_release(sequence, claimed + 1);
+
+    if (position) {
+        *position = claimed;
+    }
+    return NINJA_OK;
+}
+
+bool ninja_ring_pop(ninja_ring_t* ring, void* item) {
+    uint64_t position = ring->dequeue_position;
+    uint64_t* sequence = ninja_ring_sequence(ring, position);
+    if (ninja_atomic_load_acquire(sequence) != position + 1) {
+        return false;
+    }
+
+    memcpy(item, sequence + 1, ring->item_size);
+
+    // Hand the slot back to producers one lap ahead
+    ninja_atomic_store_release(sequence, position + ring->mask + 1);
+    ring->dequeue_position = position + 1;
+    return true;
+}
+
+bool ninja_ring_empty(const ninja_ring_t* ring) {
+    uint64_t position = ring->dequeue_position;
+    return ninja_atomic_load_acquire(ninja_ring_sequence(ring, position)) != position + 1;
+}
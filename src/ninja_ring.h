@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bounded multi-producer, single-consumer ring of fixed-size items. Each slot
+// carries a sequence number (Vyukov's bounded queue), so producers claim a
+// slot with one compare-and-swap and never wait on each other or the
+// consumer. Slots are preallocated and padded to whole cache lines.
+typedef struct {
+    char* slots;
+    size_t stride;
+    size_t item_size;
+    uint64_t mask;
+    uint64_t enqueue_position;
+    char padding[64 - sizeof(uint64_t)];
+    uint64_t dequeue_position;
+} ninja_ring_t;
+
+// capacity is rounded up to a power of two
+ninja_error_t ninja_ring_init(ninja_ring_t* ring, size_t capacity, size_t item_size);
+void ninja_ring_free(ninja_ring_t* ring);
+
+// Producer side, any thread. Returns NINJA_ERROR_MEMORY when the ring is full;
+// position receives the item's ring position, unique and increasing.
+ninja_error_t ninja_ring_push(ninja_ring_t* ring, const void* item, uint64_t* position);
+
+// Consumer side, one thread only
+bool ninja_ring_pop(ninja_ring_t* ring, void* item);
+bool ninja_ring_empty(const ninja_ring_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_schema.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void ninja_schema_store(const ninja_field_t* field, const cJSON* item, char* base) {
+    switch (field->kind) {
+        case NINJA_FIELD_INT:
+            if (cJSON_IsNumber(item)) {
+                *(int*)(base + field->offset) = (int)item->valuedouble;
+            }
+            break;
+
+        case NINJA_FIELD_INT64:
+            if (cJSON_IsNumber(item)) {
+                *(int64_t*)(base + field->offset) = (int64_t)item->valuedouble;
+            }
+            break;
+
+        case NINJA_FIELD_DOUBLE:
+            if (cJSON_IsNumber(item)) {
+                *(double*)(base + field->offset) = item->valuedouble;
+            }
+            break;
+
+        case NINJA_FIELD_BOOL:
+            if (cJSON_IsBool(item)) {
+                *(bool*)(base + field->offset) = cJSON_IsTrue(item);
+            }
+            break;
+
+        case NINJA_FIELD_STRING:
+            if (cJSON_IsString(item) && item->valuestring) {
+                strncpy(base + field->offset, item->valuestring, field->size - 1);
+            }
+            break;
+
+        case NINJA_FIELD_TIMESTAMP:
+            if (cJSON_IsString(item) && item->valuestring) {
+                strncpy(base + field->offset, item->valuestring, field->size - 1);
+                ninja_parse_timestamp(item->valuestring, strlen(item->valuestring),
+                                      (int64_t*)(base + field->aux_offset));
+            }
+            break;
+
+        case NINJA_FIELD_SIDE:
+            if (cJSON_IsString(item) && item->valuestring) {
+                *(ninja_order_side_t*)(base + field->offset) =
+                    ninja_order_side_from_string(item->valuestring, strlen(item->valuestring));
+            }
+            break;
+
+        case NINJA_FIELD_ORDER_TYPE:
+            if (cJSON_IsString(item) && item->valuestring) {
+                *(ninja_order_type_t*)(base + field->offset) =
+                    ninja_order_type_from_string(item->valuestring, strlen(item->valuestring));
+            }
+            break;
+
+        case NINJA_FIELD_ORDER_STATUS:
+            if (cJSON_IsString(item) && item->valuestring) {
+                *(ninja_order_status_t*)(base + field->offset) =
+                    ninja_order_status_from_string(item->valuestring, strlen(item->valuestring));
+            }
+            break;
+
+        case NINJA_FIELD_CUSTOM:
+            field->custom(item, base);
+            break;
+    }
+}
+
+ninja_error_t ninja_schema_decode(const ninja_field_t* fields,
+                                  size_t field_count,
+                                  const cJSON* object,
+                                  void* out) {
+    if (!fields || !object || !out) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    if (!cJSON_IsObject(object)) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    // Objects of one type almost always list their keys in the same order, so
+    // each key is first tried against the field after the previous match; the
+    // common case is one comparison per member instead of a scan per field.
+    size_t cursor = 0;
+    const cJSON* item = NULL;
+    cJSON_ArrayForEach(item, object) {
+        const char* key = item->string;
+        if (!key) {
+            continue;
+        }
+
+        for (size_t probe = 0; probe < field_count; probe++) {
+            size_t index = cursor + probe;
+            if (index >= field_count) {
+                index -= field_count;
+            }
+
+            const ninja_field_t* field = &fields[index];
+            if (field->key[0] == key[0] && strcmp(field->key, key) == 0) {
+                ninja_schema_store(field, item, (char*)out);
+                cursor = index + 1 < field_count ? index + 1 : 0;
+                break;
+            }
+        }
+    }
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_schema_decode_array(const ninja_field_t* fields,
+                                        size_t field_count,
+                                        const cJSON* array,
+                                        size_t record_size,
+                                        void (*init)(void* record),
+                                        void** records,
+                                        size_t* count) {
+    if (!fields || !array || record_size == 0 || !records || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *records = NULL;
+    *count = 0;
+
+    if (!cJSON_IsArray(array)) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    size_t record_count = (size_t)cJSON_GetArraySize(array);
+    if (record_count == 0) {
+        return NINJA_OK;
+    }
+
+    char* record_array = calloc(record_count, record_size);
+    if (!record_array) {
+        return NINJA_ERROR_MEMORY;
+    }
+
+    size_t i = 0;
+    const cJSON* item = NULL;
+    cJSON_ArrayForEach(item, array) {
+        void* record = record_array + i * record_size;
+        if (init) {
+            init(record);
+        }
+        ninja_schema_decode(fields, field_count, item, record);
+        i++;
+    }
+
+    *records = record_array;
+    *count = record_count;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_schema_encode(const ninja_field_t* fields,
+                                  size_t field_count,
+                                  const void* in,
+                                  uint32_t omit_mask,
+                                  cJSON* object) {
+    if (!fields || !in || !object) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    const char* base = (const char*)in;
+    for (size_t i = 0; i < field_count; i++) {
+        if (i < 32 && (omit_mask & (1u << i))) {
+            continue;
+        }
+
+        const ninja_field_t* field = &fields[i];
+        const void* value = base + field->offset;
+        cJSON* added = NULL;
+
+        switch (field->kind) {
+            case NINJA_FIELD_INT:
+                added = cJSON_AddNumberToObject(object, field->key, *(const int*)value);
+                break;
+            case NINJA_FIELD_INT64:
+                added = cJSON_AddNumberToObject(object, field->key, (double)*(const int64_t*)value);
+                break;
+            case NINJA_FIELD_DOUBLE:
+                added = cJSON_AddNumberToObject(object, field->key, *(const double*)value);
+                break;
+            case NINJA_FIELD_BOOL:
+                added = cJSON_AddBoolToObject(object, field->key, *(const bool*)value);
+                break;
+            case NINJA_FIELD_STRING:
+            case NINJA_FIELD_TIMESTAMP:
+                added = cJSON_AddStringToObject(object, field->key, (const char*)value);
+                break;
+            case NINJA_FIELD_SIDE:
+                added = cJSON_AddStringToObject(object, field->key,
+                                                ninja_order_side_to_string(*(const ninja_order_side_t*)value));
+                break;
+            case NINJA_FIELD_ORDER_TYPE:
+                added = cJSON_AddStringToObject(object, field->key,
+                                                ninja_order_type_to_string(*(const ninja_order_type_t*)value));
+                break;
+            case NINJA_FIELD_ORDER_STATUS:
+                added = cJSON_AddStringToObject(object, field->key,
+                                                ninja_order_status_to_string(*(const ninja_order_status_t*)value));
+                break;
+            case NINJA_FIELD_CUSTOM:
+                // Custom fields are decode-only
+                continue;
+        }
+
+        if (!added) {
+            return NINJA_ERROR_MEMORY;
+        }
+    }
+
+    return NINJA_OK;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "cJSON.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Storage kind of a schema field
+typedef enum {
+    NINJA_FIELD_INT,
+    NINJA_FIELD_INT64,
+    NINJA_FIELD_DOUBLE,
+    NINJA_FIELD_BOOL,
+    NINJA_FIELD_STRING,
+    NINJA_FIELD_TIMESTAMP,      // text at offset, epoch nanoseconds at aux_offset
+    NINJA_FIELD_SIDE,
+    NINJA_FIELD_ORDER_TYPE,
+    NINJA_FIELD_ORDER_STATUS,
+    NINJA_FIELD_CUSTOM          // decoded by the field's custom callback only
+} ninja_field_kind_t;
+
+typedef void (*ninja_field_decode_fn)(const cJSON* item, void* out);
+
+// One JSON key mapped onto one struct member
+typedef struct {
+    const char* key;
+    ninja_field_kind_t kind;
+    size_t offset;
+    size_t size;
+    size_t aux_offset;
+    ninja_field_decode_fn custom;
+} ninja_field_t;
+
+// Field table entry helpers; use inside a per-struct X-macro list
+#define NINJA_SCHEMA_MEMBER_SIZE(type, member) sizeof(((type*)0)->member)
+
+#define NINJA_SCHEMA_FIELD(type, key, kind, member) \
+    { key, kind, offsetof(type, member), NINJA_SCHEMA_MEMBER_SIZE(type, member), 0, NULL },
+
+#define NINJA_SCHEMA_TIMESTAMP(type, key, text_member, ns_member) \
+    { key, NINJA_FIELD_TIMESTAMP, offsetof(type, text_member), NINJA_SCHEMA_MEMBER_SIZE(type, text_member), \
+      offsetof(type, ns_member), NULL },
+
+#define NINJA_SCHEMA_CUSTOM(key, fn) \
+    { key, NINJA_FIELD_CUSTOM, 0, 0, 0, fn },
+
+#define NINJA_SCHEMA_COUNT(fields) (sizeof(fields) / sizeof((fields)[0]))
+
+// Decode a JSON object into out in a single pass over its members.
+// Members not described by the table are ignored; out is not cleared first.
+ninja_error_t ninja_schema_decode(const ninja_field_t* fields,
+                                  size_t field_count,
+                                  const cJSON* object,
+                                  void* out);
+
+// Decode a JSON array of objects into a newly allocated record array.
+// Each record is zeroed, then passed to init (if any) before decoding.
+ninja_error_t ninja_schema_decode_array(const ninja_field_t* fields,
+                                        size_t field_count,
+                                        const cJSON* array,
+                                        size_t record_size,
+                                        void (*init)(void* record),
+                                        void** records,
+                                        size_t* count);
+
+// Encode in as members of object, skipping fields whose bit is set in omit_mask
+ninja_error_t ninja_schema_encode(const ninja_field_t* fields,
+                                  size_t field_count,
+                                  const void* in,
+                                  uint32_t omit_mask,
+                                  cJSON* object);
+
+#ifdef __cplusplus
+}
+#endif
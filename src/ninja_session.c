@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_client.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NINJA_SESSION_NONE SIZE_MAX
+#define NINJA_SESSION_RETRY_NS 60000000000LL
+#define NINJA_SECOND_NS 1000000000LL
+
+// Per-login state; moved into the shared client while the session is bound
+typedef struct {
+    bool open;
+    uint32_t generation;
+    char access_token[256];
+    char md_access_token[256];
+    int user_id;
+    struct curl_slist* headers;
+    struct curl_slist* md_headers;
+    ninja_list_cache_t order_list;
+    ninja_list_cache_t position_list;
+    ninja_list_cache_t account_list;
+    int64_t expires_at_ns;
+    int64_t renew_at_ns;
+} ninja_session_slot_t;
+
+struct ninja_session_manager {
+    ninja_client_t* client;
+    ninja_session_slot_t* slots;
+    size_t count;
+    size_t capacity;
+    uint32_t* free_slots;
+    size_t free_count;
+    size_t bound;
+    int64_t next_renewal_ns;
+    int64_t lifetime_ns;
+    int64_t renew_before_ns;
+    int64_t renew_spread_ns;
+};
+
+void ninja_session_options_init(ninja_session_options_t* options) {
+    if (!options) {
+        return;
+    }
+
+    memset(options, 0, sizeof(*options));
+    options->token_lifetime_s = 5400;
+    options->renew_before_s = 900;
+    options->renew_spread_s = 600;
+}
+
+ninja_session_manager_t* ninja_session_manager_create(const ninja_session_options_t* options) {
+    ninja_session_options_t defaults;
+    if (!options) {
+        ninja_session_options_init(&defaults);
+        options = &defaults;
+    }
+    if (options->token_lifetime_s <= 0 || options->renew_before_s < 0 || options->renew_spread_s < 0) {
+        return NULL;
+    }
+
+    // Submissions would be sent with whichever session is bound when the I/O
+    // thread gets to them, so every request runs on the caller's thread
+    ninja_client_options_t client_options;
+    if (options->client) {
+        client_options = *options->client;
+    } else {
+        ninja_client_options_init(&client_options, NINJA_ENV_DEMO);
+    }
+    client_options.io_thread = false;
+
+    ninja_session_manager_t* manager = calloc(1, sizeof(ninja_session_manager_t));
+    if (!manager) {
+        return NULL;
+    }
+
+    manager->client = ninja_client_create_with_options(&client_options);
+    if (!manager->client) {
+        free(manager);
+        return NULL;
+    }
+
+    manager->bound = NINJA_SESSION_NONE;
+    manager->next_renewal_ns = INT64_MAX;
+    manager->lifetime_ns = options->token_lifetime_s * NINJA_SECOND_NS;
+    manager->renew_before_ns = options->renew_before_s * NINJA_SECOND_NS;
+    manager->renew_spread_ns = options->renew_spread_s * NINJA_SECOND_NS;
+
+    return manager;
+}
+
+// Helper function to set the Authorization header the I/O thread rebuilds its
+// headers from to token's, or to none when token is empty
+static void ninja_session_publish_auth(ninja_client_t* client, const char* token) {
+    ninja_mutex_lock(&client->lock);
+    if (token[0] != '\0') {
+        snprintf(client->auth_header, sizeof(client->auth_header), "Authorization: Bearer %s", token);
+    } else {
+        memset(client->auth_header, 0, sizeof(client->auth_header));
+    }
+    client->auth_generation++;
+    ninja_mutex_unlock(&client->lock);
+}
+
+// Helper function to drop the identity the shared client holds
+static void ninja_session_clear_client(ninja_client_t* client) {
+    if (client->headers) {
+        curl_slist_free_all(client->headers);
+        client->headers = NULL;
+    }
+    if (client->md_headers) {
+        curl_slist_free_all(client->md_headers);
+        client->md_headers = NULL;
+    }
+    ninja_list_cache_free(&client->order_list);
+    ninja_list_cache_free(&client->position_list);
+    ninja_list_cache_free(&client->account_list);
+    memset(client->access_token, 0, sizeof(client->access_token));
+    memset(client->md_access_token, 0, sizeof(client->md_access_token));
+    ninja_session_publish_auth(client, "");
+    client->user_id = 0;
+}
+
+// Helper function to move the bound session's state from the client back to its slot
+static void ninja_session_unbind(ninja_session_manager_t* manager) {
+    if (manager->bound == NINJA_SESSION_NONE) {
+        return;
+    }
+
+    ninja_client_t* client = manager->client;
+    ninja_session_slot_t* slot = &manager->slots[manager->bound];
+    slot->user_id = client->user_id;
+    slot->headers = client->headers;
+    slot->md_headers = client->md_headers;
+    slot->order_list = client->order_list;
+    slot->position_list = client->position_list;
+    slot->account_list = client->account_list;
+
+    // Ownership moved to the slot
+    client->headers = NULL;
+    client->md_headers = NULL;
+    memset(&client->order_list, 0, sizeof(client->order_list));
+    memset(&client->position_list, 0, sizeof(client->position_list));
+    memset(&client->account_list, 0, sizeof(client->account_list));
+    ninja_session_publish_auth(client, "");
+    client->user_id = 0;
+    manager->bound = NINJA_SESSION_NONE;
+}
+
+// Helper function to move a session's state into the client; its header list
+// is handed over as built, never rebuilt. Requests only read the headers, so
+// the tokens stay in the slot except while they are renewed.
+static void ninja_session_bind(ninja_session_manager_t* manager, size_t index) {
+    if (manager->bound == index) {
+        return;
+    }
+    ninja_session_unbind(manager);
+
+    ninja_client_t* client = manager->client;
+    ninja_session_slot_t* slot = &manager->slots[index];
+    client->user_id = slot->user_id;
+    client->headers = slot->headers;
+    client->md_headers = slot->md_headers;
+    client->order_list = slot->order_list;
+    client->position_list = slot->position_list;
+    client->account_list = slot->account_list;
+    ninja_session_publish_auth(client, slot->access_token);
+
+    slot->headers = NULL;
+    slot->md_headers = NULL;
+    memset(&slot->order_list, 0, sizeof(slot->order_list));
+    memset(&slot->position_list, 0, sizeof(slot->position_list));
+    memset(&slot->account_list, 0, sizeof(slot->account_list));
+    manager->bound = index;
+}
+
+// Helper function to take the tokens the client was just given into a slot,
+// leaving none behind for another session to use. The I/O thread's header
+// follows the slot's token while it is bound and is cleared otherwise.
+static void ninja_session_store_tokens(ninja_session_manager_t* manager, size_t index) {
+    ninja_client_t* client = manager->client;
+    ninja_session_slot_t* slot = &manager->slots[index];
+    memcpy(slot->access_token, client->access_token, sizeof(slot->access_token));
+    memcpy(slot->md_access_token, client->md_access_token, sizeof(slot->md_access_token));
+    memset(client->access_token, 0, sizeof(client->access_token));
+    memset(client->md_access_token, 0, sizeof(client->md_access_token));
+    ninja_session_publish_auth(client, manager->bound == index ? slot->access_token : "");
+}
+
+// Helper function to find an open session's slot
+static size_t ninja_session_index(const ninja_session_manager_t* manager, ninja_session_id_t session) {
+    uint64_t position = session & 0xFFFFFFFFu;
+    if (position == 0 || position > manager->count) {
+        return NINJA_SESSION_NONE;
+    }
+
+    const ninja_session_slot_t* slot = &manager->slots[position - 1];
+    if (!slot->open || slot->generation != (uint32_t)(session >> 32)) {
+        return NINJA_SESSION_NONE;
+    }
+    return (size_t)(position - 1);
+}
+
+// Helper function to take a free slot, reusing closed ones first
+static ninja_error_t ninja_session_allocate(ninja_session_manager_t* manager, size_t* index) {
+    if (manager->free_count > 0) {
+        *index = manager->free_slots[--manager->free_count];
+        return NINJA_OK;
+    }
+
+    if (manager->count == manager->capacity) {
+        if (manager->capacity >= UINT32_MAX) {
+            return NINJA_ERROR_MEMORY;
+        }
+        size_t new_capacity = manager->capacity ? manager->capacity * 2 : 16;
+        ninja_session_slot_t* slots = realloc(manager->slots, new_capacity * sizeof(ninja_session_slot_t));
+        if (!slots) {
+            return NINJA_ERROR_MEMORY;
+        }
+        manager->slots = slots;
+
+        uint32_t* free_slots = realloc(manager->free_slots, new_capacity * sizeof(uint32_t));
+        if (!free_slots) {
+            return NINJA_ERROR_MEMORY;
+        }
+        manager->free_slots = free_slots;
+        manager->capacity = new_capacity;
+    }
+
+    memset(&manager->slots[manager->count], 0, sizeof(ninja_session_slot_t));
+    *index = manager->count++;
+    return NINJA_OK;
+}
+
+static ninja_session_id_t ninja_session_handle(const ninja_session_manager_t* manager, size_t index) {
+    return ((uint64_t)manager->slots[index].generation << 32) | (uint64_t)(index + 1);
+}
+
+// Helper function to schedule a session's renewal. The offset into the spread
+// window comes from a hash of the handle, so sessions opened in one burst
+// renew at evenly scattered times.
+static void ninja_session_schedule(ninja_session_manager_t* manager, size_t index, int expires_in_s) {
+    ninja_session_slot_t* slot = &manager->slots[index];
+    int64_t now = ninja_wall_clock_ns();
+    int64_t lifetime = expires_in_s > 0 ? expires_in_s * NINJA_SECOND_NS : manager->lifetime_ns;
+
+    ninja_session_id_t handle = ninja_session_handle(manager, index);
+    int64_t stagger = manager->renew_spread_ns > 0
+        ? (int64_t)(ninja_hash_bytes(&handle, sizeof(handle)) % (uint64_t)manager->renew_spread_ns)
+        : 0;
+
+    slot->expires_at_ns = now + lifetime;
+    slot->renew_at_ns = slot->expires_at_ns - manager->renew_before_ns - stagger;
+    if (slot->renew_at_ns < now) {
+        slot->renew_at_ns = now;
+    }
+    if (slot->renew_at_ns < manager->next_renewal_ns) {
+        manager->next_renewal_ns = slot->renew_at_ns;
+    }
+}
+
+// Helper function to record the session now bound to the client
+static ninja_error_t ninja_session_commit(ninja_session_manager_t* manager, int expires_in_s, ninja_session_id_t* session) {
+    size_t index;
+    ninja_error_t result = ninja_session_allocate(manager, &index);
+    if (result != NINJA_OK) {
+        ninja_session_clear_client(manager->client);
+        return result;
+    }
+
+    manager->slots[index].open = true;
+    manager->slots[index].user_id = manager->client->user_id;
+    manager->bound = index;
+    ninja_session_store_tokens(manager, index);
+    ninja_session_schedule(manager, index, expires_in_s);
+    *session = ninja_session_handle(manager, index);
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_session_open(ninja_session_manager_t* manager,
+                                const char* username,
+                                const char* password,
+                                const char* app_id,
+                                const char* app_version,
+                                ninja_session_id_t* session,
+                                ninja_auth_response_t* auth_response) {
+    if (!manager || !session || !auth_response) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *session = 0;
+
+    ninja_session_unbind(manager);
+    memset(auth_response, 0, sizeof(*auth_response));
+    ninja_error_t result = ninja_authenticate(manager->client, username, password, app_id, app_version, auth_response);
+    if (result != NINJA_OK) {
+        ninja_session_clear_client(manager->client);
+        return result;
+    }
+
+    return ninja_session_commit(manager, auth_response->expires_in, session);
+}
+
+ninja_error_t ninja_session_add(ninja_session_manager_t* manager,
+                               const ninja_auth_response_t* auth,
+                               ninja_session_id_t* session) {
+    if (!manager || !auth || !session || auth->access_token[0] == '\0') {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *session = 0;
+
+    ninja_session_unbind(manager);
+    ninja_client_t* client = manager->client;
+    snprintf(client->access_token, sizeof(client->access_token), "%s", auth->access_token);
+    snprintf(client->md_access_token, sizeof(client->md_access_token), "%s", auth->md_access_token);
+    client->user_id = auth->user_id;
+
+    ninja_error_t result = ninja_set_auth_header(client);
+    if (result != NINJA_OK || !client->headers) {
+        ninja_session_clear_client(client);
+        return result != NINJA_OK ? result : NINJA_ERROR_MEMORY;
+    }
+
+    return ninja_session_commit(manager, auth->expires_in, session);
+}
+
+ninja_error_t ninja_session_close(ninja_session_manager_t* manager, ninja_session_id_t session) {
+    if (!manager) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t index = ninja_session_index(manager, session);
+    if (index == NINJA_SESSION_NONE) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    // Bound: drop the state where it is
+    if (manager->bound == index) {
+        ninja_session_clear_client(manager->client);
+        manager->bound = NINJA_SESSION_NONE;
+    }
+
+    ninja_session_slot_t* slot = &manager->slots[index];
+    if (slot->headers) {
+        curl_slist_free_all(slot->headers);
+    }
+    if (slot->md_headers) {
+        curl_slist_free_all(slot->md_headers);
+    }
+    ninja_list_cache_free(&slot->order_list);
+    ninja_list_cache_free(&slot->position_list);
+    ninja_list_cache_free(&slot->account_list);
+
+    // A new generation invalidates handles to the old session
+    uint32_t generation = slot->generation + 1;
+    memset(slot, 0, sizeof(*slot));
+    slot->generation = generation;
+    manager->free_slots[manager->free_count++] = (uint32_t)index;
+
+    return NINJA_OK;
+}
+
+ninja_client_t* ninja_session_client(ninja_session_manager_t* manager, ninja_session_id_t session) {
+    if (!manager) {
+        return NULL;
+    }
+
+    size_t index = ninja_session_index(manager, session);
+    if (index == NINJA_SESSION_NONE) {
+        return NULL;
+    }
+
+    ninja_session_bind(manager, index);
+    return manager->client;
+}
+
+ninja_error_t ninja_session_get_info(ninja_session_manager_t* manager,
+                                    ninja_session_id_t session,
+                                    ninja_session_info_t* info) {
+    if (!manager || !info) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    size_t index = ninja_session_index(manager, session);
+    if (index == NINJA_SESSION_NONE) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    const ninja_session_slot_t* slot = &manager->slots[index];
+    info->user_id = manager->bound == index ? manager->client->user_id : slot->user_id;
+    info->expires_at_ns = slot->expires_at_ns;
+    info->renew_at_ns = slot->renew_at_ns;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_session_renew_due(ninja_session_manager_t* manager,
+                                     size_t max_renewals,
+                                     size_t* renewed) {
+    if (!manager || !renewed) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+    *renewed = 0;
+
+    // Nothing due: no scan
+    int64_t now = ninja_wall_clock_ns();
+    if (now < manager->next_renewal_ns) {
+        return NINJA_OK;
+    }
+
+    ninja_error_t first_error = NINJA_OK;
+    int64_t next_renewal = INT64_MAX;
+    for (size_t i = 0; i < manager->count; i++) {
+        ninja_session_slot_t* slot = &manager->slots[i];
+        if (!slot->open) {
+            continue;
+        }
+
+        if (slot->renew_at_ns <= now && *renewed < max_renewals) {
+            ninja_session_bind(manager, i);
+            memcpy(manager->client->access_token, slot->access_token, sizeof(slot->access_token));
+            memcpy(manager->client->md_access_token, slot->md_access_token, sizeof(slot->md_access_token));
+
+            ninja_auth_response_t auth_response;
+            memset(&auth_response, 0, sizeof(auth_response));
+            ninja_error_t result = ninja_renew_token(manager->client, &auth_response);
+            ninja_session_store_tokens(manager, i);
+            if (result == NINJA_OK) {
+                ninja_session_schedule(manager, i, auth_response.expires_in);
+                (*renewed)++;
+            } else {
+                slot->renew_at_ns = now + NINJA_SESSION_RETRY_NS;
+                if (first_error == NINJA_OK) {
+                    first_error = result;
+                }
+            }
+        }
+
+        if (slot->renew_at_ns < next_renewal) {
+            next_renewal = slot->renew_at_ns;
+        }
+    }
+    manager->next_renewal_ns = next_renewal;
+
+    return first_error;
+}
+
+void ninja_session_manager_destroy(ninja_session_manager_t* manager) {
+    if (!manager) {
+        return;
+    }
+
+    ninja_session_unbind(manager);
+    for (size_t i = 0; i < manager->count; i++) {
+        ninja_session_slot_t* slot = &manager->slots[i];
+        if (slot->headers) {
+            curl_slist_free_all(slot->headers);
+        }
+        if (slot->md_headers) {
+            curl_slist_free_all(slot->md_headers);
+        }
+        ninja_list_cache_free(&slot->order_list);
+        ninja_list_cache_free(&slot->position_list);
+        ninja_list_cache_free(&slot->account_list);
+    }
+
+    ninja_client_destroy(manager->client);
+    free(manager->slots);
+    free(manager->free_slots);
+    free(manager);
+}
@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_shm.h"
+#include "ninja_atomic.h"
+#include "ninja_client.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NINJA_SHM_CACHE_LINE 64
+
+// Reader retries before giving up on a slot whose writer never finished
+#define NINJA_SHM_MAX_RETRIES (1u << 20)
+
+typedef struct {
+    uint64_t sequence;
+    int64_t key;
+} ninja_shm_slot_t;
+
+// splitmix64 finalizer, as used by the order map
+static inline size_t ninja_shm_hash(int64_t key, size_t mask) {
+    uint64_t x = (uint64_t)key;
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return (size_t)x & mask;
+}
+
+// Helper function to size a slot to whole cache lines so slots never share one
+static size_t ninja_shm_stride(size_t record_size) {
+    size_t size = sizeof(ninja_shm_slot_t) + record_size;
+    return (size + NINJA_SHM_CACHE_LINE - 1) & ~(size_t)(NINJA_SHM_CACHE_LINE - 1);
+}
+
+// Helper function to size a table for capacity records at 50% load
+static size_t ninja_shm_slots(size_t capacity) {
+    size_t slots = 16;
+    while (slots < capacity * 2) {
+        slots <<= 1;
+    }
+    return slots;
+}
+
+static size_t ninja_shm_size(size_t position_slots, size_t order_slots) {
+    return sizeof(ninja_shm_header_t) +
+           position_slots * ninja_shm_stride(sizeof(ninja_position_t)) +
+           order_slots * ninja_shm_stride(sizeof(ninja_order_t));
+}
+
+static inline ninja_shm_slot_t* ninja_shm_slot(const ninja_shm_table_t* table, size_t index) {
+    return (ninja_shm_slot_t*)(table->slots + index * table->stride);
+}
+
+// Helper function to point both tables into the mapped segment
+static void ninja_shm_layout(ninja_shm_t* shm) {
+    ninja_shm_header_t* header = (ninja_shm_header_t*)shm->map.data;
+    shm->header = header;
+
+    shm->positions.slots = (char*)shm->map.data + sizeof(ninja_shm_header_t);
+    shm->positions.stride = ninja_shm_stride(sizeof(ninja_position_t));
+    shm->positions.capacity = header->position_capacity;
+    shm->positions.record_size = sizeof(ninja_position_t);
+    shm->positions.count = &header->position_count;
+    shm->positions.evictions = &header->evictions;
+
+    shm->orders.slots = shm->positions.slots + shm->positions.capacity * shm->positions.stride;
+    shm->orders.stride = ninja_shm_stride(sizeof(ninja_order_t));
+    shm->orders.capacity = header->order_capacity;
+    shm->orders.record_size = sizeof(ninja_order_t);
+    shm->orders.count = &header->order_count;
+    shm->orders.evictions = &header->evictions;
+}
+
+// Helper function to close the writes of a publisher that died mid-write: an
+// odd sequence would make readers retry that slot until they time out. The
+// slot's record may be torn until the new publisher writes it again.
+static void ninja_shm_repair(ninja_shm_t* shm) {
+    ninja_shm_table_t* tables[2] = { &shm->positions, &shm->orders };
+    for (size_t t = 0; t < 2; t++) {
+        for (size_t i = 0; i < tables[t]->capacity; i++) {
+            ninja_shm_slot_t* slot = ninja_shm_slot(tables[t], i);
+            if (slot->sequence & 1) {
+                ninja_atomic_store_release(&slot->sequence, slot->sequence + 1);
+            }
+        }
+    }
+
+    if (shm->header->evictions & 1) {
+        ninja_atomic_store_release(&shm->header->evictions, shm->header->evictions + 1);
+    }
+}
+
+// Helper function to check a mapped header against this build's layout
+static bool ninja_shm_valid(const ninja_shm_header_t* header, size_t size) {
+    if (size < sizeof(ninja_shm_header_t) ||
+        memcmp(header->magic, NINJA_SHM_MAGIC, sizeof(NINJA_SHM_MAGIC)) != 0 ||
+        header->version != NINJA_SHM_VERSION ||
+        header->position_size != sizeof(ninja_position_t) ||
+        header->order_size != sizeof(ninja_order_t) ||
+        header->position_capacity == 0 || (header->position_capacity & (header->position_capacity - 1)) != 0 ||
+        header->order_capacity == 0 || (header->order_capacity & (header->order_capacity - 1)) != 0) {
+        return false;
+    }
+    return size >= ninja_shm_size(header->position_capacity, header->order_capacity);
+}
+
+ninja_error_t ninja_shm_create(ninja_shm_t* shm, const char* name, size_t position_capacity, size_t order_capacity) {
+    if (!shm || !name || position_capacity == 0 || order_capacity == 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(shm, 0, sizeof(ninja_shm_t));
+    size_t position_slots = ninja_shm_slots(position_capacity);
+    size_t order_slots = ninja_shm_slots(order_capacity);
+    size_t size = ninja_shm_size(position_slots, order_slots);
+
+    ninja_error_t result = ninja_mmap_open_shared(&shm->map, name, size, true);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    ninja_shm_header_t* header = (ninja_shm_header_t*)shm->map.data;
+    if (header->magic[0] != '\0' &&
+        (!ninja_shm_valid(header, shm->map.size) ||
+         header->position_capacity != position_slots || header->order_capacity != order_slots)) {
+        // A segment from another layout; readers still mapping it keep their copy
+        ninja_mmap_close(&shm->map);
+        ninja_mmap_unlink_shared(name);
+        result = ninja_mmap_open_shared(&shm->map, name, size, true);
+        if (result != NINJA_OK) {
+            return result;
+        }
+        header = (ninja_shm_header_t*)shm->map.data;
+    }
+
+    bool reused = header->magic[0] != '\0';
+    if (!reused) {
+        header->version = NINJA_SHM_VERSION;
+        header->position_size = sizeof(ninja_position_t);
+        header->order_size = sizeof(ninja_order_t);
+        header->position_capacity = (uint32_t)position_slots;
+        header->order_capacity = (uint32_t)order_slots;
+        // Readers treat the segment as valid once the magic is visible
+        ninja_atomic_fence_release();
+        memcpy(header->magic, NINJA_SHM_MAGIC, sizeof(NINJA_SHM_MAGIC));
+    }
+
+    ninja_shm_layout(shm);
+    if (reused) {
+        ninja_shm_repair(shm);
+    }
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_shm_attach(ninja_shm_t* shm, const char* name) {
+    if (!shm || !name) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    memset(shm, 0, sizeof(ninja_shm_t));
+    ninja_error_t result = ninja_mmap_open_shared(&shm->map, name, 0, false);
+    if (result != NINJA_OK) {
+        return result;
+    }
+
+    if (!ninja_shm_valid((const ninja_shm_header_t*)shm->map.data, shm->map.size)) {
+        ninja_mmap_close(&shm->map);
+        return NINJA_ERROR_NOT_FOUND;
+    }
+    ninja_atomic_fence_acquire();
+
+    ninja_shm_layout(shm);
+    return NINJA_OK;
+}
+
+void ninja_shm_close(ninja_shm_t* shm) {
+    if (!shm) {
+        return;
+    }
+
+    ninja_mmap_close(&shm->map);
+    memset(shm, 0, sizeof(ninja_shm_t));
+}
+
+// Helper function to write one slot under its seqlock; a NULL record clears it.
+// The sequence goes to the next odd value and then the even one after it, so
+// parity stays right even if a previous writer never finished.
+static void ninja_shm_write_slot(ninja_shm_slot_t* slot, int64_t key, const void* record, size_t record_size) {
+    uint64_t sequence = ninja_atomic_load_relaxed(&slot->sequence) | 1;
+    ninja_atomic_store_relaxed(&slot->sequence, sequence);
+    ninja_atomic_fence_release();
+
+    ninja_atomic_store_relaxed((volatile uint64_t*)&slot->key, (uint64_t)key);
+    if (record) {
+        memcpy(slot + 1, record, record_size);
+    } else {
+        memset(slot + 1, 0, record_size);
+    }
+
+    ninja_atomic_store_release(&slot->sequence, sequence + 1);
+}
+
+// Helper function to insert or update the slot for key
+static ninja_error_t ninja_shm_publish(ninja_shm_table_t* table, int64_t key, const void* record) {
+    size_t mask = table->capacity - 1;
+    size_t index = ninja_shm_hash(key, mask);
+
+    for (size_t probes = 0; probes < table->capacity; probes++) {
+        ninja_shm_slot_t* slot = ninja_shm_slot(table, index);
+        if (slot->key == key) {
+            ninja_shm_write_slot(slot, key, record, table->record_size);
+            return NINJA_OK;
+        }
+        if (slot->key == 0) {
+            if (*table->count >= table->capacity / 2) {
+                return NINJA_ERROR_MEMORY;
+            }
+            ninja_shm_write_slot(slot, key, record, table->record_size);
+            *(volatile uint32_t*)table->count = *table->count + 1;
+            return NINJA_OK;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return NINJA_ERROR_MEMORY;
+}
+
+// Helper function to empty the slot at index. Later records of its probe run
+// move back into the hole, so no lookup stops early at an empty slot.
+static void ninja_shm_remove_slot(ninja_shm_table_t* table, size_t index) {
+    size_t mask = table->capacity - 1;
+    size_t next = index;
+    for (;;) {
+        next = (next + 1) & mask;
+        ninja_shm_slot_t* slot = ninja_shm_slot(table, next);
+        if (slot->key == 0) {
+            break;
+        }
+
+        // A record whose home lies after the hole, up to its own slot, stays
+        size_t home = ninja_shm_hash(slot->key, mask);
+        if (((next - home) & mask) < ((next - index) & mask)) {
+            continue;
+        }
+        ninja_shm_write_slot(ninja_shm_slot(table, index), slot->key, slot + 1, table->record_size);
+        index = next;
+    }
+
+    ninja_shm_write_slot(ninja_shm_slot(table, index), 0, NULL, table->record_size);
+    *(volatile uint32_t*)table->count = *table->count - 1;
+}
+
+// Helper function to remove every order that can no longer change; returns
+// how many were removed
+static size_t ninja_shm_evict_orders(ninja_shm_t* shm) {
+    ninja_shm_table_t* table = &shm->orders;
+    uint64_t evictions = shm->header->evictions;
+    ninja_atomic_store_relaxed(&shm->header->evictions, evictions + 1);
+    ninja_atomic_fence_release();
+
+    size_t removed = 0;
+    for (size_t i = 0; i < table->capacity;) {
+        ninja_shm_slot_t* slot = ninja_shm_slot(table, i);
+        if (slot->key != 0 && ninja_order_is_done((const ninja_order_t*)(slot + 1))) {
+            // A record shifted into this slot is checked next
+            ninja_shm_remove_slot(table, i);
+            removed++;
+            continue;
+        }
+        i++;
+    }
+
+    ninja_atomic_store_release(&shm->header->evictions, evictions + 2);
+    return removed;
+}
+
+// Helper function to remove key's record, moving records under the evictions count
+static ninja_error_t ninja_shm_delete(ninja_shm_t* shm, ninja_shm_table_t* table, int64_t key) {
+    size_t mask = table->capacity - 1;
+    size_t index = ninja_shm_hash(key, mask);
+
+    for (size_t probes = 0; probes < table->capacity; probes++) {
+        ninja_shm_slot_t* slot = ninja_shm_slot(table, index);
+        if (slot->key == 0) {
+            break;
+        }
+        if (slot->key == key) {
+            uint64_t evictions = shm->header->evictions;
+            ninja_atomic_store_relaxed(&shm->header->evictions, evictions + 1);
+            ninja_atomic_fence_release();
+            ninja_shm_remove_slot(table, index);
+            ninja_atomic_store_release(&shm->header->evictions, evictions + 2);
+            return NINJA_OK;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return NINJA_ERROR_NOT_FOUND;
+}
+
+ninja_error_t ninja_shm_publish_position(ninja_shm_t* shm, const ninja_position_t* position) {
+    if (!shm || !shm->header || !position || position->account_id <= 0 || position->contract_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_shm_publish(&shm->positions,
+                             ninja_shm_position_key(position->account_id, position->contract_id),
+                             position);
+}
+
+ninja_error_t ninja_shm_remove_position(ninja_shm_t* shm, const ninja_position_t* position) {
+    if (!shm || !shm->header || !position || position->account_id <= 0 || position->contract_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_shm_delete(shm, &shm->positions,
+                            ninja_shm_position_key(position->account_id, position->contract_id));
+}
+
+ninja_error_t ninja_shm_publish_order(ninja_shm_t* shm, const ninja_order_t* order) {
+    if (!shm || !shm->header || !order || order->order_id <= 0) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_error_t result = ninja_shm_publish(&shm->orders, order->order_id, order);
+    if (result == NINJA_ERROR_MEMORY && ninja_shm_evict_orders(shm) > 0) {
+        result = ninja_shm_publish(&shm->orders, order->order_id, order);
+    }
+    return result;
+}
+
+void ninja_shm_commit(ninja_shm_t* shm) {
+    if (!shm || !shm->header) {
+        return;
+    }
+
+    shm->header->updated_ns = ninja_wall_clock_ns();
+    ninja_atomic_store_release(&shm->header->generation, shm->header->generation + 1);
+}
+
+// Helper function to take a consistent copy of a slot. Returns its key, or -1
+// if the writer never finished (the publisher died mid-write).
+static int64_t ninja_shm_read_slot(const ninja_shm_slot_t* slot, int64_t wanted, void* record, size_t record_size) {
+    for (uint32_t retries = 0; retries < NINJA_SHM_MAX_RETRIES; retries++) {
+        uint64_t before = ninja_atomic_load_acquire(&slot->sequence);
+        if (before & 1) {
+            ninja_cpu_relax();
+            continue;
+        }
+
+        int64_t key = (int64_t)ninja_atomic_load_relaxed((const volatile uint64_t*)&slot->key);
+        if (key != 0 && (wanted == 0 || key == wanted)) {
+            memcpy(record, slot + 1, record_size);
+        }
+
+        ninja_atomic_fence_acquire();
+        if (ninja_atomic_load_relaxed(&slot->sequence) == before) {
+            return key;
+        }
+    }
+    return -1;
+}
+
+// Helper function to probe for key once, without regard to evictions
+static ninja_error_t ninja_shm_probe(const ninja_shm_table_t* table, int64_t key, void* record) {
+    size_t mask = table->capacity - 1;
+    size_t index = ninja_shm_hash(key, mask);
+
+    for (size_t probes = 0; probes < table->capacity; probes++) {
+        int64_t found = ninja_shm_read_slot(ninja_shm_slot(table, index), key, record, table->record_size);
+        if (found == key) {
+            return NINJA_OK;
+        }
+        if (found == 0) {
+            return NINJA_ERROR_NOT_FOUND;
+        }
+        if (found < 0) {
+            return NINJA_ERROR_TIMEOUT;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return NINJA_ERROR_NOT_FOUND;
+}
+
+// Helper function to wait out an eviction in progress; returns the even
+// evictions count, or an odd one if the publisher never finished
+static uint64_t ninja_shm_evictions(const ninja_shm_table_t* table) {
+    uint64_t evictions = ninja_atomic_load_acquire(table->evictions);
+    for (uint32_t retries = 0; (evictions & 1) && retries < NINJA_SHM_MAX_RETRIES; retries++) {
+        ninja_cpu_relax();
+        evictions = ninja_atomic_load_acquire(table->evictions);
+    }
+    return evictions;
+}
+
+ninja_error_t ninja_shm_read(const ninja_shm_table_t* table, int64_t key, void* record) {
+    if (!table || !table->slots || key == 0 || !record) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // A hit is always consistent; a miss only counts if no record moved meanwhile
+    for (uint32_t retries = 0; retries < NINJA_SHM_MAX_RETRIES; retries++) {
+        uint64_t evictions = ninja_shm_evictions(table);
+        if (evictions & 1) {
+            return NINJA_ERROR_TIMEOUT;
+        }
+
+        ninja_error_t result = ninja_shm_probe(table, key, record);
+        ninja_atomic_fence_acquire();
+        if (result != NINJA_ERROR_NOT_FOUND || ninja_atomic_load_relaxed(table->evictions) == evictions) {
+            return result;
+        }
+    }
+
+    return NINJA_ERROR_TIMEOUT;
+}
+
+ninja_error_t ninja_shm_snapshot(const ninja_shm_table_t* table, void** records, size_t* count) {
+    if (!table || !table->slots || !records || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *records = NULL;
+    *count = 0;
+
+    // Records published after this point may be missed, as in any snapshot.
+    // Records moved by an eviction may be missed or seen twice, so rescan.
+    for (uint32_t retries = 0; retries < NINJA_SHM_MAX_RETRIES; retries++) {
+        uint64_t evictions = ninja_shm_evictions(table);
+        if (evictions & 1) {
+            return NINJA_ERROR_TIMEOUT;
+        }
+
+        size_t expected = *(const volatile uint32_t*)table->count;
+        if (expected == 0) {
+            return NINJA_OK;
+        }
+
+        char* out = calloc(expected, table->record_size);
+        if (!out) {
+            return NINJA_ERROR_MEMORY;
+        }
+
+        size_t n = 0;
+        for (size_t i = 0; i < table->capacity && n < expected; i++) {
+            int64_t key = ninja_shm_read_slot(ninja_shm_slot(table, i), 0, out + n * table->record_size, table->record_size);
+            if (key < 0) {
+                free(out);
+                return NINJA_ERROR_TIMEOUT;
+            }
+            if (key != 0) {
+                n++;
+            }
+        }
+
+        ninja_atomic_fence_acquire();
+        if (ninja_atomic_load_relaxed(table->evictions) != evictions) {
+            free(out);
+            continue;
+        }
+
+        *records = out;
+        *count = n;
+        return NINJA_OK;
+    }
+
+    return NINJA_ERROR_TIMEOUT;
+}
+
+// Read-only view of a published segment
+struct ninja_shm_reader {
+    ninja_shm_t shm;
+};
+
+ninja_error_t ninja_publish_positions(ninja_client_t* client,
+                                     const ninja_position_t* positions,
+                                     size_t count) {
+    if (!client || !client->shm.header || (!positions && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_error_t result = NINJA_OK;
+    ninja_mutex_lock(&client->lock);
+    for (size_t i = 0; i < count && result == NINJA_OK; i++) {
+        result = ninja_shm_publish_position(&client->shm, &positions[i]);
+    }
+    ninja_shm_commit(&client->shm);
+    ninja_mutex_unlock(&client->lock);
+
+    return result;
+}
+
+ninja_error_t ninja_publish_orders(ninja_client_t* client,
+                                  const ninja_order_t* orders,
+                                  size_t count) {
+    if (!client || !client->shm.header || (!orders && count > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_error_t result = NINJA_OK;
+    ninja_mutex_lock(&client->lock);
+    for (size_t i = 0; i < count && result == NINJA_OK; i++) {
+        result = ninja_shm_publish_order(&client->shm, &orders[i]);
+    }
+    ninja_shm_commit(&client->shm);
+    ninja_mutex_unlock(&client->lock);
+
+    return result;
+}
+
+ninja_shm_reader_t* ninja_shm_reader_open(const char* name) {
+    if (!name) {
+        return NULL;
+    }
+
+    ninja_shm_reader_t* reader = calloc(1, sizeof(ninja_shm_reader_t));
+    if (!reader) {
+        return NULL;
+    }
+
+    if (ninja_shm_attach(&reader->shm, name) != NINJA_OK) {
+        free(reader);
+        return NULL;
+    }
+
+    return reader;
+}
+
+void ninja_shm_reader_close(ninja_shm_reader_t* reader) {
+    if (!reader) {
+        return;
+    }
+
+    ninja_shm_close(&reader->shm);
+    free(reader);
+}
+
+uint64_t ninja_shm_reader_generation(const ninja_shm_reader_t* reader) {
+    if (!reader) {
+        return 0;
+    }
+
+    return ninja_atomic_load_acquire(&reader->shm.header->generation);
+}
+
+ninja_error_t ninja_shm_read_position(const ninja_shm_reader_t* reader,
+                                     int account_id,
+                                     int contract_id,
+                                     ninja_position_t* position) {
+    if (!reader || account_id <= 0 || contract_id <= 0 || !position) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_shm_read(&reader->shm.positions, ninja_shm_position_key(account_id, contract_id), position);
+}
+
+ninja_error_t ninja_shm_read_order(const ninja_shm_reader_t* reader,
+                                  ninja_order_id_t order_id,
+                                  ninja_order_t* order) {
+    if (!reader || order_id <= 0 || !order) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    return ninja_shm_read(&reader->shm.orders, order_id, order);
+}
+
+ninja_error_t ninja_shm_read_positions(const ninja_shm_reader_t* reader,
+                                      ninja_position_t** positions,
+                                      size_t* count) {
+    if (!reader || !positions || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    void* records = NULL;
+    ninja_error_t result = ninja_shm_snapshot(&reader->shm.positions, &records, count);
+    *positions = records;
+    return result;
+}
+
+ninja_error_t ninja_shm_read_orders(const ninja_shm_reader_t* reader,
+                                   ninja_order_t** orders,
+                                   size_t* count) {
+    if (!reader || !orders || !count) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    void* records = NULL;
+    ninja_error_t result = ninja_shm_snapshot(&reader->shm.orders, &records, count);
+    *orders = records;
+    return result;
+}
+
+ninja_error_t ninja_shm_remove(const char* name) {
+    return ninja_mmap_unlink_shared(name);
+}
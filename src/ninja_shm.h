@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_mmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NINJA_SHM_MAGIC "NJSHMEM"
+#define NINJA_SHM_VERSION 2
+
+// Segment header, followed by the position table and then the order table.
+// Counts and generation are only written by the publisher.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t position_size;     // sizeof(ninja_position_t) of the publisher
+    uint32_t order_size;        // sizeof(ninja_order_t) of the publisher
+    uint32_t position_capacity; // Slots per table, powers of two
+    uint32_t order_capacity;
+    uint32_t position_count;
+    uint32_t order_count;
+    uint32_t reserved0;
+    uint64_t generation;        // Bumped after every publish batch
+    int64_t updated_ns;         // Wall clock time of the last publish
+    uint64_t evictions;         // Odd while finished orders are being removed
+} ninja_shm_header_t;
+
+// Open-addressed table of seqlock-protected slots. Each slot starts with its
+// sequence (odd while being written) and key (0 while unused), followed by
+// the record; slots are padded to whole cache lines. Removing a record shifts
+// later records of its probe run back, so a lookup that misses while the
+// header's evictions count moves must probe again.
+typedef struct {
+    char* slots;
+    size_t stride;
+    size_t capacity;
+    size_t record_size;
+    uint32_t* count;
+    uint64_t* evictions;
+} ninja_shm_table_t;
+
+typedef struct {
+    ninja_mmap_t map;
+    ninja_shm_header_t* header;
+    ninja_shm_table_t positions;
+    ninja_shm_table_t orders;
+} ninja_shm_t;
+
+// Create the named segment, or reuse an existing one with the same layout
+ninja_error_t ninja_shm_create(ninja_shm_t* shm, const char* name, size_t position_capacity, size_t order_capacity);
+
+// Map an existing segment read-only
+ninja_error_t ninja_shm_attach(ninja_shm_t* shm, const char* name);
+
+void ninja_shm_close(ninja_shm_t* shm);
+
+// Publisher side; only one process may publish to a segment. When the order
+// table is full, filled, cancelled, rejected, expired and completed orders are
+// evicted to make room.
+ninja_error_t ninja_shm_publish_position(ninja_shm_t* shm, const ninja_position_t* position);
+ninja_error_t ninja_shm_publish_order(ninja_shm_t* shm, const ninja_order_t* order);
+// Take a position that is gone out of the table; NINJA_ERROR_NOT_FOUND if it was never published
+ninja_error_t ninja_shm_remove_position(ninja_shm_t* shm, const ninja_position_t* position);
+void ninja_shm_commit(ninja_shm_t* shm);
+
+// Reader side: consistent copies of single records or whole tables
+ninja_error_t ninja_shm_read(const ninja_shm_table_t* table, int64_t key, void* record);
+ninja_error_t ninja_shm_snapshot(const ninja_shm_table_t* table, void** records, size_t* count);
+
+// Position key: account id in the high half, contract id in the low half
+static inline int64_t ninja_shm_position_key(int account_id, int contract_id) {
+    return (int64_t)(((uint64_t)(uint32_t)account_id << 32) | (uint32_t)contract_id);
+}
+
+#ifdef __cplusplus
+}
+#endif
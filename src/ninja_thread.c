@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE // pthread_setaffinity_np
+#endif
+
+#include "ninja_thread.h"
+#include <stdlib.h>
+
+typedef struct {
+    ninja_thread_fn fn;
+    void* arg;
+} ninja_thread_start_t;
+
+#ifdef _WIN32
+
+static DWORD WINAPI ninja_thread_main(LPVOID param) {
+    ninja_thread_start_t start = *(ninja_thread_start_t*)param;
+    free(param);
+    start.fn(start.arg);
+    return 0;
+}
+
+ninja_error_t ninja_thread_start(ninja_thread_t* thread, ninja_thread_fn fn, void* arg, int cpu) {
+    if (!thread || !fn) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_thread_start_t* start = malloc(sizeof(ninja_thread_start_t));
+    if (!start) {
+        return NINJA_ERROR_MEMORY;
+    }
+    start->fn = fn;
+    start->arg = arg;
+
+    thread->handle = CreateThread(NULL, 0, ninja_thread_main, start, CREATE_SUSPENDED, &thread->id);
+    if (!thread->handle) {
+        free(start);
+        return NINJA_ERROR_MEMORY;
+    }
+
+    if (cpu >= 0 && cpu < (int)(sizeof(DWORD_PTR) * 8)) {
+        SetThreadAffinityMask(thread->handle, (DWORD_PTR)1 << cpu);
+    }
+    ResumeThread(thread->handle);
+
+    return NINJA_OK;
+}
+
+void ninja_thread_join(ninja_thread_t* thread) {
+    if (thread && thread->handle) {
+        WaitForSingleObject(thread->handle, INFINITE);
+        CloseHandle(thread->handle);
+        thread->handle = NULL;
+    }
+}
+
+bool ninja_thread_is_current(const ninja_thread_t* thread) {
+    return thread && thread->handle && thread->id == GetCurrentThreadId();
+}
+
+void ninja_sleep_ms(int milliseconds) {
+    Sleep((DWORD)milliseconds);
+}
+
+void ninja_mutex_init(ninja_mutex_t* mutex) { InitializeCriticalSection(mutex); }
+void ninja_mutex_destroy(ninja_mutex_t* mutex) { DeleteCriticalSection(mutex); }
+void ninja_mutex_lock(ninja_mutex_t* mutex) { EnterCriticalSection(mutex); }
+void ninja_mutex_unlock(ninja_mutex_t* mutex) { LeaveCriticalSection(mutex); }
+
+void ninja_cond_init(ninja_cond_t* cond) { InitializeConditionVariable(cond); }
+void ninja_cond_destroy(ninja_cond_t* cond) { (void)cond; }
+void ninja_cond_signal(ninja_cond_t* cond) { WakeConditionVariable(cond); }
+
+void ninja_cond_wait(ninja_cond_t* cond, ninja_mutex_t* mutex, int timeout_ms) {
+    SleepConditionVariableCS(cond, mutex, (DWORD)timeout_ms);
+}
+
+#else
+
+#include <time.h>
+
+static void* ninja_thread_main(void* param) {
+    ninja_thread_start_t start = *(ninja_thread_start_t*)param;
+    free(param);
+    start.fn(start.arg);
+    return NULL;
+}
+
+ninja_error_t ninja_thread_start(ninja_thread_t* thread, ninja_thread_fn fn, void* arg, int cpu) {
+    if (!thread || !fn) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    ninja_thread_start_t* start = malloc(sizeof(ninja_thread_start_t));
+    if (!start) {
+        return NINJA_ERROR_MEMORY;
+    }
+    start->fn = fn;
+    start->arg = arg;
+
+    if (pthread_create(&thread->handle, NULL, ninja_thread_main, start) != 0) {
+        free(start);
+        return NINJA_ERROR_MEMORY;
+    }
+
+#ifdef __linux__
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(thread->handle, sizeof(cpus), &cpus);
+    }
+#else
+    (void)cpu; // No portable affinity API elsewhere
+#endif
+
+    return NINJA_OK;
+}
+
+void ninja_thread_join(ninja_thread_t* thread) {
+    if (thread) {
+        pthread_join(thread->handle, NULL);
+    }
+}
+
+bool ninja_thread_is_current(const ninja_thread_t* thread) {
+    return thread && pthread_equal(thread->handle, pthread_self());
+}
+
+void ninja_sleep_ms(int milliseconds) {
+    if (milliseconds <= 0) {
+        return;
+    }
+
+    struct timespec delay;
+    delay.tv_sec = milliseconds / 1000;
+    delay.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+    while (nanosleep(&delay, &delay) != 0) {
+    }
+}
+
+void ninja_mutex_init(ninja_mutex_t* mutex) { pthread_mutex_init(mutex, NULL); }
+void ninja_mutex_destroy(ninja_mutex_t* mutex) { pthread_mutex_destroy(mutex); }
+void ninja_mutex_lock(ninja_mutex_t* mutex) { pthread_mutex_lock(mutex); }
+void ninja_mutex_unlock(ninja_mutex_t* mutex) { pthread_mutex_unlock(mutex); }
+
+void ninja_cond_init(ninja_cond_t* cond) { pthread_cond_init(cond, NULL); }
+void ninja_cond_destroy(ninja_cond_t* cond) { pthread_cond_destroy(cond); }
+void ninja_cond_signal(ninja_cond_t* cond) { pthread_cond_signal(cond); }
+
+void ninja_cond_wait(ninja_cond_t* cond, ninja_mutex_t* mutex, int timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(cond, mutex, &deadline);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Thin wrappers over Win32 and pthread threads, mutexes and condition variables
+
+#ifdef _WIN32
+typedef struct {
+    HANDLE handle;
+    DWORD id;
+} ninja_thread_t;
+typedef CRITICAL_SECTION ninja_mutex_t;
+typedef CONDITION_VARIABLE ninja_cond_t;
+#else
+typedef struct {
+    pthread_t handle;
+} ninja_thread_t;
+typedef pthread_mutex_t ninja_mutex_t;
+typedef pthread_cond_t ninja_cond_t;
+#endif
+
+typedef void (*ninja_thread_fn)(void* arg);
+
+// Start fn(arg) on a new thread, pinned to cpu unless cpu is negative
+ninja_error_t ninja_thread_start(ninja_thread_t* thread, ninja_thread_fn fn, void* arg, int cpu);
+void ninja_thread_join(ninja_thread_t* thread);
+bool ninja_thread_is_current(const ninja_thread_t* thread);
+void ninja_sleep_ms(int milliseconds);
+
+void ninja_mutex_init(ninja_mutex_t* mutex);
+void ninja_mutex_destroy(ninja_mutex_t* mutex);
+void ninja_mutex_lock(ninja_mutex_t* mutex);
+void ninja_mutex_unlock(ninja_mutex_t* mutex);
+
+void ninja_cond_init(ninja_cond_t* cond);
+void ninja_cond_destroy(ninja_cond_t* cond);
+void ninja_cond_signal(ninja_cond_t* cond);
+
+// Wait with mutex held; returns after a signal or timeout_ms at the latest
+void ninja_cond_wait(ninja_cond_t* cond, ninja_mutex_t* mutex, int timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
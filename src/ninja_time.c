@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "../include/ninja/ninja_api.h"
+#include "ninja_client.h"
+#include "ninja_platform.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const int64_t ninja_pow10[10] = {
+    1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL,
+    1000000LL, 10000000LL, 100000000LL, 1000000000LL
+};
+
+static const unsigned char ninja_days_in_month[13] = {
+    0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+// Days since 1970-01-01 for a proleptic Gregorian civil date
+static inline int64_t ninja_days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned)(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+// Civil date of a day count since 1970-01-01 (inverse of ninja_days_from_civil)
+static inline void ninja_civil_from_days(int64_t z, int64_t* y, unsigned* m, unsigned* d) {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = (unsigned)(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp < 10 ? mp + 3 : mp - 9;
+    *y = (int64_t)yoe + era * 400 + (*m <= 2);
+}
+
+// Value of the digit at s[i]; flags non-digits in *bad without branching
+static inline unsigned ninja_digit(const char* s, size_t i, unsigned* bad) {
+    unsigned d = (unsigned)(unsigned char)s[i] - '0';
+    *bad |= (d > 9);
+    return d;
+}
+
+ninja_error_t ninja_parse_timestamp(const char* text, size_t length, int64_t* timestamp_ns) {
+    if (!text || !timestamp_ns) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    // Shortest accepted form is "YYYY-MM-DDTHH:MM:SS"
+    if (length < 19) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    // Fixed-position fields: every digit and separator is checked, but the
+    // result is only inspected once, so the fast path has no data-dependent branches
+    unsigned bad = 0;
+    unsigned year = ninja_digit(text, 0, &bad) * 1000 + ninja_digit(text, 1, &bad) * 100 +
+                    ninja_digit(text, 2, &bad) * 10 + ninja_digit(text, 3, &bad);
+    unsigned month = ninja_digit(text, 5, &bad) * 10 + ninja_digit(text, 6, &bad);
+    unsigned day = ninja_digit(text, 8, &bad) * 10 + ninja_digit(text, 9, &bad);
+    unsigned hour = ninja_digit(text, 11, &bad) * 10 + ninja_digit(text, 12, &bad);
+    unsigned minute = ninja_digit(text, 14, &bad) * 10 + ninja_digit(text, 15, &bad);
+    unsigned second = ninja_digit(text, 17, &bad) * 10 + ninja_digit(text, 18, &bad);
+
+    bad |= (text[4] != '-') | (text[7] != '-') | (text[13] != ':') | (text[16] != ':');
+    bad |= (text[10] != 'T') & (text[10] != 't') & (text[10] != ' ');
+    bad |= (month - 1 > 11) | (day - 1 > 30) | (hour > 23) | (minute > 59) | (second > 60);
+    if (bad) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    bool leap = (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+    if (day > ninja_days_in_month[month] || (month == 2 && day == 29 && !leap)) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    size_t pos = 19;
+
+    // Optional fraction; digits beyond nanosecond precision are ignored
+    int64_t fraction_ns = 0;
+    if (pos < length && text[pos] == '.') {
+        size_t start = ++pos;
+        while (pos < length && (unsigned)(unsigned char)text[pos] - '0' <= 9) {
+            if (pos - start < 9) {
+                fraction_ns = fraction_ns * 10 + (text[pos] - '0');
+            }
+            pos++;
+        }
+        size_t digits = pos - start;
+        if (digits == 0) {
+            return NINJA_ERROR_JSON_PARSE;
+        }
+        if (digits < 9) {
+            fraction_ns *= ninja_pow10[9 - digits];
+        }
+    }
+
+    // Optional zone designator; a missing one is taken as UTC
+    int64_t offset_seconds = 0;
+    if (pos < length && (text[pos] == 'Z' || text[pos] == 'z')) {
+        pos++;
+    } else if (pos < length && (text[pos] == '+' || text[pos] == '-')) {
+        if (length - pos < 6 || text[pos + 3] != ':') {
+            return NINJA_ERROR_JSON_PARSE;
+        }
+        unsigned offset_hour = ninja_digit(text, pos + 1, &bad) * 10 + ninja_digit(text, pos + 2, &bad);
+        unsigned offset_minute = ninja_digit(text, pos + 4, &bad) * 10 + ninja_digit(text, pos + 5, &bad);
+        if (bad || offset_hour > 23 || offset_minute > 59) {
+            return NINJA_ERROR_JSON_PARSE;
+        }
+        offset_seconds = (int64_t)(offset_hour * 3600 + offset_minute * 60);
+        if (text[pos] == '-') {
+            offset_seconds = -offset_seconds;
+        }
+        pos += 6;
+    }
+
+    if (pos != length) {
+        return NINJA_ERROR_JSON_PARSE;
+    }
+
+    int64_t seconds = ninja_days_from_civil(year, month, day) * 86400 +
+                      (int64_t)(hour * 3600 + minute * 60 + second) - offset_seconds;
+    *timestamp_ns = seconds * 1000000000LL + fraction_ns;
+
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_format_timestamp(int64_t timestamp_ns, char* text, size_t size) {
+    if (!text || size < NINJA_TIMESTAMP_TEXT_SIZE) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    int64_t seconds = timestamp_ns / 1000000000LL;
+    int64_t fraction_ns = timestamp_ns % 1000000000LL;
+    if (fraction_ns < 0) {
+        seconds--;
+        fraction_ns += 1000000000LL;
+    }
+    int64_t days = seconds / 86400;
+    int64_t second_of_day = seconds % 86400;
+    if (second_of_day < 0) {
+        days--;
+        second_of_day += 86400;
+    }
+
+    int64_t year;
+    unsigned month, day;
+    ninja_civil_from_days(days, &year, &month, &day);
+    if (year < 0 || year > 9999) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    snprintf(text, size, "%04d-%02u-%02uT%02d:%02d:%02d.%03dZ",
+             (int)year, month, day,
+             (int)(second_of_day / 3600), (int)(second_of_day / 60 % 60), (int)(second_of_day % 60),
+             (int)(fraction_ns / 1000000));
+    return NINJA_OK;
+}
+
+int64_t ninja_wall_clock_ns(void) {
+#ifdef _WIN32
+    // FILETIME counts 100 ns intervals since 1601-01-01
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    int64_t ticks = ((int64_t)now.dwHighDateTime << 32) | now.dwLowDateTime;
+    return (ticks - 116444736000000000LL) * 100;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
+}
+
+int64_t ninja_monotonic_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, now;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (int64_t)((double)now.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
+}
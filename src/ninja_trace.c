@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "ninja_trace.h"
+#include "ninja_atomic.h"
+#include "ninja_thread.h"
+#include "../include/ninja/ninja_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+    #include <time.h>
+#endif
+
+static const char* const ninja_span_names[NINJA_SPAN_KIND_COUNT] = {
+    "serialize", "queue", "connect", "send", "ttfb", "receive", "parse", "callback"
+};
+
+const char* ninja_span_kind_to_string(ninja_span_kind_t kind) {
+    return (unsigned)kind < NINJA_SPAN_KIND_COUNT ? ninja_span_names[kind] : "unknown";
+}
+
+#ifdef NINJA_TRACING
+
+// Spans a thread holds between drains; a power of two
+#define NINJA_TRACE_RING_SIZE 4096
+
+// Trace ids a thread takes from the shared counter at once
+#define NINJA_TRACE_ID_BLOCK 1024
+
+// Spans moved per drain while exporting
+#define NINJA_TRACE_EXPORT_BATCH 256
+
+typedef struct {
+    uint64_t trace_id;
+    uint64_t start_ticks;
+    uint64_t end_ticks;
+    uint32_t thread_id;
+    uint32_t kind;
+} ninja_trace_record_t;
+
+// One thread's spans: the owner advances head, the drain advances tail. A
+// ring whose thread exited is retired and adopted by the next new thread,
+// so rings are never freed and their number stays at the most threads
+// that recorded at once.
+typedef struct ninja_trace_ring {
+    uint64_t head;
+    uint64_t tail_seen;         // Owner's last read of tail
+    uint64_t dropped;
+    char padding[64 - 3 * sizeof(uint64_t)];
+    uint64_t tail;
+    char tail_padding[64 - sizeof(uint64_t)];
+    struct ninja_trace_ring* next;
+    uint64_t retired;
+    uint32_t thread_id;
+    ninja_trace_record_t records[NINJA_TRACE_RING_SIZE];
+} ninja_trace_ring_t;
+
+NINJA_THREAD_LOCAL uint64_t ninja_trace_current;
+uint64_t ninja_trace_enabled;
+
+static NINJA_THREAD_LOCAL ninja_trace_ring_t* ninja_trace_ring;
+static NINJA_THREAD_LOCAL uint64_t ninja_trace_next;
+static NINJA_THREAD_LOCAL uint64_t ninja_trace_limit;
+
+// Process-wide state, set up by the first ninja_trace_enable
+static struct {
+    uint64_t ready;             // 0 unset, 1 being set up, 2 ready
+    ninja_mutex_t lock;         // Guards the ring list and serializes drains
+    ninja_trace_ring_t* rings;
+    uint32_t thread_count;
+    uint64_t trace_count;
+
+    // Clock reading paired with a counter reading, to convert ticks
+    uint64_t base_ticks;
+    int64_t base_ns;
+
+#ifdef _WIN32
+    DWORD exit_key;
+#else
+    pthread_key_t exit_key;
+#endif
+} ninja_trace_state;
+
+uint64_t ninja_trace_clock(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, now;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+#endif
+}
+
+// Helper function run at thread exit: hand the thread's ring to the next new thread
+#ifdef _WIN32
+static void WINAPI ninja_trace_retire(void* ring) {
+#else
+static void ninja_trace_retire(void* ring) {
+#endif
+    if (ring) {
+        ninja_atomic_store_release(&((ninja_trace_ring_t*)ring)->retired, 1);
+    }
+}
+
+// Helper function to set up the process-wide state once
+static void ninja_trace_init(void) {
+    uint64_t expected = 0;
+    if (!ninja_atomic_compare_exchange(&ninja_trace_state.ready, &expected, 1)) {
+        while (ninja_atomic_load_acquire(&ninja_trace_state.ready) != 2) {
+            ninja_cpu_relax();
+        }
+        return;
+    }
+
+    ninja_mutex_init(&ninja_trace_state.lock);
+#ifdef _WIN32
+    ninja_trace_state.exit_key = FlsAlloc(ninja_trace_retire);
+#else
+    pthread_key_create(&ninja_trace_state.exit_key, ninja_trace_retire);
+#endif
+    ninja_trace_state.base_ticks = ninja_trace_ticks();
+    ninja_trace_state.base_ns = (int64_t)ninja_trace_clock();
+    ninja_atomic_store_release(&ninja_trace_state.ready, 2);
+}
+
+// Helper function to give the calling thread a ring, adopting a retired one if any
+static ninja_trace_ring_t* ninja_trace_attach(void) {
+    ninja_mutex_lock(&ninja_trace_state.lock);
+    ninja_trace_ring_t* ring = ninja_trace_state.rings;
+    while (ring && !ninja_atomic_load_acquire(&ring->retired)) {
+        ring = ring->next;
+    }
+    if (!ring) {
+        ring = calloc(1, sizeof(ninja_trace_ring_t));
+        if (ring) {
+            ring->next = ninja_trace_state.rings;
+            ninja_trace_state.rings = ring;
+        }
+    }
+    if (ring) {
+        ring->retired = 0;
+        ring->thread_id = ++ninja_trace_state.thread_count;
+    }
+    ninja_mutex_unlock(&ninja_trace_state.lock);
+
+    if (ring) {
+#ifdef _WIN32
+        FlsSetValue(ninja_trace_state.exit_key, ring);
+#else
+        pthread_setspecific(ninja_trace_state.exit_key, ring);
+#endif
+    }
+    return ring;
+}
+
+uint64_t ninja_trace_next_id(void) {
+    // Ids come from a block of the thread's own, so threads share no counter
+    if (ninja_trace_next == ninja_trace_limit) {
+        ninja_trace_next = ninja_atomic_fetch_add(&ninja_trace_state.trace_count, NINJA_TRACE_ID_BLOCK) + 1;
+        ninja_trace_limit = ninja_trace_next + NINJA_TRACE_ID_BLOCK;
+    }
+    return ninja_trace_next++;
+}
+
+void ninja_trace_record(uint64_t trace_id, ninja_span_kind_t kind, uint64_t start_ticks, uint64_t end_ticks) {
+    // Trace ids are only handed out once ninja_trace_init has run
+    ninja_trace_ring_t* ring = ninja_trace_ring;
+    if (!ring) {
+        ring = ninja_trace_attach();
+        if (!ring) {
+            return;
+        }
+        ninja_trace_ring = ring;
+    }
+
+    // tail is only read again once the ring looks full, so recording stays
+    // off the drain's cache line
+    uint64_t head = ninja_atomic_load_relaxed(&ring->head);
+    if (head - ring->tail_seen >= NINJA_TRACE_RING_SIZE) {
+        ring->tail_seen = ninja_atomic_load_acquire(&ring->tail);
+        if (head - ring->tail_seen >= NINJA_TRACE_RING_SIZE) {
+            ninja_atomic_store_relaxed(&ring->dropped, ninja_atomic_load_relaxed(&ring->dropped) + 1);
+            return;
+        }
+    }
+
+    ninja_trace_record_t* record = &ring->records[head & (NINJA_TRACE_RING_SIZE - 1)];
+    record->trace_id = trace_id;
+    record->start_ticks = start_ticks;
+    record->end_ticks = end_ticks < start_ticks ? start_ticks : end_ticks;
+    record->thread_id = ring->thread_id;
+    record->kind = (uint32_t)kind;
+    ninja_atomic_store_release(&ring->head, head + 1);
+}
+
+void ninja_trace_transfer(uint64_t trace_id, CURL* curl, uint64_t start_ticks) {
+    if (!trace_id) {
+        return;
+    }
+    uint64_t end_ticks = ninja_trace_ticks();
+
+    // Phase ends in microseconds since the transfer started
+    curl_off_t connect = 0;
+    curl_off_t app_connect = 0;
+    curl_off_t sent = 0;
+    curl_off_t first_byte = 0;
+    curl_off_t total = 0;
+    curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &app_connect);
+    curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &sent);
+#if LIBCURL_VERSION_NUM >= 0x080a00
+    // Last byte of the request body, where available
+    curl_off_t post_transfer = 0;
+    curl_easy_getinfo(curl, CURLINFO_POSTTRANSFER_TIME_T, &post_transfer);
+    if (post_transfer > sent) {
+        sent = post_transfer;
+    }
+#endif
+    curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &first_byte);
+    curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &total);
+    if (total <= 0 || end_ticks <= start_ticks) {
+        return;
+    }
+
+    // curl's clock and the counter measure the same interval; map one onto the other
+    curl_off_t connected = app_connect > connect ? app_connect : connect;
+    curl_off_t ends[4] = { connected, sent, first_byte, total };
+    double ticks_per_us = (double)(end_ticks - start_ticks) / (double)total;
+    uint64_t previous = start_ticks;
+    for (int i = 0; i < 4; i++) {
+        curl_off_t end = ends[i] < total ? ends[i] : total;
+        uint64_t end_ticks_i = start_ticks + (uint64_t)((double)end * ticks_per_us);
+        if (end_ticks_i < previous) {
+            end_ticks_i = previous;
+        }
+
+        // A reused connection has no connect phase
+        if (i > 0 || end > 0) {
+            ninja_trace_record(trace_id, (ninja_span_kind_t)(NINJA_SPAN_CONNECT + i), previous, end_ticks_i);
+        }
+        previous = end_ticks_i;
+    }
+}
+
+ninja_error_t ninja_trace_enable(bool enabled) {
+    ninja_trace_init();
+    ninja_atomic_store_release(&ninja_trace_enabled, enabled ? 1 : 0);
+    return NINJA_OK;
+}
+
+ninja_error_t ninja_trace_drain(ninja_span_t* spans, size_t max_spans, size_t* count) {
+    if (!count || (!spans && max_spans > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *count = 0;
+    if (ninja_atomic_load_acquire(&ninja_trace_state.ready) != 2) {
+        return NINJA_OK;
+    }
+
+    ninja_mutex_lock(&ninja_trace_state.lock);
+
+    // Rate of the counter against the clock over everything since tracing began
+    uint64_t now_ticks = ninja_trace_ticks();
+    int64_t now_ns = (int64_t)ninja_trace_clock();
+    uint64_t base_ticks = ninja_trace_state.base_ticks;
+    int64_t base_ns = ninja_trace_state.base_ns;
+    double ns_per_tick = 1.0;
+    if (now_ticks > base_ticks && now_ns > base_ns) {
+        ns_per_tick = (double)(now_ns - base_ns) / (double)(now_ticks - base_ticks);
+    }
+
+    for (ninja_trace_ring_t* ring = ninja_trace_state.rings; ring && *count < max_spans; ring = ring->next) {
+        uint64_t tail = ninja_atomic_load_relaxed(&ring->tail);
+        uint64_t head = ninja_atomic_load_acquire(&ring->head);
+        for (; tail < head && *count < max_spans; tail++) {
+            const ninja_trace_record_t* record = &ring->records[tail & (NINJA_TRACE_RING_SIZE - 1)];
+            ninja_span_t* span = &spans[(*count)++];
+            span->trace_id = record->trace_id;
+            span->thread_id = record->thread_id;
+            span->kind = (ninja_span_kind_t)record->kind;
+            span->start_ns = base_ns + (int64_t)((double)(int64_t)(record->start_ticks - base_ticks) * ns_per_tick);
+            span->duration_ns = (int64_t)((double)(record->end_ticks - record->start_ticks) * ns_per_tick);
+        }
+        ninja_atomic_store_release(&ring->tail, tail);
+    }
+
+    ninja_mutex_unlock(&ninja_trace_state.lock);
+    return NINJA_OK;
+}
+
+uint64_t ninja_trace_dropped(void) {
+    if (ninja_atomic_load_acquire(&ninja_trace_state.ready) != 2) {
+        return 0;
+    }
+
+    uint64_t dropped = 0;
+    ninja_mutex_lock(&ninja_trace_state.lock);
+    for (ninja_trace_ring_t* ring = ninja_trace_state.rings; ring; ring = ring->next) {
+        dropped += ninja_atomic_load_relaxed(&ring->dropped);
+    }
+    ninja_mutex_unlock(&ninja_trace_state.lock);
+    return dropped;
+}
+
+ninja_error_t ninja_trace_export_chrome(const char* path) {
+    if (!path) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        return NINJA_ERROR_NOT_FOUND;
+    }
+
+    // Complete ("X") events in microseconds, one track per recording thread
+    ninja_span_t spans[NINJA_TRACE_EXPORT_BATCH];
+    size_t count = 0;
+    bool first = true;
+    fputs("{\"traceEvents\":[", file);
+    do {
+        ninja_trace_drain(spans, NINJA_TRACE_EXPORT_BATCH, &count);
+        for (size_t i = 0; i < count; i++) {
+            fprintf(file,
+                    "%s\n{\"name\":\"%s\",\"cat\":\"ninja\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                    "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"trace\":%llu}}",
+                    first ? "" : ",",
+                    ninja_span_kind_to_string(spans[i].kind),
+                    spans[i].thread_id,
+                    (double)spans[i].start_ns / 1000.0,
+                    (double)spans[i].duration_ns / 1000.0,
+                    (unsigned long long)spans[i].trace_id);
+            first = false;
+        }
+    } while (count == NINJA_TRACE_EXPORT_BATCH);
+    fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+
+    bool written = ferror(file) == 0;
+    written = fclose(file) == 0 && written;
+
+    return written ? NINJA_OK : NINJA_ERROR_MEMORY;
+}
+
+#else
+
+ninja_error_t ninja_trace_enable(bool enabled) {
+    return enabled ? NINJA_ERROR_NOT_FOUND : NINJA_OK;
+}
+
+ninja_error_t ninja_trace_drain(ninja_span_t* spans, size_t max_spans, size_t* count) {
+    if (!count || (!spans && max_spans > 0)) {
+        return NINJA_ERROR_INVALID_PARAM;
+    }
+
+    *count = 0;
+    return NINJA_OK;
+}
+
+uint64_t ninja_trace_dropped(void) {
+    return 0;
+}
+
+ninja_error_t ninja_trace_export_chrome(const char* path) {
+    return path ? NINJA_ERROR_NOT_FOUND : NINJA_ERROR_INVALID_PARAM;
+}
+
+#endif
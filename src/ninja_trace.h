@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Zachary Wang and NinjaTrader API Library contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "../include/ninja/ninja_types.h"
+#include "ninja_atomic.h"
+#include <curl/curl.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define NINJA_THREAD_LOCAL __declspec(thread)
+#else
+    #define NINJA_THREAD_LOCAL __thread
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Request tracing. Spans are stamped with the CPU's timestamp counter and
+// appended to a ring owned by the recording thread, so recording takes no
+// lock and touches no shared cache line; ninja_trace_drain() converts them
+// to nanoseconds. Trace id 0 means "not traced": every hook is skipped, and
+// without NINJA_TRACING the hooks compile to nothing.
+
+#ifdef NINJA_TRACING
+
+// Trace the calling thread is working on, 0 for none
+extern NINJA_THREAD_LOCAL uint64_t ninja_trace_current;
+
+// Nonzero while tracing is enabled
+extern uint64_t ninja_trace_enabled;
+
+// Clock for timestamp counters without a user-space read: monotonic nanoseconds
+uint64_t ninja_trace_clock(void);
+
+static inline uint64_t ninja_trace_ticks(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return ninja_trace_clock();
+#endif
+}
+
+// New trace id, or 0 while tracing is disabled
+uint64_t ninja_trace_next_id(void);
+
+// Append a span to the calling thread's ring; dropped if the ring is full
+void ninja_trace_record(uint64_t trace_id, ninja_span_kind_t kind, uint64_t start_ticks, uint64_t end_ticks);
+
+// Network phases of a finished transfer started at start_ticks, from its timing info
+void ninja_trace_transfer(uint64_t trace_id, CURL* curl, uint64_t start_ticks);
+
+static inline uint64_t ninja_trace_begin(void) {
+    return ninja_atomic_load_relaxed(&ninja_trace_enabled) ? ninja_trace_next_id() : 0;
+}
+
+// Start of a span of trace_id; 0 if it is not traced
+static inline uint64_t ninja_trace_start(uint64_t trace_id) {
+    return trace_id ? ninja_trace_ticks() : 0;
+}
+
+// End a span begun with ninja_trace_start
+static inline void ninja_trace_span(uint64_t trace_id, ninja_span_kind_t kind, uint64_t start_ticks) {
+    if (trace_id) {
+        ninja_trace_record(trace_id, kind, start_ticks, ninja_trace_ticks());
+    }
+}
+
+// Make trace_id the calling thread's current trace; returns the previous one
+static inline uint64_t ninja_trace_enter(uint64_t trace_id) {
+    uint64_t previous = ninja_trace_current;
+    ninja_trace_current = trace_id;
+    return previous;
+}
+
+static inline uint64_t ninja_trace_active(void) {
+    return ninja_trace_current;
+}
+
+#else
+
+static inline uint64_t ninja_trace_begin(void) {
+    return 0;
+}
+
+static inline uint64_t ninja_trace_start(uint64_t trace_id) {
+    (void)trace_id;
+    return 0;
+}
+
+static inline void ninja_trace_span(uint64_t trace_id, ninja_span_kind_t kind, uint64_t start_ticks) {
+    (void)trace_id;
+    (void)kind;
+    (void)start_ticks;
+}
+
+static inline void ninja_trace_transfer(uint64_t trace_id, CURL* curl, uint64_t start_ticks) {
+    (void)trace_id;
+    (void)curl;
+    (void)start_ticks;
+}
+
+static inline uint64_t ninja_trace_enter(uint64_t trace_id) {
+    (void)trace_id;
+    return 0;
+}
+
+static inline uint64_t ninja_trace_active(void) {
+    return 0;
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -25,6 +25,13 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <time.h>
+#include <math.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
 
 // Simple test framework
 #define TEST_ASSERT(condition, message) \
@@ -130,6 +137,1660 @@ int test_memory_management() {
     TEST_PASS();
 }
 
+// Test compact record layout and fixed-point prices
+int test_compact_layout() {
+    TEST_ASSERT(sizeof(ninja_order_compact_t) == 64, "Compact order should fit one cache line");
+    TEST_ASSERT(sizeof(ninja_position_compact_t) == 48, "Compact position should be 48 bytes");
+
+    TEST_ASSERT(ninja_price_to_ticks(4200.25, 0.25) == 16801, "Price to ticks conversion is incorrect");
+    TEST_ASSERT(ninja_price_to_ticks(1.1, 0.1) == 11, "Price to ticks should round to nearest tick");
+    TEST_ASSERT(ninja_ticks_to_price(16801, 0.25) == 4200.25, "Ticks to price conversion is incorrect");
+
+    TEST_PASS();
+}
+
+// Test conversion of full orders into compact hot/cold tables
+int test_compact_orders() {
+    ninja_order_t orders[2];
+    memset(orders, 0, sizeof(orders));
+
+    orders[0].order_id = 3000000001LL;
+    strcpy(orders[0].symbol, "ESM4");
+    strcpy(orders[0].timestamp, "2024-03-15T14:30:00.250Z");
+    orders[0].timestamp_ns = 1710513000250000000LL;
+    orders[0].account_id = 12345;
+    orders[0].side = NINJA_SIDE_SELL;
+    orders[0].type = NINJA_ORDER_LIMIT;
+    orders[0].status = NINJA_ORDER_WORKING;
+    orders[0].quantity = 2;
+    orders[0].price = 4200.25;
+    orders[1].order_id = 42;
+
+    ninja_order_compact_t* compact = NULL;
+    ninja_order_cold_t* cold = NULL;
+    ninja_error_t result = ninja_compact_orders(orders, 2, 0.25, &compact, &cold);
+    TEST_ASSERT(result == NINJA_OK, "Compacting orders failed");
+    TEST_ASSERT(compact != NULL && cold != NULL, "Compact tables not allocated");
+
+    TEST_ASSERT(compact[0].order_id == 3000000001LL, "Order id should not be truncated");
+    TEST_ASSERT(compact[0].timestamp_ns == 1710513000250000000LL, "Timestamp conversion is incorrect");
+    TEST_ASSERT(compact[0].price == 16801, "Price should be stored in ticks");
+    TEST_ASSERT(compact[0].side == NINJA_SIDE_SELL, "Side not preserved");
+    TEST_ASSERT(compact[1].order_id == 42, "Second order id incorrect");
+    TEST_ASSERT(strcmp(cold[compact[0].cold_index].symbol, "ESM4") == 0, "Cold symbol not preserved");
+
+    ninja_free_array(compact);
+    ninja_free_array(cold);
+
+    result = ninja_compact_orders(orders, 2, 0.0, &compact, NULL);
+    TEST_ASSERT(result == NINJA_ERROR_INVALID_PARAM, "Should reject zero tick size");
+
+    TEST_PASS();
+}
+
+// Test numeric order id API surface
+int test_order_id_api() {
+    ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_order_t order;
+    TEST_ASSERT(ninja_cancel_order(client, 0) == NINJA_ERROR_INVALID_PARAM, "Should reject zero order id");
+    TEST_ASSERT(ninja_modify_order(client, -5, 1, 4200.0) == NINJA_ERROR_INVALID_PARAM, "Should reject negative order id");
+    TEST_ASSERT(ninja_get_order_by_id(client, 0, &order) == NINJA_ERROR_INVALID_PARAM, "Should reject zero order id");
+    TEST_ASSERT(ninja_lookup_order(client, 3000000001LL, &order) == NINJA_ERROR_NOT_FOUND, "Unknown order should not be found");
+
+    ninja_client_destroy(client);
+    TEST_PASS();
+}
+
+// Test ISO-8601 timestamp decoding
+int test_parse_timestamp() {
+    int64_t ns = 0;
+
+    const char* text = "2024-03-15T14:30:00Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Basic timestamp rejected");
+    TEST_ASSERT(ns == 1710513000000000000LL, "Basic timestamp value incorrect");
+
+    text = "2024-03-15T14:30:00.123456789Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Nanosecond timestamp rejected");
+    TEST_ASSERT(ns == 1710513000123456789LL, "Nanosecond fraction incorrect");
+
+    text = "2024-03-15T14:30:00.5";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Short fraction rejected");
+    TEST_ASSERT(ns == 1710513000500000000LL, "Short fraction incorrect");
+
+    text = "2024-03-15T16:30:00+02:00";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Offset timestamp rejected");
+    TEST_ASSERT(ns == 1710513000000000000LL, "Offset not applied");
+
+    text = "1969-12-31T23:59:59Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Pre-epoch timestamp rejected");
+    TEST_ASSERT(ns == -1000000000LL, "Pre-epoch timestamp incorrect");
+
+    text = "2024-02-29T00:00:00Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_OK, "Leap day rejected");
+
+    text = "2023-02-29T00:00:00Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_ERROR_JSON_PARSE, "Invalid leap day accepted");
+
+    text = "2024-13-01T00:00:00Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_ERROR_JSON_PARSE, "Invalid month accepted");
+
+    text = "2024-03-15X14:30:00Z";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_ERROR_JSON_PARSE, "Bad separator accepted");
+
+    text = "2024-03-15T14:30:00Zjunk";
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &ns) == NINJA_ERROR_JSON_PARSE, "Trailing data accepted");
+
+    TEST_ASSERT(ninja_parse_timestamp(NULL, 0, &ns) == NINJA_ERROR_INVALID_PARAM, "NULL text accepted");
+
+    TEST_PASS();
+}
+
+// Test enum string decoding round-trips and unknown handling
+int test_enum_strings() {
+    for (int side = NINJA_SIDE_BUY; side < NINJA_SIDE_UNKNOWN; side++) {
+        const char* text = ninja_order_side_to_string((ninja_order_side_t)side);
+        TEST_ASSERT(ninja_order_side_from_string(text, strlen(text)) == (ninja_order_side_t)side, "Side round-trip failed");
+    }
+    for (int type = NINJA_ORDER_MARKET; type < NINJA_ORDER_TYPE_UNKNOWN; type++) {
+        const char* text = ninja_order_type_to_string((ninja_order_type_t)type);
+        TEST_ASSERT(ninja_order_type_from_string(text, strlen(text)) == (ninja_order_type_t)type, "Type round-trip failed");
+    }
+    for (int status = NINJA_ORDER_PENDING; status < NINJA_ORDER_STATUS_UNKNOWN; status++) {
+        const char* text = ninja_order_status_to_string((ninja_order_status_t)status);
+        TEST_ASSERT(ninja_order_status_from_string(text, strlen(text)) == (ninja_order_status_t)status, "Status round-trip failed");
+    }
+
+    TEST_ASSERT(ninja_order_type_from_string("StopLimit", 9) == NINJA_ORDER_STOP_LIMIT, "StopLimit not decoded");
+    TEST_ASSERT(ninja_order_status_from_string("Cancelled", 9) == NINJA_ORDER_CANCELLED, "British spelling not decoded");
+    TEST_ASSERT(ninja_order_status_from_string("Canceled", 8) == NINJA_ORDER_CANCELLED, "US spelling not decoded");
+
+    TEST_ASSERT(ninja_order_type_from_string("Iceberg", 7) == NINJA_ORDER_TYPE_UNKNOWN, "Unknown type should not map to Market");
+    TEST_ASSERT(ninja_order_type_from_string("Stap", 4) == NINJA_ORDER_TYPE_UNKNOWN, "Near-miss type should be unknown");
+    TEST_ASSERT(ninja_order_side_from_string("Hold", 4) == NINJA_SIDE_UNKNOWN, "Unknown side should not map to Sell");
+    TEST_ASSERT(ninja_order_status_from_string("Unknown", 7) == NINJA_ORDER_STATUS_UNKNOWN, "Unknown status mis-decoded");
+    TEST_ASSERT(ninja_order_status_from_string(NULL, 0) == NINJA_ORDER_STATUS_UNKNOWN, "NULL status mis-decoded");
+
+    TEST_PASS();
+}
+
+// Test schema-driven decoding of list responses
+int test_parse_responses() {
+    const char* orders_json =
+        "[{\"id\":3000000001,\"accountId\":12345,\"contractId\":1,\"timestamp\":\"2024-03-15T14:30:00.250Z\","
+        "\"action\":\"Sell\",\"ordStatus\":\"PartiallyFilled\",\"isAutomated\":true,\"orderType\":\"StopLimit\","
+        "\"orderQty\":3,\"price\":4200.25,\"stopPrice\":4201.0,\"filledQty\":1,\"avgFillPrice\":4200.25},"
+        "{\"orderQty\":1,\"id\":7,\"orderType\":\"Iceberg\"}]";
+
+    ninja_order_t* orders = NULL;
+    size_t count = 0;
+    ninja_error_t result = ninja_parse_orders(orders_json, strlen(orders_json), &orders, &count);
+    TEST_ASSERT(result == NINJA_OK && count == 2, "Order list decode failed");
+    TEST_ASSERT(orders[0].order_id == 3000000001LL, "Order id incorrect");
+    TEST_ASSERT(orders[0].account_id == 12345, "Account id incorrect");
+    TEST_ASSERT(orders[0].side == NINJA_SIDE_SELL, "Side incorrect");
+    TEST_ASSERT(orders[0].type == NINJA_ORDER_STOP_LIMIT, "Type incorrect");
+    TEST_ASSERT(orders[0].status == NINJA_ORDER_PARTIALLY_FILLED, "Status incorrect");
+    TEST_ASSERT(orders[0].quantity == 3 && orders[0].filled_quantity == 1, "Quantities incorrect");
+    TEST_ASSERT(orders[0].price == 4200.25 && orders[0].stop_price == 4201.0, "Prices incorrect");
+    TEST_ASSERT(orders[0].timestamp_ns == 1710513000250000000LL, "Timestamp not decoded");
+    TEST_ASSERT(strcmp(orders[0].timestamp, "2024-03-15T14:30:00.250Z") == 0, "Timestamp text not kept");
+    TEST_ASSERT(orders[0].is_automated, "isAutomated incorrect");
+    TEST_ASSERT(orders[1].order_id == 7 && orders[1].quantity == 1, "Out-of-order keys not decoded");
+    TEST_ASSERT(orders[1].type == NINJA_ORDER_TYPE_UNKNOWN, "Unknown type should stay unknown");
+    ninja_free_array(orders);
+
+    const char* accounts_json = "[{\"id\":5,\"name\":\"DEMO123\",\"legalStatus\":\"Simulation\",\"cashBalance\":1000.5}]";
+    ninja_account_t* accounts = NULL;
+    result = ninja_parse_accounts(accounts_json, strlen(accounts_json), &accounts, &count);
+    TEST_ASSERT(result == NINJA_OK && count == 1, "Account list decode failed");
+    TEST_ASSERT(strcmp(accounts[0].account_spec, "DEMO123") == 0, "Account spec not set from name");
+    TEST_ASSERT(strcmp(accounts[0].currency, "USD") == 0, "Currency default not applied");
+    TEST_ASSERT(accounts[0].is_demo && accounts[0].balance == 1000.5, "Account fields incorrect");
+    ninja_free_array(accounts);
+
+    const char* contracts_json = "[{\"id\":9,\"name\":\"ESM4\",\"tickSize\":0.25}]";
+    ninja_contract_t* contracts = NULL;
+    result = ninja_parse_contracts(contracts_json, strlen(contracts_json), &contracts, &count);
+    TEST_ASSERT(result == NINJA_OK && count == 1, "Contract list decode failed");
+    TEST_ASSERT(strcmp(contracts[0].symbol, "ESM4") == 0 && contracts[0].tick_size == 0.25, "Contract fields incorrect");
+    TEST_ASSERT(contracts[0].contract_multiplier == 1 && contracts[0].is_tradable, "Contract defaults not applied");
+    ninja_free_array(contracts);
+
+    const char* positions_json = "[{\"accountId\":5,\"contractId\":9,\"netPos\":-2,\"avgPrice\":4200.5}]";
+    ninja_position_t* positions = NULL;
+    result = ninja_parse_positions(positions_json, strlen(positions_json), &positions, &count);
+    TEST_ASSERT(result == NINJA_OK && count == 1, "Position list decode failed");
+    TEST_ASSERT(positions[0].contract_id == 9 && positions[0].net_position == -2, "Position fields incorrect");
+    ninja_free_array(positions);
+
+    result = ninja_parse_orders("{\"id\":1}", 8, &orders, &count);
+    TEST_ASSERT(result == NINJA_ERROR_JSON_PARSE, "Non-array response should be rejected");
+
+    TEST_PASS();
+}
+
+int test_contract_catalog() {
+    const char* path = "test_contract_catalog.bin";
+    remove(path);
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.contract_catalog_path = path;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with missing catalog should be created");
+
+    ninja_contract_t contracts[100];
+    memset(contracts, 0, sizeof(contracts));
+    for (int i = 0; i < 100; i++) {
+        contracts[i].contract_id = 1000 + i;
+        snprintf(contracts[i].symbol, sizeof(contracts[i].symbol), "SYM%d", i);
+        contracts[i].tick_size = 0.25;
+        contracts[i].contract_multiplier = 50;
+    }
+    TEST_ASSERT(ninja_add_catalog_contracts(client, contracts, 100) == NINJA_OK, "Adding contracts failed");
+    ninja_client_destroy(client);
+
+    // Lookups after a restart are served from the snapshot without a session
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with catalog should be created");
+
+    ninja_contract_t contract;
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT(ninja_get_contract_by_symbol(client, contracts[i].symbol, &contract) == NINJA_OK,
+                    "Symbol lookup missed");
+        TEST_ASSERT(contract.contract_id == contracts[i].contract_id, "Symbol lookup returned wrong contract");
+        TEST_ASSERT(ninja_get_contract_by_id(client, contracts[i].contract_id, &contract) == NINJA_OK,
+                    "Id lookup missed");
+        TEST_ASSERT(strcmp(contract.symbol, contracts[i].symbol) == 0, "Id lookup returned wrong contract");
+    }
+
+    // Updating a mapped catalog replaces the record in place
+    contracts[5].tick_size = 0.5;
+    TEST_ASSERT(ninja_add_catalog_contracts(client, &contracts[5], 1) == NINJA_OK, "Update failed");
+    TEST_ASSERT(ninja_get_contract_by_id(client, 1005, &contract) == NINJA_OK && contract.tick_size == 0.5,
+                "Update not visible");
+    TEST_ASSERT(ninja_save_contract_catalog(client) == NINJA_OK, "Save failed");
+    ninja_client_destroy(client);
+
+    // A snapshot with a corrupt index is discarded rather than trusted
+    FILE* file = fopen(path, "r+b");
+    TEST_ASSERT(file != NULL, "Snapshot not written");
+    fseek(file, -4, SEEK_END);
+    fputc('X', file);
+    fclose(file);
+
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with corrupt catalog should be created");
+    TEST_ASSERT(ninja_add_catalog_contracts(client, contracts, 1) == NINJA_OK, "Catalog unusable after corruption");
+    TEST_ASSERT(ninja_get_contract_by_id(client, 1000, &contract) == NINJA_OK, "Lookup after reset failed");
+    ninja_client_destroy(client);
+
+    client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(ninja_save_contract_catalog(client) == NINJA_ERROR_INVALID_PARAM, "Catalog should be disabled by default");
+    ninja_client_destroy(client);
+
+    remove(path);
+    TEST_PASS();
+}
+
+// Helper function to replace a fixture's contents
+static bool test_write_fixture(const char* path, const char* contents) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    fputs(contents, file);
+    return fclose(file) == 0;
+}
+
+#ifndef _WIN32
+// Helper function to build a file:// base URL that answers every endpoint with a fixture
+static bool test_fixture_url(const char* path, char* url, size_t url_size) {
+    char cwd[512];
+    if (!getcwd(cwd, sizeof(cwd))) {
+        return false;
+    }
+    int written = snprintf(url, url_size, "file://%s/%s?", cwd, path);
+    return written > 0 && (size_t)written < url_size;
+}
+#endif
+
+// Test local contract search over the catalog's prefix index
+int test_contract_search() {
+    const char* path = "test_contract_search.bin";
+    remove(path);
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.contract_catalog_path = path;
+    options.base_url = "http://127.0.0.1:1";
+    options.http_retries = 0;
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_contract_t contracts[4];
+    memset(contracts, 0, sizeof(contracts));
+    const char* symbols[4] = { "ESZ3", "ESH4", "MESZ3", "NQZ3" };
+    const char* full_names[4] = { "E-Mini S&P 500 Dec 2023", "E-Mini S&P 500 Mar 2024",
+                                  "Micro E-Mini S&P 500 Dec 2023", "E-Mini Nasdaq-100 Dec 2023" };
+    for (int i = 0; i < 4; i++) {
+        contracts[i].contract_id = 2000 + i;
+        strcpy(contracts[i].symbol, symbols[i]);
+        strcpy(contracts[i].name, symbols[i]);
+        strcpy(contracts[i].full_name, full_names[i]);
+    }
+    TEST_ASSERT(ninja_add_catalog_contracts(client, contracts, 4) == NINJA_OK, "Adding contracts failed");
+
+    ninja_contract_t* found = NULL;
+    size_t count = 0;
+    TEST_ASSERT(ninja_search_contracts(client, "es", 0, &found, &count) == NINJA_OK && count == 2 &&
+                found[0].contract_id == 2001 && found[1].contract_id == 2000, "Symbol prefix should match, sorted");
+    ninja_free_array(found);
+
+    // Symbol matches come before full_name word matches, each contract once
+    TEST_ASSERT(ninja_search_contracts(client, "MICRO", 0, &found, &count) == NINJA_OK && count == 1 &&
+                found[0].contract_id == 2002, "Full name should match from its first word");
+    ninja_free_array(found);
+    TEST_ASSERT(ninja_search_contracts(client, "s&p 500 d", 0, &found, &count) == NINJA_OK && count == 2 &&
+                found[0].contract_id == 2000 && found[1].contract_id == 2002, "Full name should match from any word");
+    ninja_free_array(found);
+    TEST_ASSERT(ninja_search_contracts(client, "me", 0, &found, &count) == NINJA_OK && count == 1 &&
+                found[0].contract_id == 2002, "Each contract should be returned once");
+    ninja_free_array(found);
+    TEST_ASSERT(ninja_search_contracts(client, "e", 2, &found, &count) == NINJA_OK && count == 2 &&
+                found[0].contract_id == 2001 && found[1].contract_id == 2000, "Search should stop at max");
+    ninja_free_array(found);
+    TEST_ASSERT(ninja_search_contracts(client, "ZZ", 0, &found, &count) == NINJA_OK && count == 0 && found == NULL,
+                "Unknown prefix should find nothing");
+
+    // Updates are searchable at once; find answers known prefixes locally
+    strcpy(contracts[3].symbol, "NQH4");
+    TEST_ASSERT(ninja_add_catalog_contracts(client, &contracts[3], 1) == NINJA_OK, "Update failed");
+    TEST_ASSERT(ninja_find_contracts(client, "nqh", &found, &count) == NINJA_OK && count == 1 &&
+                found[0].contract_id == 2003, "Find should use the catalog");
+    ninja_free_array(found);
+    TEST_ASSERT(ninja_find_contracts(client, "CL", &found, &count) == NINJA_ERROR_CONNECTION,
+                "Unknown prefix should go to the server");
+    ninja_client_destroy(client);
+
+#ifndef _WIN32
+    // A term the server has nothing for is not asked again, nor any longer one
+    const char* fixture = "test_contract_suggest.json";
+    char base_url[700];
+    TEST_ASSERT(test_write_fixture(fixture, "[]"), "Fixture creation failed");
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    options.base_url = base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+    TEST_ASSERT(ninja_find_contracts(client, "CL", &found, &count) == NINJA_OK && count == 0, "Empty suggest failed");
+    remove(fixture);
+    TEST_ASSERT(ninja_find_contracts(client, "clf", &found, &count) == NINJA_OK && count == 0,
+                "Known miss should be answered locally");
+
+    // Once the catalog changes the server is asked again
+    TEST_ASSERT(ninja_add_catalog_contracts(client, &contracts[0], 1) == NINJA_OK, "Update failed");
+    TEST_ASSERT(ninja_find_contracts(client, "clf", &found, &count) == NINJA_ERROR_CONNECTION,
+                "Misses should be forgotten when the catalog changes");
+    ninja_client_destroy(client);
+#endif
+
+    remove(path);
+    TEST_PASS();
+}
+
+int test_order_journal() {
+    const char* path = "test_order_journal.bin";
+    remove(path);
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.journal_path = path;
+    options.journal_capacity = 128;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with new journal should be created");
+
+    // Requests rejected locally never reach the journal
+    ninja_order_t order;
+    ninja_error_t result = ninja_place_order(client, "account", 123, "ES", NINJA_SIDE_BUY,
+                                             NINJA_ORDER_MARKET, 0, 0.0, 0.0, true, &order);
+    TEST_ASSERT(result == NINJA_ERROR_INVALID_PARAM, "Zero quantity should be rejected");
+
+    ninja_recovered_order_t* recovered = NULL;
+    size_t count = 1;
+    TEST_ASSERT(ninja_recover_orders(client, &recovered, &count) == NINJA_OK, "Recovery of empty journal failed");
+    TEST_ASSERT(count == 0 && recovered == NULL, "Empty journal should have nothing in flight");
+    TEST_ASSERT(ninja_sync_journal(client) == NINJA_OK, "Journal sync failed");
+    ninja_client_destroy(client);
+
+    // Reopening keeps the capacity the journal was created with
+    options.journal_capacity = 4096;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with existing journal should be created");
+    TEST_ASSERT(ninja_recover_orders(client, &recovered, &count) == NINJA_OK && count == 0, "Reopened journal not empty");
+    ninja_client_destroy(client);
+
+    // A file that is not a journal is never overwritten
+    FILE* file = fopen(path, "wb");
+    TEST_ASSERT(file != NULL, "Could not create test file");
+    fputs("not a journal", file);
+    fclose(file);
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client == NULL, "Foreign file should be refused");
+    file = fopen(path, "rb");
+    TEST_ASSERT(file != NULL && fseek(file, 0, SEEK_END) == 0 && ftell(file) == 13, "Foreign file was modified");
+    fclose(file);
+
+    client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(ninja_recover_orders(client, &recovered, &count) == NINJA_ERROR_INVALID_PARAM,
+                "Journal should be disabled by default");
+    ninja_client_destroy(client);
+    remove(path);
+
+#ifndef _WIN32
+    // Placements left in flight are recovered by their journaled clOrdId
+    const char* root = "test_recover";
+    mkdir(root, 0755);
+    mkdir("test_recover/command", 0755);
+    mkdir("test_recover/order", 0755);
+
+    char cwd[512];
+    char base_url[700];
+    TEST_ASSERT(getcwd(cwd, sizeof(cwd)) != NULL, "getcwd failed");
+    snprintf(base_url, sizeof(base_url), "file://%s/%s", cwd, root);
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    options.http_retries = 0;
+    options.journal_path = path;
+    options.journal_capacity = 128;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.account_spec, "account");
+    strcpy(request.symbol, "ES");
+    request.account_id = 7;
+    request.side = NINJA_SIDE_BUY;
+    request.type = NINJA_ORDER_LIMIT;
+    request.quantity = 1;
+    request.price = 4500.0;
+    strcpy(request.client_order_id, "recover-1");
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_CONNECTION,
+                "Unanswered placement should fail");
+    strcpy(request.client_order_id, "recover-2");
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_CONNECTION,
+                "Unanswered placement should fail");
+    ninja_client_destroy(client);
+
+    // Only the first placement reached the broker; a second order with the same terms is not it
+    TEST_ASSERT(test_write_fixture("test_recover/command/list",
+                                   "[{\"clOrdId\": \"recover-1\", \"orderId\": 42}]") &&
+                test_write_fixture("test_recover/order/ldeps",
+                                   "[{\"id\": 41, \"accountId\": 7, \"ordStatus\": \"Working\"},"
+                                   " {\"id\": 42, \"accountId\": 7, \"ordStatus\": \"Working\"}]"),
+                "Fixture creation failed");
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with existing journal should be created");
+    TEST_ASSERT(ninja_recover_orders(client, &recovered, &count) == NINJA_OK && count == 2, "Recovery failed");
+    TEST_ASSERT(!recovered[0].is_cancel && recovered[0].order_id == 42 &&
+                strcmp(recovered[0].request.client_order_id, "recover-1") == 0 &&
+                strcmp(recovered[0].order.client_order_id, "recover-1") == 0 &&
+                recovered[0].order.status == NINJA_ORDER_WORKING, "Placed order should be recovered by clOrdId");
+    TEST_ASSERT(recovered[1].order_id == 0 && strcmp(recovered[1].request.client_order_id, "recover-2") == 0,
+                "Placement the broker never saw should be reported lost");
+    free(recovered);
+    TEST_ASSERT(ninja_lookup_client_order(client, "recover-1", &order) == NINJA_OK && order.order_id == 42,
+                "Recovered order should be tracked under its clOrdId");
+    TEST_ASSERT(ninja_recover_orders(client, &recovered, &count) == NINJA_OK && count == 0,
+                "Recovered requests should not be reported again");
+    ninja_client_destroy(client);
+
+    remove("test_recover/command/list");
+    remove("test_recover/order/ldeps");
+    rmdir("test_recover/command");
+    rmdir("test_recover/order");
+    rmdir(root);
+    remove(path);
+#endif
+
+    TEST_PASS();
+}
+
+int test_shared_memory() {
+    char name[64];
+    snprintf(name, sizeof(name), "/ninja_test_%d", (int)time(NULL));
+    ninja_shm_remove(name);
+
+    TEST_ASSERT(ninja_shm_reader_open(name) == NULL, "Reader should not open a missing segment");
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.shm_name = name;
+    options.shm_position_capacity = 8;
+    options.shm_order_capacity = 8;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Publisher should be created");
+
+    ninja_position_t positions[3];
+    memset(positions, 0, sizeof(positions));
+    for (int i = 0; i < 3; i++) {
+        positions[i].account_id = 5;
+        positions[i].contract_id = 100 + i;
+        positions[i].net_position = i + 1;
+    }
+    TEST_ASSERT(ninja_publish_positions(client, positions, 3) == NINJA_OK, "Position publish failed");
+
+    ninja_shm_reader_t* reader = ninja_shm_reader_open(name);
+    TEST_ASSERT(reader != NULL, "Reader should attach");
+    uint64_t generation = ninja_shm_reader_generation(reader);
+
+    ninja_position_t position;
+    TEST_ASSERT(ninja_shm_read_position(reader, 5, 101, &position) == NINJA_OK, "Position read failed");
+    TEST_ASSERT(position.net_position == 2, "Position contents incorrect");
+    TEST_ASSERT(ninja_shm_read_position(reader, 5, 999, &position) == NINJA_ERROR_NOT_FOUND, "Missing position found");
+
+    // Updates replace the slot in place and bump the generation
+    positions[1].net_position = -7;
+    TEST_ASSERT(ninja_publish_positions(client, &positions[1], 1) == NINJA_OK, "Position update failed");
+    TEST_ASSERT(ninja_shm_reader_generation(reader) == generation + 1, "Generation not bumped");
+    TEST_ASSERT(ninja_shm_read_position(reader, 5, 101, &position) == NINJA_OK && position.net_position == -7,
+                "Position update not visible");
+
+    ninja_position_t* snapshot = NULL;
+    size_t count = 0;
+    TEST_ASSERT(ninja_shm_read_positions(reader, &snapshot, &count) == NINJA_OK && count == 3, "Snapshot incomplete");
+    ninja_free_array(snapshot);
+
+    ninja_order_t orders[9];
+    memset(orders, 0, sizeof(orders));
+    for (int i = 0; i < 9; i++) {
+        orders[i].order_id = 3000000000LL + i;
+        orders[i].quantity = i + 1;
+    }
+    TEST_ASSERT(ninja_publish_orders(client, orders, 8) == NINJA_OK, "Order publish failed");
+    TEST_ASSERT(ninja_publish_orders(client, &orders[8], 1) == NINJA_ERROR_MEMORY, "Capacity should be enforced");
+
+    ninja_order_t order;
+    TEST_ASSERT(ninja_shm_read_order(reader, 3000000004LL, &order) == NINJA_OK && order.quantity == 5,
+                "Order read failed");
+
+    // A full table makes room by evicting orders that can no longer change
+    orders[2].status = NINJA_ORDER_FILLED;
+    orders[5].status = NINJA_ORDER_CANCELLED;
+    TEST_ASSERT(ninja_publish_orders(client, orders, 8) == NINJA_OK, "Order update failed");
+    TEST_ASSERT(ninja_publish_orders(client, &orders[8], 1) == NINJA_OK, "Finished orders should be evicted");
+    TEST_ASSERT(ninja_shm_read_order(reader, 3000000002LL, &order) == NINJA_ERROR_NOT_FOUND &&
+                ninja_shm_read_order(reader, 3000000005LL, &order) == NINJA_ERROR_NOT_FOUND,
+                "Evicted orders should be gone");
+    for (int i = 0; i < 9; i++) {
+        if (i != 2 && i != 5) {
+            TEST_ASSERT(ninja_shm_read_order(reader, orders[i].order_id, &order) == NINJA_OK &&
+                        order.quantity == i + 1, "Live orders should survive eviction");
+        }
+    }
+    ninja_order_t* order_snapshot = NULL;
+    TEST_ASSERT(ninja_shm_read_orders(reader, &order_snapshot, &count) == NINJA_OK && count == 7,
+                "Order snapshot should hold the live orders");
+    ninja_free_array(order_snapshot);
+
+#ifndef _WIN32
+    // Positions closed between syncs leave the segment
+    ninja_client_destroy(client);
+    const char* fixture = "test_shm_positions.json";
+    char base_url[700];
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    options.base_url = base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Publisher should reopen the segment");
+
+    ninja_position_delta_t delta;
+    TEST_ASSERT(test_write_fixture(fixture, "[{\"accountId\": 6, \"contractId\": 200, \"netPos\": 1},"
+                                            " {\"accountId\": 6, \"contractId\": 201, \"netPos\": 2}]"),
+                "Fixture creation failed");
+    TEST_ASSERT(ninja_sync_positions(client, &delta) == NINJA_OK && delta.added == 2, "First sync failed");
+    ninja_free_array(delta.records);
+    TEST_ASSERT(ninja_shm_read_position(reader, 6, 200, &position) == NINJA_OK, "Synced position not published");
+
+    TEST_ASSERT(test_write_fixture(fixture, "[{\"accountId\": 6, \"contractId\": 201, \"netPos\": 2}]"),
+                "Fixture creation failed");
+    TEST_ASSERT(ninja_sync_positions(client, &delta) == NINJA_OK && delta.removed == 1, "Second sync failed");
+    ninja_free_array(delta.records);
+    TEST_ASSERT(ninja_shm_read_position(reader, 6, 200, &position) == NINJA_ERROR_NOT_FOUND,
+                "Closed position should leave the segment");
+    TEST_ASSERT(ninja_shm_read_position(reader, 6, 201, &position) == NINJA_OK && position.net_position == 2,
+                "Open position should stay");
+    remove(fixture);
+#endif
+
+    ninja_shm_reader_close(reader);
+    ninja_client_destroy(client);
+    TEST_ASSERT(ninja_shm_remove(name) == NINJA_OK, "Segment removal failed");
+
+    TEST_PASS();
+}
+
+// Completions seen by test_io_thread; written on the I/O thread, read after it is joined
+typedef struct {
+    int count;
+    bool in_order;
+    bool all_invalid;
+} test_completions_t;
+
+static void test_record_completion(const ninja_completion_t* completion, void* user_data) {
+    test_completions_t* seen = user_data;
+    seen->count++;
+    if (completion->request_id != (uint64_t)seen->count || completion->kind != NINJA_REQUEST_PLACE_ORDER) {
+        seen->in_order = false;
+    }
+    if (completion->result != NINJA_ERROR_INVALID_PARAM) {
+        seen->all_invalid = false;
+    }
+}
+
+int test_io_thread() {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+    uint64_t request_id = 0;
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    TEST_ASSERT(ninja_submit_order(client, &request, &request_id) == NINJA_ERROR_INVALID_PARAM,
+                "Submission should require the I/O thread");
+    ninja_client_destroy(client);
+
+    test_completions_t seen = { 0, true, true };
+    options.io_thread = true;
+    options.io_queue_capacity = 256;
+    options.completion_callback = test_record_completion;
+    options.completion_user_data = &seen;
+
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with I/O thread creation failed");
+
+    // Zero quantity fails validation on the I/O thread, so nothing touches the network
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT(ninja_submit_order(client, &request, &request_id) == NINJA_OK, "Submission failed");
+        TEST_ASSERT(request_id == (uint64_t)i + 1, "Request ids should follow submission order");
+    }
+    TEST_ASSERT(ninja_submit_cancel(client, 0, &request_id) == NINJA_ERROR_INVALID_PARAM, "Invalid cancel accepted");
+
+    // Destroy drains the queue before joining the thread
+    ninja_client_destroy(client);
+    TEST_ASSERT(seen.count == 100, "Every submitted request should complete");
+    TEST_ASSERT(seen.in_order, "Completions should arrive in submission order");
+    TEST_ASSERT(seen.all_invalid, "Completions should carry the request result");
+
+    TEST_PASS();
+}
+
+int test_list_delta() {
+    ninja_order_t previous[4];
+    ninja_order_t current[4];
+    memset(previous, 0, sizeof(previous));
+    memset(current, 0, sizeof(current));
+    for (int i = 0; i < 4; i++) {
+        previous[i].order_id = 100 + i;
+        previous[i].quantity = 1;
+        previous[i].status = NINJA_ORDER_WORKING;
+    }
+
+    // 100 unchanged, 101 filled, 102 gone, 103 unchanged, 104 new; current is out of id order
+    current[0] = previous[3];
+    current[1] = previous[1];
+    current[1].status = NINJA_ORDER_FILLED;
+    current[2] = previous[0];
+    current[3] = previous[0];
+    current[3].order_id = 104;
+
+    ninja_order_delta_t delta;
+    TEST_ASSERT(ninja_diff_orders(previous, 4, current, 4, &delta) == NINJA_OK, "Order diff failed");
+    TEST_ASSERT(delta.added == 1 && delta.changed == 1 && delta.removed == 1, "Order delta counts incorrect");
+    TEST_ASSERT(delta.records[0].order_id == 104, "Added order should come first");
+    TEST_ASSERT(delta.records[1].order_id == 101 && delta.records[1].status == NINJA_ORDER_FILLED,
+                "Changed order should carry its new state");
+    TEST_ASSERT(delta.records[2].order_id == 102 && delta.records[2].status == NINJA_ORDER_WORKING,
+                "Removed order should carry its last state");
+    ninja_free_array(delta.records);
+
+    TEST_ASSERT(ninja_diff_orders(previous, 4, previous, 4, &delta) == NINJA_OK, "Identical diff failed");
+    TEST_ASSERT(delta.added + delta.changed + delta.removed == 0 && delta.records == NULL,
+                "Identical snapshots should produce an empty delta");
+
+    // Positions are keyed by account and contract together
+    ninja_position_t positions[2];
+    memset(positions, 0, sizeof(positions));
+    positions[0].account_id = 1;
+    positions[0].contract_id = 7;
+    positions[1].account_id = 2;
+    positions[1].contract_id = 7;
+    ninja_position_delta_t position_delta;
+    TEST_ASSERT(ninja_diff_positions(positions, 1, positions, 2, &position_delta) == NINJA_OK, "Position diff failed");
+    TEST_ASSERT(position_delta.added == 1 && position_delta.records[0].account_id == 2, "Position delta incorrect");
+    ninja_free_array(position_delta.records);
+
+    ninja_account_t account;
+    memset(&account, 0, sizeof(account));
+    account.account_id = 9;
+    ninja_account_delta_t account_delta;
+    TEST_ASSERT(ninja_diff_accounts(&account, 1, NULL, 0, &account_delta) == NINJA_OK, "Account diff failed");
+    TEST_ASSERT(account_delta.removed == 1 && account_delta.records[0].account_id == 9, "Account delta incorrect");
+    ninja_free_array(account_delta.records);
+
+    TEST_PASS();
+}
+
+int test_transfer_stats() {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    TEST_ASSERT(options.compression, "Compression should be negotiated by default");
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_transfer_stats_t stats;
+    memset(&stats, 0xFF, sizeof(stats));
+    TEST_ASSERT(ninja_get_transfer_stats(client, &stats) == NINJA_OK, "Transfer stats failed");
+    TEST_ASSERT(stats.requests == 0 && stats.wire_bytes == 0 && stats.body_bytes == 0,
+                "A new client should have transferred nothing");
+    TEST_ASSERT(ninja_get_transfer_stats(NULL, &stats) == NINJA_ERROR_INVALID_PARAM, "NULL client accepted");
+
+    ninja_client_destroy(client);
+    TEST_PASS();
+}
+
+int test_order_batches() {
+    ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    // Invalid entries fail up front and never open a stream
+    ninja_order_id_t order_ids[3] = { 0, -5, 0 };
+    ninja_error_t results[3];
+    TEST_ASSERT(ninja_cancel_orders(client, order_ids, 3, results) == NINJA_ERROR_INVALID_PARAM,
+                "Batch with invalid cancels should fail");
+    TEST_ASSERT(results[0] == NINJA_ERROR_INVALID_PARAM && results[1] == NINJA_ERROR_INVALID_PARAM &&
+                results[2] == NINJA_ERROR_INVALID_PARAM, "Each invalid cancel should report its own error");
+
+    ninja_order_request_t requests[2];
+    ninja_order_t orders[2];
+    memset(requests, 0, sizeof(requests));
+    requests[0].side = NINJA_SIDE_UNKNOWN;
+    requests[0].quantity = 1;
+    TEST_ASSERT(ninja_place_orders(client, requests, 2, orders, results) == NINJA_ERROR_INVALID_PARAM,
+                "Batch with invalid orders should fail");
+    TEST_ASSERT(results[0] == NINJA_ERROR_INVALID_PARAM && results[1] == NINJA_ERROR_INVALID_PARAM,
+                "Each invalid order should report its own error");
+
+    TEST_ASSERT(ninja_cancel_orders(client, order_ids, 0, results) == NINJA_ERROR_INVALID_PARAM,
+                "Empty batch should be rejected");
+    TEST_ASSERT(ninja_submit_order_query(client, 1, NULL) == NINJA_ERROR_INVALID_PARAM,
+                "Queries should require the I/O thread");
+
+    ninja_client_destroy(client);
+    TEST_PASS();
+}
+
+int test_http_retries() {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    TEST_ASSERT(options.http_retries == 2 && options.retry_backoff_ms == 50 && options.retry_backoff_max_ms == 1000,
+                "Retry defaults should be set");
+    TEST_ASSERT(!options.hedge_gets, "Hedging should be opt-in");
+
+    // Nothing listens on port 1, so every attempt is refused before it is sent
+    options.base_url = "http://127.0.0.1:1";
+    options.retry_backoff_ms = 1;
+    options.retry_backoff_max_ms = 2;
+    options.hedge_gets = true;
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_account_t account;
+    TEST_ASSERT(ninja_get_account_by_id(client, 1, &account) == NINJA_ERROR_CONNECTION,
+                "Refused GET should fail after its retries");
+    TEST_ASSERT(ninja_cancel_order(client, 1) == NINJA_ERROR_CONNECTION,
+                "Refused cancel should fail after its retries");
+
+    // A placement that never got an answer is looked up, not resent
+    ninja_order_request_t request;
+    ninja_order_t order;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.account_spec, "DEMO");
+    strcpy(request.symbol, "ESZ5");
+    request.side = NINJA_SIDE_BUY;
+    request.type = NINJA_ORDER_MARKET;
+    request.quantity = 1;
+    strcpy(request.client_order_id, "test-1");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_CONNECTION,
+                "Refused placement should fail");
+    TEST_ASSERT(order.order_id == 0, "Unconfirmed placement should not report an order");
+
+    ninja_transfer_stats_t stats;
+    TEST_ASSERT(ninja_get_transfer_stats(client, &stats) == NINJA_OK && stats.requests == 0,
+                "Refused attempts should not count as transfers");
+    ninja_client_destroy(client);
+
+    // Batched requests retry one by one: each refused cancel is sent 1 + http_retries times
+    const char* log_path = "test_retries.log";
+    remove(log_path);
+    options.hedge_gets = false;
+    options.debug_mode = true;
+    options.debug_log_path = log_path;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with debug log creation failed");
+
+    ninja_order_id_t order_ids[2] = { 1, 2 };
+    ninja_error_t results[2];
+    TEST_ASSERT(ninja_cancel_orders(client, order_ids, 2, results) == NINJA_ERROR_CONNECTION &&
+                results[0] == NINJA_ERROR_CONNECTION && results[1] == NINJA_ERROR_CONNECTION,
+                "Refused batch should fail after its retries");
+    ninja_client_destroy(client);
+
+    char log[8192];
+    FILE* file = fopen(log_path, "r");
+    TEST_ASSERT(file != NULL, "Debug log missing");
+    size_t length = fread(log, 1, sizeof(log) - 1, file);
+    fclose(file);
+    remove(log_path);
+    log[length] = '\0';
+    int retries = 0;
+    for (const char* line = strstr(log, "retrying"); line; line = strstr(line + 1, "retrying")) {
+        retries++;
+    }
+    TEST_ASSERT(retries == 4 && strstr(log, "order/cancelorder failed: ") != NULL &&
+                strstr(log, "retrying (attempt 2)") != NULL, "Each cancel of the batch should be retried twice");
+
+#ifndef _WIN32
+    // A file:// tree with no order/placeorder: the lost placement is found by its clOrdId
+    const char* root = "test_reconcile";
+    mkdir(root, 0755);
+    mkdir("test_reconcile/command", 0755);
+    mkdir("test_reconcile/order", 0755);
+    TEST_ASSERT(test_write_fixture("test_reconcile/command/list",
+                                   "[{\"clOrdId\": \"test-3\", \"orderId\": 41}, {\"clOrdId\": \"test-2\", \"orderId\": 42}]") &&
+                test_write_fixture("test_reconcile/order/item",
+                                   "{\"id\": 42, \"accountId\": 1, \"ordStatus\": \"Working\"}"),
+                "Fixture creation failed");
+
+    char cwd[512];
+    char base_url[700];
+    TEST_ASSERT(getcwd(cwd, sizeof(cwd)) != NULL, "getcwd failed");
+    snprintf(base_url, sizeof(base_url), "file://%s/%s", cwd, root);
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    options.http_retries = 0;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    strcpy(request.client_order_id, "test-2");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_OK && order.order_id == 42 &&
+                strcmp(order.client_order_id, "test-2") == 0, "Reconciled placement should succeed");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(ninja_lookup_client_order(client, "test-2", &order) == NINJA_OK && order.order_id == 42 &&
+                order.status == NINJA_ORDER_WORKING, "Reconciled placement should be tracked");
+
+    // An answer that does not parse is reconciled the same way
+    TEST_ASSERT(test_write_fixture("test_reconcile/order/placeorder", "<html>Bad Gateway</html>") &&
+                test_write_fixture("test_reconcile/order/item",
+                                   "{\"id\": 41, \"accountId\": 1, \"ordStatus\": \"Working\"}"),
+                "Fixture creation failed");
+    strcpy(request.client_order_id, "test-3");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_OK && order.order_id == 41 &&
+                strcmp(order.client_order_id, "test-3") == 0, "Unparseable answer should be reconciled");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(ninja_lookup_client_order(client, "test-3", &order) == NINJA_OK && order.order_id == 41,
+                "Reconciled placement should not stay pending");
+    ninja_client_destroy(client);
+
+    remove("test_reconcile/command/list");
+    remove("test_reconcile/order/item");
+    remove("test_reconcile/order/placeorder");
+    rmdir("test_reconcile/command");
+    rmdir("test_reconcile/order");
+    rmdir(root);
+#endif
+
+    TEST_PASS();
+}
+
+static void test_record_client_order(const ninja_completion_t* completion, void* user_data) {
+    char* client_order_id = (char*)user_data;
+    memcpy(client_order_id, completion->client_order_id, NINJA_CLIENT_ORDER_ID_SIZE);
+}
+
+int test_client_order_ids() {
+    char completed[NINJA_CLIENT_ORDER_ID_SIZE] = { 0 };
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = "http://127.0.0.1:1";
+    options.http_retries = 0;
+    options.io_thread = true;
+    options.completion_callback = test_record_client_order;
+    options.completion_user_data = completed;
+
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    char first[NINJA_CLIENT_ORDER_ID_SIZE];
+    char second[NINJA_CLIENT_ORDER_ID_SIZE];
+    TEST_ASSERT(ninja_next_client_order_id(client, first, sizeof(first)) == NINJA_OK &&
+                ninja_next_client_order_id(client, second, sizeof(second)) == NINJA_OK, "Id generation failed");
+    TEST_ASSERT(first[0] != '\0' && strcmp(first, second) < 0, "Client order ids should increase");
+    TEST_ASSERT(ninja_next_client_order_id(client, first, 8) == NINJA_ERROR_INVALID_PARAM,
+                "Short buffers should be rejected");
+
+    // The clOrdId is known before the I/O thread has run the request
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    char client_order_id[NINJA_CLIENT_ORDER_ID_SIZE];
+    uint64_t request_id = 0;
+    TEST_ASSERT(ninja_submit_order_with_id(client, &request, client_order_id, &request_id) == NINJA_OK,
+                "Submission failed");
+    TEST_ASSERT(client_order_id[0] != '\0', "Submission should return a clOrdId");
+
+    ninja_order_t order;
+    TEST_ASSERT(ninja_lookup_client_order(client, "unknown", &order) == NINJA_ERROR_NOT_FOUND,
+                "Unknown clOrdId should not be found");
+
+    // A placement without an answer stays pending under the caller's clOrdId
+    strcpy(request.account_spec, "DEMO");
+    strcpy(request.symbol, "ESZ5");
+    request.side = NINJA_SIDE_SELL;
+    request.type = NINJA_ORDER_LIMIT;
+    request.quantity = 2;
+    request.price = 5000.25;
+    strcpy(request.client_order_id, "strategy-7");
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_CONNECTION,
+                "Refused placement should fail");
+    TEST_ASSERT(ninja_lookup_client_order(client, "strategy-7", &order) == NINJA_OK, "Placement not tracked");
+    TEST_ASSERT(order.status == NINJA_ORDER_PENDING && order.order_id == 0 && order.quantity == 2 &&
+                order.price == 5000.25, "Unanswered placement should be pending with the request's terms");
+
+    // Destroy drains the queue; the invalid submission completes under its clOrdId
+    ninja_client_destroy(client);
+    TEST_ASSERT(strcmp(completed, client_order_id) == 0, "Completion should carry the clOrdId");
+
+#ifndef _WIN32
+    // Refused placements make room for new ones instead of piling up
+    const char* fixture = "test_client_order_rejects.json";
+    char base_url[700];
+    TEST_ASSERT(test_write_fixture(fixture, "{\"errorText\": \"Insufficient margin\"}"), "Fixture creation failed");
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+    for (int i = 0; i < 200; i++) {
+        snprintf(request.client_order_id, sizeof(request.client_order_id), "reject-%d", i);
+        TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_ORDER_REJECTED,
+                    "Placement should be refused");
+    }
+    TEST_ASSERT(ninja_lookup_client_order(client, "reject-0", &order) == NINJA_ERROR_NOT_FOUND,
+                "Old refused placements should be dropped");
+    TEST_ASSERT(ninja_lookup_client_order(client, "reject-199", &order) == NINJA_OK &&
+                order.status == NINJA_ORDER_REJECTED, "Latest refused placement should be kept");
+    ninja_client_destroy(client);
+    remove(fixture);
+#endif
+
+    TEST_PASS();
+}
+
+int test_order_templates() {
+    ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_order_request_t prototype;
+    memset(&prototype, 0, sizeof(prototype));
+    strcpy(prototype.account_spec, "DEMO");
+    prototype.account_id = 7;
+    strcpy(prototype.symbol, "ESZ5");
+    prototype.side = NINJA_SIDE_BUY;
+    prototype.type = NINJA_ORDER_LIMIT;
+    prototype.is_automated = true;
+
+    ninja_order_template_t* limit = NULL;
+    TEST_ASSERT(ninja_order_template_create(client, &prototype, &limit) == NINJA_OK && limit, "Template creation failed");
+
+    const char* body = NULL;
+    size_t length = 0;
+    TEST_ASSERT(ninja_order_template_render(client, limit, 3, 5000.25, 0.0, &body, &length) == NINJA_OK,
+                "Render failed");
+    TEST_ASSERT(strlen(body) == length && body[0] == '{' && body[length - 1] == '}', "Body should be one object");
+    TEST_ASSERT(strstr(body, "\"symbol\":\"ESZ5\"") && strstr(body, "\"orderQty\":3 ") &&
+                strstr(body, "\"price\":5000.25 ") && strstr(body, "\"clOrdId\":\"nt"), "Slots should be patched");
+    TEST_ASSERT(!strstr(body, "stopPrice"), "Limit templates should not send a stop price");
+
+    // Patching never changes the layout
+    char first_body[512];
+    strcpy(first_body, body);
+    TEST_ASSERT(ninja_order_template_render(client, limit, 12, -1.125, 0.0, &body, &length) == NINJA_OK &&
+                length == strlen(first_body), "Render should keep the length");
+    TEST_ASSERT(strstr(body, "\"orderQty\":12 ") && strstr(body, "\"price\":-1.125 "), "Slots should be re-patched");
+    TEST_ASSERT(strcmp(body, first_body) != 0, "Each render should carry a new clOrdId");
+
+    TEST_ASSERT(ninja_order_template_render(client, limit, 0, 1.0, 0.0, &body, &length) == NINJA_ERROR_INVALID_PARAM,
+                "Zero quantity should be rejected");
+    TEST_ASSERT(ninja_order_template_render(client, limit, 1, 1e12, 0.0, &body, &length) == NINJA_ERROR_INVALID_PARAM,
+                "Prices beyond the slot should be rejected");
+    TEST_ASSERT(ninja_order_template_render(client, limit, 1, 9223372036.0, 0.0, &body, &length) == NINJA_OK &&
+                strstr(body, "\"price\":9223372036 "), "Largest price should render whole");
+    TEST_ASSERT(ninja_order_template_render(client, limit, 1, -9223372036.0, 0.0, &body, &length) == NINJA_OK &&
+                strstr(body, "\"price\":-9223372036 "), "Most negative price should render whole");
+    TEST_ASSERT(ninja_order_template_render(client, limit, 1, 9223372037.0, 0.0, &body, &length) == NINJA_ERROR_INVALID_PARAM &&
+                ninja_order_template_render(client, limit, 1, -9223372037.0, 0.0, &body, &length) == NINJA_ERROR_INVALID_PARAM,
+                "Prices past the scaled range should be rejected");
+    ninja_order_template_free(limit);
+
+    ninja_order_template_t* stop_limit = NULL;
+    prototype.type = NINJA_ORDER_STOP_LIMIT;
+    TEST_ASSERT(ninja_order_template_create(client, &prototype, &stop_limit) == NINJA_OK, "Template creation failed");
+    TEST_ASSERT(ninja_order_template_render(client, stop_limit, 1, 4990.0, 4991.75, &body, &length) == NINJA_OK &&
+                strstr(body, "\"price\":4990 ") && strstr(body, "\"stopPrice\":4991.75 "), "Stop limit should send both prices");
+    ninja_order_template_free(stop_limit);
+
+    prototype.side = NINJA_SIDE_UNKNOWN;
+    TEST_ASSERT(ninja_order_template_create(client, &prototype, &limit) == NINJA_ERROR_INVALID_PARAM,
+                "Invalid side should be rejected");
+
+    ninja_client_destroy(client);
+    TEST_PASS();
+}
+
+int test_library_context() {
+    // A cleanup without a matching init must not pull state from live clients
+    ninja_client_t* first = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(first != NULL, "Client creation failed");
+    ninja_library_cleanup();
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = "http://127.0.0.1:1";
+    options.http_retries = 0;
+    ninja_client_t* second = ninja_client_create_with_options(&options);
+    TEST_ASSERT(second != NULL, "Client creation failed");
+    ninja_client_destroy(first);
+
+    ninja_account_t account;
+    TEST_ASSERT(ninja_get_account_by_id(second, 1, &account) == NINJA_ERROR_CONNECTION,
+                "Surviving client should still make requests");
+    ninja_client_destroy(second);
+
+    // Held across many short-lived clients
+    TEST_ASSERT(ninja_library_init() == NINJA_OK && ninja_library_init() == NINJA_OK, "Library init failed");
+    for (int i = 0; i < 200; i++) {
+        ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+        TEST_ASSERT(client != NULL, "Client creation failed");
+        ninja_client_destroy(client);
+    }
+    ninja_library_cleanup();
+    ninja_library_cleanup();
+
+    TEST_PASS();
+}
+
+int test_session_manager() {
+    ninja_client_options_t client_options;
+    ninja_client_options_init(&client_options, NINJA_ENV_DEMO);
+    client_options.base_url = "http://127.0.0.1:1";
+    client_options.http_retries = 0;
+    client_options.io_thread = true;
+
+    ninja_session_options_t options;
+    ninja_session_options_init(&options);
+    options.client = &client_options;
+    ninja_session_manager_t* manager = ninja_session_manager_create(&options);
+    TEST_ASSERT(manager != NULL, "Session manager creation failed");
+
+    ninja_auth_response_t auth;
+    memset(&auth, 0, sizeof(auth));
+    ninja_session_id_t sessions[3];
+    TEST_ASSERT(ninja_session_add(manager, &auth, &sessions[0]) == NINJA_ERROR_INVALID_PARAM,
+                "Session without a token should be rejected");
+    for (int i = 0; i < 3; i++) {
+        snprintf(auth.access_token, sizeof(auth.access_token), "token-%d", i);
+        auth.user_id = 100 + i;
+        TEST_ASSERT(ninja_session_add(manager, &auth, &sessions[i]) == NINJA_OK, "Session add failed");
+        TEST_ASSERT(sessions[i] != 0, "Session handle should be non-zero");
+    }
+    TEST_ASSERT(sessions[0] != sessions[1] && sessions[1] != sessions[2], "Session handles should differ");
+
+    // Every session routes through the same client
+    ninja_client_t* first = ninja_session_client(manager, sessions[0]);
+    ninja_client_t* second = ninja_session_client(manager, sessions[1]);
+    TEST_ASSERT(first != NULL && first == second, "Sessions should share one client");
+
+    ninja_session_info_t info[3];
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT(ninja_session_get_info(manager, sessions[i], &info[i]) == NINJA_OK, "Session info failed");
+        TEST_ASSERT(info[i].user_id == 100 + i, "Session should keep its user id");
+        TEST_ASSERT(info[i].renew_at_ns <= info[i].expires_at_ns - options.renew_before_s * 1000000000LL &&
+                    info[i].renew_at_ns > info[i].expires_at_ns - (options.renew_before_s + options.renew_spread_s) * 1000000000LL,
+                    "Renewal should fall in the spread window");
+    }
+    TEST_ASSERT(info[0].renew_at_ns - info[0].expires_at_ns != info[1].renew_at_ns - info[1].expires_at_ns ||
+                info[1].renew_at_ns - info[1].expires_at_ns != info[2].renew_at_ns - info[2].expires_at_ns,
+                "Renewals should be staggered");
+
+    ninja_account_t account;
+    TEST_ASSERT(ninja_get_account_by_id(ninja_session_client(manager, sessions[2]), 1, &account) == NINJA_ERROR_CONNECTION,
+                "Session request should reach the transport");
+
+    // Closed handles stay invalid after their slot is reused
+    TEST_ASSERT(ninja_session_close(manager, sessions[1]) == NINJA_OK, "Session close failed");
+    TEST_ASSERT(ninja_session_client(manager, sessions[1]) == NULL, "Closed session should not route");
+    TEST_ASSERT(ninja_session_close(manager, sessions[1]) == NINJA_ERROR_NOT_FOUND, "Double close should fail");
+    ninja_session_id_t reused;
+    auth.expires_in = 1;
+    TEST_ASSERT(ninja_session_add(manager, &auth, &reused) == NINJA_OK && reused != sessions[1],
+                "Reused slot should get a new handle");
+    TEST_ASSERT(ninja_session_get_info(manager, sessions[1], &info[0]) == NINJA_ERROR_NOT_FOUND,
+                "Stale handle should not resolve");
+
+    // The short-lived session is due at once; its failed renewal is deferred
+    size_t renewed = 0;
+    TEST_ASSERT(ninja_session_renew_due(manager, 8, &renewed) == NINJA_ERROR_CONNECTION && renewed == 0,
+                "Due renewal should be attempted");
+    TEST_ASSERT(ninja_session_renew_due(manager, 8, &renewed) == NINJA_OK && renewed == 0,
+                "Failed renewal should wait before retrying");
+
+    ninja_session_manager_destroy(manager);
+    TEST_PASS();
+}
+
+int test_chart_download() {
+    char text[NINJA_TIMESTAMP_TEXT_SIZE];
+    int64_t parsed = 0;
+    TEST_ASSERT(ninja_format_timestamp(1700000000123456789LL, text, sizeof(text)) == NINJA_OK &&
+                strcmp(text, "2023-11-14T22:13:20.123Z") == 0, "Timestamp formatting failed");
+    TEST_ASSERT(ninja_parse_timestamp(text, strlen(text), &parsed) == NINJA_OK && parsed == 1700000000123000000LL,
+                "Formatted timestamp should parse back");
+    TEST_ASSERT(ninja_format_timestamp(-1, text, sizeof(text)) == NINJA_OK &&
+                strcmp(text, "1969-12-31T23:59:59.999Z") == 0, "Pre-epoch formatting failed");
+
+    const char* path = "test_chart_bars.col";
+    const char* fixture = "test_chart_response.json";
+    remove(path);
+
+    // Bars every 8 hours over 80 hours, newest first across two packets
+    const int64_t hour_ns = 3600000000000LL;
+    const int64_t from_ns = 1700006400000000000LL;
+    char json[4096];
+    size_t used = (size_t)snprintf(json, sizeof(json), "{\"charts\":[");
+    for (int k = 10; k >= 0; k--) {
+        ninja_format_timestamp(from_ns + k * 8 * hour_ns, text, sizeof(text));
+        used += (size_t)snprintf(json + used, sizeof(json) - used, "%s{\"timestamp\":\"%s\",\"open\":%d.25,\"high\":%d.5,\"low\":%d,\"close\":%d.75,"
+                      "\"upVolume\":%d,\"downVolume\":%d}",
+                k == 10 ? "{\"id\":1,\"bars\":[" : k == 4 ? "]},{\"id\":2,\"bars\":[" : ",", text,
+                4000 + k, 4001 + k, 3999 + k, 4000 + k, 10 * k, 5);
+    }
+    snprintf(json + used, sizeof(json) - used, "]}]}");
+    TEST_ASSERT(test_write_fixture(fixture, json), "Fixture creation failed");
+
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = "http://127.0.0.1:1";
+    options.md_base_url = "http://127.0.0.1:1";
+    options.http_retries = 0;
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    ninja_chart_request_t request;
+    memset(&request, 0, sizeof(request));
+    request.symbol = "ESZ3";
+    request.type = NINJA_CHART_MINUTE_BARS;
+    request.element_size = 480;
+    request.from_ns = from_ns;
+    request.to_ns = from_ns + 72 * hour_ns;
+    request.chunk_ns = 24 * hour_ns;
+    request.parallel_requests = 2;
+
+    uint64_t records = 1;
+    TEST_ASSERT(ninja_download_chart(client, &request, path, &records) == NINJA_ERROR_CONNECTION && records == 0,
+                "Unreachable endpoint should fail the download");
+    int64_t* timestamps = NULL;
+    size_t count = 1;
+    TEST_ASSERT(ninja_read_column_int64(path, "timestamp_ns", &timestamps, &count) == NINJA_OK && count == 0,
+                "Failed download should leave an empty file");
+    ninja_free_array(timestamps);
+    TEST_ASSERT(ninja_read_column_int64(path, "bogus", &timestamps, &count) == NINJA_ERROR_NOT_FOUND,
+                "Unknown column should not be found");
+    double* values = NULL;
+    TEST_ASSERT(ninja_read_column_double(path, "volume", &values, &count) == NINJA_ERROR_INVALID_PARAM,
+                "Column type should be checked");
+
+    request.type = NINJA_CHART_TICKS;
+    TEST_ASSERT(ninja_download_chart(client, &request, path, &records) == NINJA_ERROR_INVALID_PARAM,
+                "File with other columns should be refused");
+    request.type = NINJA_CHART_MINUTE_BARS;
+    ninja_client_destroy(client);
+
+#ifndef _WIN32
+    // Every chunk is answered with the whole fixture; each keeps its own range
+    char md_base_url[700];
+    TEST_ASSERT(test_fixture_url(fixture, md_base_url, sizeof(md_base_url)), "Fixture URL failed");
+    options.md_base_url = md_base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    TEST_ASSERT(ninja_download_chart(client, &request, path, &records) == NINJA_OK && records == 9,
+                "Download should keep the bars in range");
+    request.from_ns = request.to_ns;
+    request.to_ns = from_ns + 80 * hour_ns + 1;
+    TEST_ASSERT(ninja_download_chart(client, &request, path, &records) == NINJA_OK && records == 2,
+                "Second download should append");
+    ninja_client_destroy(client);
+
+    TEST_ASSERT(ninja_read_column_int64(path, "timestamp_ns", &timestamps, &count) == NINJA_OK && count == 11,
+                "Column read failed");
+    int64_t* volumes = NULL;
+    TEST_ASSERT(ninja_read_column_int64(path, "volume", &volumes, &count) == NINJA_OK && count == 11,
+                "Column read failed");
+    TEST_ASSERT(ninja_read_column_double(path, "open", &values, &count) == NINJA_OK && count == 11,
+                "Column read failed");
+    for (size_t k = 0; k < count; k++) {
+        TEST_ASSERT(timestamps[k] == from_ns + (int64_t)k * 8 * hour_ns, "Rows should be in timestamp order");
+        TEST_ASSERT(values[k] == 4000.25 + (double)k && volumes[k] == 10 * (int64_t)k + 5, "Row values mismatch");
+    }
+    ninja_free_array(timestamps);
+    ninja_free_array(volumes);
+    ninja_free_array(values);
+#endif
+
+    remove(fixture);
+    remove(path);
+    TEST_PASS();
+}
+
+int test_bar_aggregator() {
+    const int64_t second_ns = 1000000000LL;
+    ninja_bar_series_t series[3] = {
+        { NINJA_BAR_TIME, 60 * second_ns },
+        { NINJA_BAR_TICKS, 3 },
+        { NINJA_BAR_VOLUME, 10 }
+    };
+    ninja_bar_series_t invalid = { NINJA_BAR_TICKS, 0 };
+    TEST_ASSERT(ninja_bar_aggregator_create(&invalid, 1) == NULL, "Empty bar size should be rejected");
+
+    ninja_bar_aggregator_t* aggregator = ninja_bar_aggregator_create(series, 3);
+    TEST_ASSERT(aggregator != NULL, "Aggregator creation failed");
+
+    ninja_trade_t trades[4] = {
+        { 0, 100.0, 4, 1 },
+        { 5 * second_ns, 50.0, 1, 2 },
+        { 10 * second_ns, 101.0, 4, 1 },
+        { 20 * second_ns, 99.0, 4, 1 }
+    };
+    TEST_ASSERT(ninja_bar_add_trades(aggregator, trades, 4) == NINJA_OK, "Adding trades failed");
+
+    // The third trade completes the tick bar and overfills the volume bar
+    ninja_bar_t bars[8];
+    size_t count = 0;
+    TEST_ASSERT(ninja_bar_drain(aggregator, bars, 8, &count) == NINJA_OK && count == 2, "Two bars should be complete");
+    TEST_ASSERT(bars[0].contract_id == 1 && bars[0].series == 1 && bars[0].trades == 3 && bars[0].volume == 12 &&
+                bars[0].open == 100.0 && bars[0].high == 101.0 && bars[0].low == 99.0 && bars[0].close == 99.0,
+                "Tick bar mismatch");
+    TEST_ASSERT(bars[1].series == 2 && bars[1].volume == 10 && bars[1].end_ns == 20 * second_ns,
+                "Volume bar should be filled exactly");
+
+    ninja_bar_t bar;
+    TEST_ASSERT(ninja_bar_current(aggregator, 1, 2, &bar) == NINJA_OK && bar.volume == 2 && bar.open == 99.0,
+                "Volume bar should carry the remainder");
+    TEST_ASSERT(ninja_bar_current(aggregator, 1, 1, &bar) == NINJA_ERROR_NOT_FOUND, "Tick bar should be closed");
+    TEST_ASSERT(ninja_bar_current(aggregator, 99, 0, &bar) == NINJA_ERROR_NOT_FOUND, "Unknown contract has no bar");
+
+    // A trade past the minute closes it
+    TEST_ASSERT(ninja_bar_add_trade(aggregator, 1, 65 * second_ns, 102.0, 1) == NINJA_OK, "Adding trade failed");
+    TEST_ASSERT(ninja_bar_drain(aggregator, bars, 8, &count) == NINJA_OK && count == 1, "Time bar should be complete");
+    TEST_ASSERT(bars[0].series == 0 && bars[0].start_ns == 0 && bars[0].end_ns == 60 * second_ns &&
+                bars[0].volume == 12 && bars[0].close == 99.0, "Time bar mismatch");
+
+    // Flushing closes minutes that ended without a later trade
+    TEST_ASSERT(ninja_bar_flush(aggregator, 120 * second_ns) == NINJA_OK, "Flush failed");
+    TEST_ASSERT(ninja_bar_drain(aggregator, bars, 8, &count) == NINJA_OK && count == 2, "Flush should close two bars");
+    TEST_ASSERT(bars[0].contract_id == 1 && bars[0].start_ns == 60 * second_ns && bars[0].open == 102.0,
+                "Flushed bar mismatch");
+    TEST_ASSERT(bars[1].contract_id == 2 && bars[1].start_ns == 0 && bars[1].volume == 1, "Flushed bar mismatch");
+    ninja_bar_aggregator_destroy(aggregator);
+
+    // Many contracts, one bar per trade
+    ninja_bar_series_t every_trade = { NINJA_BAR_TICKS, 1 };
+    aggregator = ninja_bar_aggregator_create(&every_trade, 1);
+    TEST_ASSERT(aggregator != NULL, "Aggregator creation failed");
+    for (int i = 0; i < 3000; i++) {
+        TEST_ASSERT(ninja_bar_add_trade(aggregator, 1000 + i % 1000, i, 10.0 + i, 1) == NINJA_OK, "Adding trade failed");
+    }
+    size_t total = 0;
+    do {
+        TEST_ASSERT(ninja_bar_drain(aggregator, bars, 8, &count) == NINJA_OK, "Drain failed");
+        for (size_t i = 0; i < count; i++) {
+            TEST_ASSERT(bars[i].contract_id == 1000 + (int)(total + i) % 1000 && bars[i].open == 10.0 + (double)(total + i),
+                        "Bars should drain oldest first");
+        }
+        total += count;
+    } while (count > 0);
+    TEST_ASSERT(total == 3000, "Every trade should complete a bar");
+    ninja_bar_aggregator_destroy(aggregator);
+
+    TEST_PASS();
+}
+
+// Test columnar views and export of orders, fills and positions
+int test_columnar_export() {
+    ninja_order_t orders[3];
+    memset(orders, 0, sizeof(orders));
+    const char* symbols[3] = { "ESZ3", "NQZ3", "ESZ3" };
+    for (int i = 0; i < 3; i++) {
+        orders[i].order_id = 3000000001LL + i;
+        orders[i].account_id = 12345;
+        strcpy(orders[i].symbol, symbols[i]);
+        orders[i].side = i == 1 ? NINJA_SIDE_SELL : NINJA_SIDE_BUY;
+        orders[i].status = NINJA_ORDER_FILLED;
+        orders[i].quantity = 2 + i;
+        orders[i].filled_quantity = 2 + i;
+        orders[i].filled_price = 4500.25 + i;
+        orders[i].timestamp_ns = 1700000000000000000LL + i;
+    }
+
+    ninja_order_columns_t columns;
+    TEST_ASSERT(ninja_orders_to_columns(orders, 3, &columns) == NINJA_OK, "Order columns failed");
+    TEST_ASSERT(columns.count == 3 && columns.symbol_count == 2, "Symbols should be stored once");
+    TEST_ASSERT(columns.symbol[0] == columns.symbol[2] && columns.symbol[0] != columns.symbol[1] &&
+                strcmp(columns.symbols[columns.symbol[1]], "NQZ3") == 0, "Symbol codes mismatch");
+    TEST_ASSERT(columns.order_id[2] == 3000000003LL && columns.filled_quantity[1] == 3 &&
+                columns.side[1] == NINJA_SIDE_SELL && columns.filled_price[2] == 4502.25, "Order columns mismatch");
+    ninja_free_array(columns.storage);
+    TEST_ASSERT(ninja_orders_to_columns(NULL, 0, &columns) == NINJA_OK && columns.count == 0 &&
+                columns.storage == NULL, "Empty list should give an empty view");
+
+    const char* path = "test_orders.col";
+    remove(path);
+    TEST_ASSERT(ninja_export_orders(path, orders, 3) == NINJA_OK, "Order export failed");
+    TEST_ASSERT(ninja_export_orders(path, orders + 1, 1) == NINJA_OK, "Second export should append");
+
+    char (*text)[NINJA_COLUMN_TEXT_SIZE] = NULL;
+    int32_t* quantities = NULL;
+    uint8_t* sides = NULL;
+    int64_t* ids = NULL;
+    size_t count = 0;
+    TEST_ASSERT(ninja_read_column_text(path, "symbol", &text, &count) == NINJA_OK && count == 4 &&
+                strcmp(text[0], "ESZ3") == 0 && strcmp(text[2], "ESZ3") == 0 && strcmp(text[3], "NQZ3") == 0,
+                "Symbol column mismatch");
+    ninja_free_array(text);
+    TEST_ASSERT(ninja_read_column_int32(path, "filled_quantity", &quantities, &count) == NINJA_OK && count == 4 &&
+                quantities[0] == 2 && quantities[3] == 3, "Quantity column mismatch");
+    ninja_free_array(quantities);
+    TEST_ASSERT(ninja_read_column_uint8(path, "side", &sides, &count) == NINJA_OK && count == 4 &&
+                sides[1] == NINJA_SIDE_SELL && sides[2] == NINJA_SIDE_BUY, "Side column mismatch");
+    ninja_free_array(sides);
+    TEST_ASSERT(ninja_read_column_int64(path, "order_id", &ids, &count) == NINJA_OK && count == 4 &&
+                ids[3] == 3000000002LL, "Order id column mismatch");
+    ninja_free_array(ids);
+    TEST_ASSERT(ninja_read_column_int32(path, "side", &quantities, &count) == NINJA_ERROR_INVALID_PARAM,
+                "Column type should be checked");
+
+    // A different list cannot be appended to an order file
+    ninja_fill_t fills[2];
+    memset(fills, 0, sizeof(fills));
+    fills[0].fill_id = 9001;
+    fills[0].order_id = 3000000001LL;
+    fills[0].contract_id = 555;
+    fills[0].quantity = 1;
+    fills[0].price = 4500.25;
+    fills[0].active = true;
+    fills[1] = fills[0];
+    fills[1].fill_id = 9002;
+    fills[1].price = 4500.5;
+    TEST_ASSERT(ninja_export_fills(path, fills, 2) == NINJA_ERROR_INVALID_PARAM, "Mismatched file should be refused");
+    remove(path);
+
+    path = "test_fills.col";
+    remove(path);
+    double* prices = NULL;
+    TEST_ASSERT(ninja_export_fills(path, fills, 2) == NINJA_OK, "Fill export failed");
+    TEST_ASSERT(ninja_read_column_double(path, "price", &prices, &count) == NINJA_OK && count == 2 &&
+                prices[1] == 4500.5, "Fill price column mismatch");
+    ninja_free_array(prices);
+    remove(path);
+
+    ninja_position_t positions[2];
+    memset(positions, 0, sizeof(positions));
+    strcpy(positions[0].symbol, "ESZ3");
+    positions[0].net_position = -2;
+    strcpy(positions[1].symbol, "CLF4");
+    positions[1].net_position = 5;
+    ninja_position_columns_t position_columns;
+    TEST_ASSERT(ninja_positions_to_columns(positions, 2, &position_columns) == NINJA_OK &&
+                position_columns.symbol_count == 2 && position_columns.net_position[0] == -2 &&
+                strcmp(position_columns.symbols[position_columns.symbol[1]], "CLF4") == 0,
+                "Position columns mismatch");
+    ninja_free_array(position_columns.storage);
+
+    TEST_PASS();
+}
+
+// Test fill decoding, paging past a fill id and execution quality
+int test_fills() {
+    // Order 7 buys 3 in two fills (one busted), order 8 sells 2; ids out of order
+    const char* json =
+        "[{\"id\":103,\"orderId\":8,\"contractId\":555,\"timestamp\":\"2024-03-15T14:30:00.400Z\","
+        "\"action\":\"Sell\",\"qty\":2,\"price\":4499.5,\"active\":true},"
+        "{\"id\":101,\"orderId\":7,\"contractId\":555,\"timestamp\":\"2024-03-15T14:30:00.100Z\","
+        "\"action\":\"Buy\",\"qty\":1,\"price\":4500.0,\"active\":true},"
+        "{\"id\":102,\"orderId\":7,\"contractId\":555,\"timestamp\":\"2024-03-15T14:30:00.200Z\","
+        "\"action\":\"Buy\",\"qty\":2,\"price\":4501.0,\"active\":true},"
+        "{\"id\":104,\"orderId\":7,\"contractId\":555,\"timestamp\":\"2024-03-15T14:30:00.300Z\","
+        "\"action\":\"Buy\",\"qty\":5,\"price\":4490.0,\"active\":false}]";
+
+    ninja_fill_t* fills = NULL;
+    size_t count = 0;
+    TEST_ASSERT(ninja_parse_fills(json, strlen(json), &fills, &count) == NINJA_OK && count == 4, "Fill parsing failed");
+    TEST_ASSERT(fills[0].fill_id == 103 && fills[0].order_id == 8 && fills[0].contract_id == 555 &&
+                fills[0].side == NINJA_SIDE_SELL && fills[0].quantity == 2 && fills[0].price == 4499.5 &&
+                fills[0].active && fills[0].timestamp_ns == 1710513000400000000LL, "Fill fields mismatch");
+    TEST_ASSERT(!fills[3].active, "Busted fill should be inactive");
+
+    // Fills of one order kept together, as fill/deps returns them
+    ninja_fill_t grouped[4] = { fills[1], fills[2], fills[3], fills[0] };
+    ninja_free_array(fills);
+    ninja_fill_columns_t columns;
+    TEST_ASSERT(ninja_fills_to_columns(grouped, 4, &columns) == NINJA_OK, "Fill columns failed");
+
+    ninja_arrival_t arrivals[3] = {
+        { 7, NINJA_SIDE_BUY, 4500.0, 1710513000000000000LL },
+        { 8, NINJA_SIDE_SELL, 4500.0, 1710513000000000000LL },
+        { 9, NINJA_SIDE_BUY, 4500.0, 1710513000000000000LL }
+    };
+    ninja_execution_t results[3];
+    TEST_ASSERT(ninja_execution_quality(&columns, arrivals, 3, results) == NINJA_OK, "Execution quality failed");
+    TEST_ASSERT(results[0].order_id == 7 && results[0].fills == 2 && results[0].quantity == 3 &&
+                fabs(results[0].vwap - 4500.0 - 2.0 / 3.0) < 1e-9 && fabs(results[0].slippage - 2.0 / 3.0) < 1e-9,
+                "Buy execution mismatch");
+    TEST_ASSERT(results[0].first_fill_latency_ns == 100000000LL && results[0].last_fill_latency_ns == 200000000LL,
+                "Fill latency mismatch");
+    TEST_ASSERT(results[1].quantity == 2 && results[1].vwap == 4499.5 && results[1].slippage == 0.5 &&
+                fabs(results[1].slippage_bps - 0.5 / 4500.0 * 10000.0) < 1e-9, "Sell slippage should be positive");
+    TEST_ASSERT(results[2].fills == 0 && results[2].quantity == 0 && results[2].vwap == 0.0,
+                "Order without fills should be empty");
+
+    arrivals[2].order_id = 7;
+    TEST_ASSERT(ninja_execution_quality(&columns, arrivals, 3, results) == NINJA_ERROR_INVALID_PARAM,
+                "Duplicate orders should be refused");
+    ninja_free_array(columns.storage);
+
+    ninja_client_t* client = ninja_client_create(NINJA_ENV_DEMO);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+    TEST_ASSERT(ninja_get_order_fills(client, 0, &fills, &count) == NINJA_ERROR_INVALID_PARAM,
+                "Should reject zero order id");
+    TEST_ASSERT(ninja_get_fills_since(client, -1, 0, &fills, &count) == NINJA_ERROR_INVALID_PARAM,
+                "Should reject negative fill id");
+    ninja_client_destroy(client);
+
+#ifndef _WIN32
+    // fill/list answered from a file: pages of two past the cursor, in id order
+    const char* fixture = "test_fill_list.json";
+    char base_url[700];
+    TEST_ASSERT(test_write_fixture(fixture, json), "Fixture creation failed");
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+
+    TEST_ASSERT(ninja_get_fills_since(client, 0, 2, &fills, &count) == NINJA_OK && count == 2 &&
+                fills[0].fill_id == 101 && fills[1].fill_id == 102, "First page mismatch");
+    int64_t cursor = fills[count - 1].fill_id;
+    ninja_free_array(fills);
+    TEST_ASSERT(ninja_get_fills_since(client, cursor, 2, &fills, &count) == NINJA_OK && count == 2 &&
+                fills[0].fill_id == 103 && fills[1].fill_id == 104, "Second page mismatch");
+    cursor = fills[count - 1].fill_id;
+    ninja_free_array(fills);
+    TEST_ASSERT(ninja_get_fills_since(client, cursor, 2, &fills, &count) == NINJA_OK && count == 0 && fills == NULL,
+                "Nothing should be past the last fill");
+    ninja_client_destroy(client);
+    remove(fixture);
+#endif
+
+    TEST_PASS();
+}
+
+int test_request_tracing() {
+    size_t count = 0;
+    TEST_ASSERT(ninja_trace_drain(NULL, 1, &count) == NINJA_ERROR_INVALID_PARAM, "Should reject NULL spans");
+    TEST_ASSERT(strcmp(ninja_span_kind_to_string(NINJA_SPAN_TTFB), "ttfb") == 0, "Span name mismatch");
+    TEST_ASSERT(strcmp(ninja_span_kind_to_string(NINJA_SPAN_KIND_COUNT), "unknown") == 0, "Span name mismatch");
+
+    ninja_error_t enabled = ninja_trace_enable(true);
+    if (enabled == NINJA_ERROR_NOT_FOUND) {
+        // Built without tracing
+        TEST_ASSERT(ninja_trace_drain(NULL, 0, &count) == NINJA_OK && count == 0, "Nothing should be recorded");
+        TEST_PASS();
+    }
+    TEST_ASSERT(enabled == NINJA_OK, "Enabling tracing failed");
+
+    // Submitted requests: a queue and a callback span on the I/O thread, one trace each
+    test_completions_t seen = { 0, true, true };
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.io_thread = true;
+    options.completion_callback = test_record_completion;
+    options.completion_user_data = &seen;
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with I/O thread creation failed");
+
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT(ninja_submit_order(client, &request, NULL) == NINJA_OK, "Submission failed");
+    }
+    ninja_client_destroy(client);
+    TEST_ASSERT(seen.count == 3, "Every submitted request should complete");
+
+    ninja_span_t spans[64];
+    TEST_ASSERT(ninja_trace_drain(spans, 64, &count) == NINJA_OK, "Drain failed");
+    int queued = 0;
+    int callbacks = 0;
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT(spans[i].trace_id != 0 && spans[i].thread_id != 0 && spans[i].duration_ns >= 0,
+                    "Span fields incorrect");
+        if (spans[i].kind == NINJA_SPAN_QUEUE) {
+            queued++;
+        } else if (spans[i].kind == NINJA_SPAN_CALLBACK) {
+            callbacks++;
+            bool matched = false;
+            for (size_t j = 0; j < count; j++) {
+                matched = matched || (spans[j].kind == NINJA_SPAN_QUEUE && spans[j].trace_id == spans[i].trace_id);
+            }
+            TEST_ASSERT(matched, "Callback should share its request's trace");
+        }
+    }
+    TEST_ASSERT(queued == 3 && callbacks == 3, "Expected a queue and a callback span per request");
+    TEST_ASSERT(ninja_trace_drain(spans, 64, &count) == NINJA_OK && count == 0, "Drained spans should be gone");
+
+#ifndef _WIN32
+    // A GET answered from a file records its transfer, exported as a Chrome trace
+    const char* fixture = "test_trace_fills.json";
+    char base_url[700];
+    TEST_ASSERT(test_write_fixture(fixture, "[]"), "Fixture creation failed");
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client creation failed");
+    ninja_fill_t* fills = NULL;
+    TEST_ASSERT(ninja_get_fills(client, &fills, &count) == NINJA_OK && count == 0, "Fill list failed");
+    ninja_client_destroy(client);
+    remove(fixture);
+
+    const char* trace_path = "test_trace.json";
+    TEST_ASSERT(ninja_trace_export_chrome(trace_path) == NINJA_OK, "Export failed");
+    char trace[4096];
+    FILE* file = fopen(trace_path, "r");
+    TEST_ASSERT(file != NULL, "Trace file missing");
+    size_t length = fread(trace, 1, sizeof(trace) - 1, file);
+    fclose(file);
+    remove(trace_path);
+    trace[length] = '\0';
+    TEST_ASSERT(strncmp(trace, "{\"traceEvents\":[", 16) == 0, "Trace header mismatch");
+    TEST_ASSERT(strstr(trace, "\"name\":\"receive\"") != NULL, "Transfer should be traced");
+    TEST_ASSERT(strstr(trace, "\"displayTimeUnit\":\"ns\"}") != NULL, "Trace should be complete");
+#endif
+
+    // Disabled tracing records nothing new
+    TEST_ASSERT(ninja_trace_enable(false) == NINJA_OK, "Disabling tracing failed");
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.io_thread = true;
+    client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with I/O thread creation failed");
+    TEST_ASSERT(ninja_submit_order(client, &request, NULL) == NINJA_OK, "Submission failed");
+    ninja_client_destroy(client);
+    TEST_ASSERT(ninja_trace_drain(spans, 64, &count) == NINJA_OK && count == 0, "Disabled tracing recorded spans");
+    TEST_ASSERT(ninja_trace_dropped() == 0, "No span should have been dropped");
+
+    TEST_PASS();
+}
+
+int test_debug_log() {
+    ninja_client_options_t options;
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    TEST_ASSERT(!options.debug_mode && options.debug_log_capacity > 0, "Debug logging should default off");
+    options.debug_mode = true;
+    options.debug_log_capacity = 0;
+    TEST_ASSERT(ninja_client_create_with_options(&options) == NULL, "Empty debug log should be refused");
+
+#ifndef _WIN32
+    // Answers from a file: an acknowledged placement, a refused one, then no file at all
+    const char* fixture = "test_debug_order.json";
+    const char* log_path = "test_debug.log";
+    remove(log_path);
+
+    char base_url[700];
+    TEST_ASSERT(test_fixture_url(fixture, base_url, sizeof(base_url)), "Fixture URL failed");
+    ninja_client_options_init(&options, NINJA_ENV_DEMO);
+    options.base_url = base_url;
+    options.http_retries = 0;
+    options.debug_mode = true;
+    options.debug_log_path = log_path;
+    ninja_client_t* client = ninja_client_create_with_options(&options);
+    TEST_ASSERT(client != NULL, "Client with debug log creation failed");
+
+    ninja_order_request_t request;
+    memset(&request, 0, sizeof(request));
+    strcpy(request.symbol, "ESZ6");
+    request.account_id = 1;
+    request.quantity = 1;
+    request.side = NINJA_SIDE_BUY;
+    request.type = NINJA_ORDER_MARKET;
+    strcpy(request.client_order_id, "debug-1");
+    ninja_order_t order;
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(test_write_fixture(fixture, "{\"id\": 77, \"accountId\": 1}"), "Fixture creation failed");
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_OK && order.order_id == 77,
+                "Placement should be acknowledged");
+
+    strcpy(request.client_order_id, "debug-2");
+    memset(&order, 0, sizeof(order));
+    TEST_ASSERT(test_write_fixture(fixture, "{\"errorText\": \"Insufficient margin\"}"), "Fixture creation failed");
+    TEST_ASSERT(ninja_place_order_request(client, &request, &order) == NINJA_ERROR_ORDER_REJECTED,
+                "Placement should be refused");
+
+    remove(fixture);
+    ninja_account_t* accounts = NULL;
+    size_t count = 0;
+    TEST_ASSERT(ninja_get_accounts(client, &accounts, &count) != NINJA_OK, "Missing file should fail");
+
+    // Destroy writes out everything logged
+    ninja_client_destroy(client);
+
+    char log[8192];
+    FILE* file = fopen(log_path, "r");
+    TEST_ASSERT(file != NULL, "Debug log missing");
+    size_t length = fread(log, 1, sizeof(log) - 1, file);
+    fclose(file);
+    remove(log_path);
+    log[length] = '\0';
+    TEST_ASSERT(strstr(log, "POST ") != NULL && strstr(log, "order/placeorder -> ") != NULL,
+                "Placement request should be logged");
+    TEST_ASSERT(strstr(log, "order 77 acknowledged (clOrdId debug-1)") != NULL, "Acknowledgement should be logged");
+    TEST_ASSERT(strstr(log, "order rejected (clOrdId debug-2): Insufficient margin") != NULL,
+                "Rejection should be logged");
+    TEST_ASSERT(strstr(log, "GET ") != NULL && strstr(log, "account/list failed: ") != NULL,
+                "Transport failure should be logged");
+#endif
+
+    TEST_PASS();
+}
+
 int main() {
     printf("Running NinjaTrader API Basic Tests\n");
     printf("==================================\n\n");
@@ -143,6 +1804,31 @@ int main() {
     tests_run++; if (test_invalid_parameters()) tests_passed++;
     tests_run++; if (test_order_parameters()) tests_passed++;
     tests_run++; if (test_memory_management()) tests_passed++;
+    tests_run++; if (test_compact_layout()) tests_passed++;
+    tests_run++; if (test_compact_orders()) tests_passed++;
+    tests_run++; if (test_order_id_api()) tests_passed++;
+    tests_run++; if (test_parse_timestamp()) tests_passed++;
+    tests_run++; if (test_enum_strings()) tests_passed++;
+    tests_run++; if (test_parse_responses()) tests_passed++;
+    tests_run++; if (test_contract_catalog()) tests_passed++;
+    tests_run++; if (test_contract_search()) tests_passed++;
+    tests_run++; if (test_order_journal()) tests_passed++;
+    tests_run++; if (test_shared_memory()) tests_passed++;
+    tests_run++; if (test_io_thread()) tests_passed++;
+    tests_run++; if (test_list_delta()) tests_passed++;
+    tests_run++; if (test_transfer_stats()) tests_passed++;
+    tests_run++; if (test_order_batches()) tests_passed++;
+    tests_run++; if (test_http_retries()) tests_passed++;
+    tests_run++; if (test_client_order_ids()) tests_passed++;
+    tests_run++; if (test_order_templates()) tests_passed++;
+    tests_run++; if (test_library_context()) tests_passed++;
+    tests_run++; if (test_session_manager()) tests_passed++;
+    tests_run++; if (test_chart_download()) tests_passed++;
+    tests_run++; if (test_bar_aggregator()) tests_passed++;
+    tests_run++; if (test_columnar_export()) tests_passed++;
+    tests_run++; if (test_fills()) tests_passed++;
+    tests_run++; if (test_request_tracing()) tests_passed++;
+    tests_run++; if (test_debug_log()) tests_passed++;
 
     printf("\nTest Results: %d/%d passed\n", tests_passed, tests_run);
 